@@ -10,4 +10,5 @@ Object-Oriented Numerical Analysis
 #include "arraybasecontainerEXH.h"
 #include "vectorcontainerEXH.h"
 #include "matrixcontainerEXH.h"
+#include "fixedcontainersEXH.h"
 
@@ -105,7 +105,7 @@ void CGlobalErrorHandler::ErrorHandler (std::ostream& OF, ERRORCODE& ErCode)
     OF << strM << "\n";
 }
 
-void CGlobalErrorHandler::ErrorHandler (CArrayBase::ERRORVM& err)
+void CGlobalErrorHandler::ErrorHandler (CArrayBase::CError& err)
 // ---------------------------------------------------------------------------
 // Function: Displays the CVector/CMatrix error message on the error stream
 // Input:    Error #
@@ -116,7 +116,7 @@ void CGlobalErrorHandler::ErrorHandler (CArrayBase::ERRORVM& err)
 }
 
 void CGlobalErrorHandler::ErrorHandler (std::ostream& OF, 
-                                        CArrayBase::ERRORVM& err)
+                                        CArrayBase::CError& err)
 // ---------------------------------------------------------------------------
 // Function: Displays the CVector/CMatrix error message on the error stream
 // Input:    Error #
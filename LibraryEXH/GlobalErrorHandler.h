@@ -65,8 +65,8 @@ class CGlobalErrorHandler : public std::exception
 
         void static ErrorHandler (std::ostream& OF, ERRORCODE& err);
         void static ErrorHandler (ERRORCODE& err);
-        void static ErrorHandler (std::ostream& OF, CArrayBase::ERRORVM& err);
-        void static ErrorHandler (CArrayBase::ERRORVM& err);
+        void static ErrorHandler (std::ostream& OF, CArrayBase::CError& err);
+        void static ErrorHandler (CArrayBase::CError& err);
         void static ErrorHandler (std::ostream& OF, std::exception& err);
         void static ErrorHandler (std::exception& err);
         bool OverFlowDetected ();
@@ -0,0 +1,208 @@
+/*********************************************
+Utility Library Function
+Copyright(c) 2006-23, S. D. Rajan
+All rights reserved
+
+Object-Oriented Numerical Analysis
+*********************************************/
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "arenaEXH.h"
+
+thread_local CArena* CArena::m_pCurrent = nullptr;
+
+CArena::CArena (const size_t nBlockSize)
+// ---------------------------------------------------------------------------
+// Function: ctor. no memory is reserved until the first allocation
+// Input:    size of a regular block (bytes)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_nBlockSize = (nBlockSize > 0 ? nBlockSize : BLOCKSIZE);
+    m_nOffset = 0;
+    m_nBytesUsed = 0;
+    m_nBytesReserved = 0;
+}
+
+CArena::~CArena ()
+// ---------------------------------------------------------------------------
+// Function: dtor. releases all blocks
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    // an arena must not stay bound after it is gone
+    if (m_pCurrent == this)
+        m_pCurrent = nullptr;
+    FreeBlocks (0);
+}
+
+void* CArena::Allocate (const size_t nBytes, const size_t nAlign)
+// ---------------------------------------------------------------------------
+// Function: hands out the next nBytes of the current block, starting a new
+//           block when the request does not fit. requests larger than a
+//           quarter of a block get a block of their own so that the current
+//           block is not abandoned
+// Input:    # of bytes, alignment (power of 2)
+// Output:   returns the address. throws std::bad_alloc on failure
+// ---------------------------------------------------------------------------
+{
+    const size_t nA = (nAlign > 0 ? nAlign : 1);
+    const size_t nNeed = nBytes + nA - 1;
+    m_nBytesUsed += nBytes;
+
+    if (nNeed > m_nBlockSize/4)
+    {
+        unsigned char* pData = NewBlock (nNeed);
+        // the block being filled stays last
+        if (m_Blocks.size() > 1)
+            std::swap (m_Blocks[m_Blocks.size()-1], m_Blocks[m_Blocks.size()-2]);
+        else
+            m_nOffset = nNeed;  // full, the next request starts a new block
+        return AlignUp (pData, nA);
+    }
+
+    if (m_Blocks.empty() || m_nOffset + nNeed > m_Blocks.back().nSize)
+    {
+        NewBlock (m_nBlockSize);
+        m_nOffset = 0;
+    }
+    unsigned char* pData = m_Blocks.back().pData;
+    unsigned char* pCell = AlignUp (pData + m_nOffset, nA);
+    m_nOffset = static_cast<size_t>(pCell - pData) + nBytes;
+
+    return pCell;
+}
+
+void CArena::Reset ()
+// ---------------------------------------------------------------------------
+// Function: releases everything handed out. the block being filled is kept
+//           for reuse if it is a regular one
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (!m_Blocks.empty() && m_Blocks.back().nSize == m_nBlockSize)
+    {
+        std::swap (m_Blocks.front(), m_Blocks.back());
+        FreeBlocks (1);
+    }
+    else
+        FreeBlocks (0);
+    m_nOffset = 0;
+    m_nBytesUsed = 0;
+}
+
+size_t CArena::GetBytesUsed () const
+// ---------------------------------------------------------------------------
+// Function: gets the # of bytes handed out since the last reset
+// Input:    none
+// Output:   returns the # of bytes
+// ---------------------------------------------------------------------------
+{
+    return m_nBytesUsed;
+}
+
+size_t CArena::GetBytesReserved () const
+// ---------------------------------------------------------------------------
+// Function: gets the # of bytes held in blocks
+// Input:    none
+// Output:   returns the # of bytes
+// ---------------------------------------------------------------------------
+{
+    return m_nBytesReserved;
+}
+
+int CArena::GetNumBlocks () const
+// ---------------------------------------------------------------------------
+// Function: gets the # of blocks held
+// Input:    none
+// Output:   returns the # of blocks
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_Blocks.size());
+}
+
+CArena* CArena::GetCurrent ()
+// ---------------------------------------------------------------------------
+// Function: gets the arena bound to the calling thread
+// Input:    none
+// Output:   returns the arena (nullptr if there is none)
+// ---------------------------------------------------------------------------
+{
+    return m_pCurrent;
+}
+
+unsigned char* CArena::NewBlock (const size_t nSize)
+// ---------------------------------------------------------------------------
+// Function: reserves a block and appends it to the list
+// Input:    block size (bytes)
+// Output:   returns the block storage. throws std::bad_alloc on failure
+// ---------------------------------------------------------------------------
+{
+    CBlock Block;
+    Block.pData = new unsigned char[nSize];
+    Block.nSize = nSize;
+    try
+    {
+        m_Blocks.push_back (Block);
+    }
+    catch (std::bad_alloc&)
+    {
+        delete [] Block.pData;
+        throw;
+    }
+    m_nBytesReserved += nSize;
+    return Block.pData;
+}
+
+unsigned char* CArena::AlignUp (unsigned char* pAddress, const size_t nAlign)
+// ---------------------------------------------------------------------------
+// Function: rounds an address up to a multiple of the alignment
+// Input:    address, alignment (power of 2)
+// Output:   returns the aligned address
+// ---------------------------------------------------------------------------
+{
+    std::uintptr_t nAddress = reinterpret_cast<std::uintptr_t>(pAddress);
+    std::uintptr_t nAligned = (nAddress + nAlign - 1) &
+                              ~static_cast<std::uintptr_t>(nAlign - 1);
+    return pAddress + (nAligned - nAddress);
+}
+
+void CArena::FreeBlocks (const size_t nKeep)
+// ---------------------------------------------------------------------------
+// Function: releases all but the first nKeep blocks
+// Input:    # of blocks to keep
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    for (size_t i = nKeep; i < m_Blocks.size(); i++)
+    {
+        m_nBytesReserved -= m_Blocks[i].nSize;
+        delete [] m_Blocks[i].pData;
+    }
+    if (m_Blocks.size() > nKeep)
+        m_Blocks.resize (nKeep);
+}
+
+CArena::CScope::CScope (CArena* pArena)
+// ---------------------------------------------------------------------------
+// Function: ctor. binds the arena to the calling thread
+// Input:    arena (nullptr to use the heap within the scope)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pPrevious = CArena::m_pCurrent;
+    CArena::m_pCurrent = pArena;
+}
+
+CArena::CScope::~CScope ()
+// ---------------------------------------------------------------------------
+// Function: dtor. restores the previous binding
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CArena::m_pCurrent = m_pPrevious;
+}
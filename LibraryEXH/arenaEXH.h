@@ -0,0 +1,74 @@
+/*********************************************
+Utility Library Function
+Copyright(c) 2006-23, S. D. Rajan
+All rights reserved
+
+Object-Oriented Numerical Analysis
+*********************************************/
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// --------------------------------------------------------------------------
+// Bump allocator for short-lived array storage. Memory is carved out of
+// large blocks and is never returned piecemeal; the whole arena is released
+// at once (Reset or destructor). An arena is bound to the calling thread with
+// a CArena::CScope, and CVector / CMatrix of plain element types then draw
+// their cells from it instead of the heap.
+// The arena must outlive every container that allocated from it, and is
+// used by one thread at a time.
+// --------------------------------------------------------------------------
+class CArena
+{
+    public:
+        static const size_t BLOCKSIZE = 65536;  // default block size (bytes)
+
+        explicit CArena (const size_t nBlockSize = BLOCKSIZE); // ctor
+        ~CArena ();                                            // dtor
+
+        // binds an arena to the calling thread for the lifetime of the
+        // scope (nullptr unbinds); the previous binding is restored
+        class CScope
+        {
+            public:
+                explicit CScope (CArena* pArena);
+                ~CScope ();
+            private:
+                CArena* m_pPrevious;
+                CScope (const CScope&) = delete;
+                CScope& operator= (const CScope&) = delete;
+        };
+
+        // helper functions
+        void* Allocate (const size_t nBytes, const size_t nAlign);
+        void  Reset ();
+
+        // accessor functions
+        size_t GetBytesUsed () const;
+        size_t GetBytesReserved () const;
+        int    GetNumBlocks () const;
+        static CArena* GetCurrent ();
+
+    private:
+        struct CBlock
+        {
+            unsigned char* pData;   // block storage
+            size_t nSize;           // block size (bytes)
+        };
+        std::vector<CBlock> m_Blocks;  // blocks, the last one is being filled
+        size_t m_nBlockSize;           // size of a regular block
+        size_t m_nOffset;              // bytes used in the last block
+        size_t m_nBytesUsed;           // bytes handed out since the last reset
+        size_t m_nBytesReserved;       // bytes held in blocks
+
+        static thread_local CArena* m_pCurrent; // arena bound to this thread
+
+        unsigned char* NewBlock (const size_t nSize);
+        void FreeBlocks (const size_t nKeep);
+        static unsigned char* AlignUp (unsigned char* pAddress,
+                                       const size_t nAlign);
+
+        // no copies
+        CArena (const CArena&) = delete;
+        CArena& operator= (const CArena&) = delete;
+};
@@ -7,16 +7,21 @@ Object-Oriented Numerical Analysis
 *********************************************/
 #include <iostream>
 #include <sstream>
+#include <new>
+#include <mutex>
+#include <vector>
+#include <algorithm>
 #include "arraybasecontainerEXH.h"
+#include "arenaEXH.h"
 
-std::string CArrayBase::m_strName;
-double CArrayBase::m_dAllocated = 0.0;
-double CArrayBase::m_dDeAllocated = 0.0;
-long   CArrayBase::m_ValueR = 0;
-long   CArrayBase::m_ValueC = 0;
-double CArrayBase::m_dASOP = 0.0;
-double CArrayBase::m_dMOP = 0.0;
-double CArrayBase::m_dDOP = 0.0;
+thread_local CArrayBase::CCounters CArrayBase::m_Counters;
+
+struct CArrayBase::CRegistry
+{
+    std::mutex Mutex;
+    std::vector<const CCounters*> Live;   // counters of the live threads
+    double dRetired[5] = {0.0, 0.0, 0.0, 0.0, 0.0}; // finished threads
+};
 
 CArrayBase::CArrayBase ()
 // ----------------------------------------------------------------------------
@@ -25,7 +30,6 @@ CArrayBase::CArrayBase ()
 // Output:   None
 // ----------------------------------------------------------------------------
 {
-    m_ValueR = m_ValueC = 0;
 }
 
 CArrayBase::~CArrayBase ()
@@ -37,26 +41,150 @@ CArrayBase::~CArrayBase ()
 {
 }
 
+CArrayBase::CRegistry& CArrayBase::Registry ()
+// ----------------------------------------------------------------------------
+// Function: gets the registry of the per-thread counters. It is created on
+//           first use and never destroyed, so that threads that finish
+//           during program exit can still report to it
+// Input:    None 
+// Output:   the registry
+// ----------------------------------------------------------------------------
+{
+    static CRegistry* pRegistry = new CRegistry;
+    return *pRegistry;
+}
+
+CArrayBase::CCounters::CCounters ()
+// ----------------------------------------------------------------------------
+// Function: constructor. zeroes the counts of the new thread and adds them
+//           to the list of live threads
+// Input:    None 
+// Output:   None
+// ----------------------------------------------------------------------------
+    : dAllocated(0.0), dDeAllocated(0.0), dASOP(0.0), dMOP(0.0), dDOP(0.0)
+{
+    CRegistry& R = Registry ();
+    std::lock_guard<std::mutex> Lock(R.Mutex);
+    R.Live.push_back (this);
+}
+
+CArrayBase::CCounters::~CCounters ()
+// ----------------------------------------------------------------------------
+// Function: destructor. the counts of the finishing thread are kept in the
+//           totals
+// Input:    None 
+// Output:   None
+// ----------------------------------------------------------------------------
+{
+    CRegistry& R = Registry ();
+    std::lock_guard<std::mutex> Lock(R.Mutex);
+    R.dRetired[0] += dAllocated.load ();
+    R.dRetired[1] += dDeAllocated.load ();
+    R.dRetired[2] += dASOP.load ();
+    R.dRetired[3] += dMOP.load ();
+    R.dRetired[4] += dDOP.load ();
+    R.Live.erase (std::remove (R.Live.begin(), R.Live.end(), this),
+                  R.Live.end());
+}
+
 void CArrayBase::ShowStatistics (std::ostream& OF)
 // ----------------------------------------------------------------------------
-// Function: show statistics
+// Function: show statistics of the calling thread
 // Input:    None 
 // Output:   None
 // ----------------------------------------------------------------------------
 {
     OF << "\n"
-       << "  Allocated : " << m_dAllocated << " bytes\n"
-       << "DeAllocated : " << m_dDeAllocated << " bytes\n";
+       << "  Allocated : " << m_Counters.dAllocated.load () << " bytes\n"
+       << "DeAllocated : " << m_Counters.dDeAllocated.load () << " bytes\n";
+}
+
+void CArrayBase::ShowTotalStatistics (std::ostream& OF)
+// ----------------------------------------------------------------------------
+// Function: show statistics summed over all threads
+// Input:    None 
+// Output:   None
+// ----------------------------------------------------------------------------
+{
+    double dAllocated, dDeAllocated, dASOP, dMOP, dDOP;
+    GetTotals (dAllocated, dDeAllocated, dASOP, dMOP, dDOP);
+    OF << "\n"
+       << "  Allocated : " << dAllocated << " bytes\n"
+       << "DeAllocated : " << dDeAllocated << " bytes\n";
+}
+
+void CArrayBase::GetTotals (double& dAllocated, double& dDeAllocated,
+                            double& dASOP, double& dMOP, double& dDOP)
+// ----------------------------------------------------------------------------
+// Function: sums the statistics over the live and the finished threads.
+//           counts of live threads are read as they stand
+// Input:    None 
+// Output:   bytes allocated and deallocated, # of +/-, * and / operations
+// ----------------------------------------------------------------------------
+{
+    CRegistry& R = Registry ();
+    std::lock_guard<std::mutex> Lock(R.Mutex);
+    dAllocated = R.dRetired[0];
+    dDeAllocated = R.dRetired[1];
+    dASOP = R.dRetired[2];
+    dMOP = R.dRetired[3];
+    dDOP = R.dRetired[4];
+    for (const CCounters* pC : R.Live)
+    {
+        dAllocated += pC->dAllocated.load (std::memory_order_relaxed);
+        dDeAllocated += pC->dDeAllocated.load (std::memory_order_relaxed);
+        dASOP += pC->dASOP.load (std::memory_order_relaxed);
+        dMOP += pC->dMOP.load (std::memory_order_relaxed);
+        dDOP += pC->dDOP.load (std::memory_order_relaxed);
+    }
 }
 
 void CArrayBase::Reset ()
 // ----------------------------------------------------------------------------
-// Function: resets the stats
+// Function: resets the stats of the calling thread
 // Input:    None 
 // Output:   None
 // ----------------------------------------------------------------------------
 {
-    m_dAllocated = m_dDeAllocated = 0.0;
+    m_Counters.dAllocated.store (0.0);
+    m_Counters.dDeAllocated.store (0.0);
+}
+
+void* CArrayBase::AllocateCells (const size_t nBytes, const size_t nAlign,
+                                 bool& bArena)
+// ---------------------------------------------------------------------------
+// Function: raw storage for the cells of a plain element type. taken from
+//           the arena bound to the calling thread or else from the heap
+// Input:    # of bytes, alignment
+// Output:   returns the storage, bArena tells where it came from.
+//           throws std::bad_alloc on failure
+// ---------------------------------------------------------------------------
+{
+    CArena* pArena = CArena::GetCurrent ();
+    bArena = (pArena != nullptr);
+    if (bArena)
+        return pArena->Allocate (nBytes, nAlign);
+    if (nAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        return ::operator new (nBytes, std::align_val_t(nAlign));
+    return ::operator new (nBytes);
+}
+
+void CArrayBase::FreeCells (void* pCells, const size_t nAlign,
+                            const bool bArena)
+// ---------------------------------------------------------------------------
+// Function: releases storage from AllocateCells. arena storage is released
+//           with the arena
+// Input:    storage, alignment it was requested with, whether it came
+//           from an arena
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (pCells == nullptr || bArena)
+        return;
+    if (nAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        ::operator delete (pCells, std::align_val_t(nAlign));
+    else
+        ::operator delete (pCells);
 }
 
 void CArrayBase::ErrorHandler (ERRORVM ErrorCode)
@@ -66,7 +194,7 @@ void CArrayBase::ErrorHandler (ERRORVM ErrorCode)
 // Output:   none
 // ---------------------------------------------------------------------------
 {
-    ErrorHandler (std::cerr, ErrorCode);
+    ErrorHandler (std::cerr, CError(ErrorCode));
 }
 
 void CArrayBase::ErrorHandler (std::ostream& OF, ERRORVM ErrorCode)
@@ -75,48 +203,123 @@ void CArrayBase::ErrorHandler (std::ostream& OF, ERRORVM ErrorCode)
 // Input:    error code 
 // Output:   none
 // ---------------------------------------------------------------------------
+{
+    ErrorHandler (OF, CError(ErrorCode));
+}
+
+void CArrayBase::ErrorHandler (std::ostream& OF, const CError& Err)
+// ---------------------------------------------------------------------------
+// Function: writes the error message with the context held by the error
+// Input:    error
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    OF << Err.Describe () << "\n";
+}
+
+CArrayBase::CError::CError (ERRORVM Code, const std::string& strName,
+                            long nR, long nC)
+// ---------------------------------------------------------------------------
+// Function: constructor
+// Input:    error code, name of the vector/matrix, row and column (index
+//           or size, depending on the error)
+// Output:   none
+// ---------------------------------------------------------------------------
+    : m_Code(Code), m_strName(strName), m_nR(nR), m_nC(nC)
+{
+}
+
+CArrayBase::ERRORVM CArrayBase::CError::GetCode () const
+// ---------------------------------------------------------------------------
+// Function: gets the error code
+// Input:    none
+// Output:   error code
+// ---------------------------------------------------------------------------
+{
+    return m_Code;
+}
+
+const std::string& CArrayBase::CError::GetName () const
+// ---------------------------------------------------------------------------
+// Function: gets the name of the vector/matrix
+// Input:    none
+// Output:   name (empty if the container has none)
+// ---------------------------------------------------------------------------
+{
+    return m_strName;
+}
+
+long CArrayBase::CError::GetRow () const
+// ---------------------------------------------------------------------------
+// Function: gets the row index or size involved
+// Input:    none
+// Output:   row
+// ---------------------------------------------------------------------------
+{
+    return m_nR;
+}
+
+long CArrayBase::CError::GetColumn () const
+// ---------------------------------------------------------------------------
+// Function: gets the column index or size involved
+// Input:    none
+// Output:   column
+// ---------------------------------------------------------------------------
+{
+    return m_nC;
+}
+
+std::string CArrayBase::CError::Describe () const
+// ---------------------------------------------------------------------------
+// Function: composes the error message
+// Input:    none
+// Output:   message (one line)
+// ---------------------------------------------------------------------------
 {
     std::ostringstream strMessage;
     if (!m_strName.empty())
         strMessage << "Array name: " << m_strName << ". ";
-    switch (ErrorCode)
+    switch (m_Code)
     {
         case MATRIX_ALLOCATION_ERROR:
-            strMessage << "CMatrix:: Memory allocation failure: " << m_ValueR << ".";
+            strMessage << "CMatrix:: Memory allocation failure: " << m_nR
+                       << " x " << m_nC << ".";
             break;
         case MATRIX_INDEX_OUT_OF_BOUNDS:
-            strMessage << "CMatrix::Row-Column (" << m_ValueR << ", "
-                      << m_ValueC << ") is out of bounds.";
+            strMessage << "CMatrix::Row-Column (" << m_nR << ", "
+                       << m_nC << ") is out of bounds.";
             break;
         case MATRIX_INVALID_SIZE:
             strMessage << "CMatrix::Constructor. Invalid number of rows "
-                         "or columns: " << m_ValueR << " and " << m_ValueC << ".\n";
+                          "or columns: " << m_nR << " and " << m_nC << ".";
             break;
         case MATRIX_INCOMPATIBLE_MATRICES:
-            strMessage << "CMatrix::Incompatible matrices. ";
+            strMessage << "CMatrix::Incompatible matrices (" << m_nR
+                       << " x " << m_nC << ").";
             break;
         case MATRIX_NOT_ENOUGH_INITIALIZERS:
             strMessage << "CMatrix::Constructor. Not enough initializers.";
             break;
         case MATRIX_DEPENDENT_EQUATIONS:
-            strMessage << "CMatrix::Equations are linearly dependent.";
+            strMessage << "CMatrix::Equations are linearly dependent (pivot "
+                       << m_nR << ").";
             break;
         case MATRIX_NOT_POSITIVEDEFINITE:
             strMessage << "CMatrix::Coefficient matrix is not positive definite.";
             break;
         case VECTOR_ALLOCATION_ERROR:
-            strMessage << "Vector:: Memory allocation failure. ";
+            strMessage << "CVector:: Memory allocation failure: " << m_nR << ".";
             break;
         case VECTOR_INVALID_SIZE:
             strMessage << "CVector::Constructor. Invalid number of rows "
-                      << m_ValueR << ".\n";
+                       << m_nR << ".";
             break;
         case VECTOR_INCOMPATIBLE_VECTORS:
-            strMessage << "CVector::Incompatible vectors.\n";
+            strMessage << "CVector::Incompatible vectors (" << m_nR << " rows).";
             break;
         case VECTOR_INDEX_OUT_OF_BOUNDS:
-            strMessage << "CVector::Vector index " << m_ValueR << " is out of bounds.\n";
+            strMessage << "CVector::Vector index " << m_nR << " is out of bounds.";
             break;
     }
-    OF << strMessage.str();
+    return strMessage.str();
 }
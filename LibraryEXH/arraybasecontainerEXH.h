@@ -6,8 +6,11 @@ All rights reserved
 Object-Oriented Numerical Analysis
 *********************************************/
 #pragma once
+#include <atomic>
+#include <cstddef>
 #include <ostream>
 #include <string>
+#include <type_traits>
 
 class CArrayBase
 {
@@ -29,20 +32,74 @@ class CArrayBase
             VECTOR_INCOMPATIBLE_VECTORS,
             VECTOR_INDEX_OUT_OF_BOUNDS
         };
+
+        // error thrown by the containers. It carries its own context so
+        // that it can be reported after the stack has unwound, on any thread
+        class CError
+        {
+            public:
+                CError (ERRORVM Code, const std::string& strName = "",
+                        long nR = 0, long nC = 0);
+                ERRORVM GetCode () const;
+                const std::string& GetName () const;
+                long GetRow () const;
+                long GetColumn () const;
+                std::string Describe () const;   // error message
+            private:
+                ERRORVM m_Code;          // error code
+                std::string m_strName;   // vector/matrix name
+                long m_nR, m_nC;         // row and column indices or sizes
+        };
+
+        // statistics of the calling thread
         void static ShowStatistics (std::ostream& OF);
         void static Reset ();
+        // statistics summed over all threads, including finished ones
+        void static ShowTotalStatistics (std::ostream& OF);
+        void static GetTotals (double& dAllocated, double& dDeAllocated,
+                               double& dASOP, double& dMOP, double& dDOP);
+        static void ErrorHandler (std::ostream& OF,
+                                  const CError&);   // central function
+                                                    // to handle all errors
         static void ErrorHandler (std::ostream& OF,
-                                  ERRORVM); // central function
-                                            // to handle all errors
-        static void ErrorHandler (ERRORVM); // central function
-                                            // to handle all errors
+                                  ERRORVM);         // error without context
+        static void ErrorHandler (ERRORVM);         // error without context
 
     protected:
-        static std::string m_strName;       // vector/matrix name
-        static double m_dAllocated;         // memory allocation
-        static double m_dDeAllocated;       // memory deallocation
-        static long   m_ValueR, m_ValueC;   // row and column indices
-        static double m_dASOP;              // addition and subtraction OPs
-        static double m_dMOP, m_dDOP;       // multiplication and division OPs 
+        // element types that need no construction or destruction; their
+        // cells are drawn from the arena bound to the calling thread, if any
+        template <class T>
+        static constexpr bool IsPlain ()
+        {
+            return std::is_trivially_default_constructible<T>::value &&
+                   std::is_trivially_destructible<T>::value;
+        }
+        static void* AllocateCells (const size_t nBytes, const size_t nAlign,
+                                    bool& bArena);
+        static void  FreeCells (void* pCells, const size_t nAlign,
+                                const bool bArena);
+
+        // per-thread counters. Only the owning thread updates them, so an
+        // update is a plain load and store; the atomics only make it safe
+        // for GetTotals to read them from another thread
+        struct CCounters
+        {
+            CCounters ();   // joins the list of live threads
+            ~CCounters ();  // adds the counts to those of finished threads
+            std::atomic<double> dAllocated;     // memory allocation
+            std::atomic<double> dDeAllocated;   // memory deallocation
+            std::atomic<double> dASOP;          // addition and subtraction OPs
+            std::atomic<double> dMOP, dDOP;     // multiplication and division OPs
+        };
+        static thread_local CCounters m_Counters;
+        static void Count (std::atomic<double>& dCounter, const double dValue)
+        {
+            dCounter.store (dCounter.load (std::memory_order_relaxed) + dValue,
+                            std::memory_order_relaxed);
+        }
+
+    private:
+        struct CRegistry;              // counters of the live threads and
+        static CRegistry& Registry (); // the sum over finished threads
 };
 
@@ -0,0 +1,680 @@
+// **************************************************
+// Fixed-Size Vector and Matrix Template Classes
+// Copyright(c), 2000-23, S. D. Rajan
+// All rights reserved
+//
+// CVectorN<T,N> and CMatrixNM<T,R,C> hold their values on the stack
+// and their sizes are compile-time constants, so every operation is
+// unrolled and nothing is allocated. Meant for the small geometric
+// quantities used in the section kernels (coordinates, section
+// dimensions, strain-plane parameters, 2x2 and 3x3 section
+// stiffnesses).
+// Indexing starts at 1, as with CVector and CMatrix. Bounds are checked
+// in debug builds only.
+// CopyTo / CopyFrom exchange values with CVector and CMatrix so that
+// the CMatToolBox functions can be applied when needed.
+// **************************************************
+#pragma once
+
+#include <cmath>
+#include <utility>
+#include <initializer_list>
+#include "arraybasecontainerEXH.h"
+#include "vectorcontainerEXH.h"
+#include "matrixcontainerEXH.h"
+
+// ------------------------------------------------------------------
+// unrolled loop: calls Body(i) for i = 0..N-1
+// ------------------------------------------------------------------
+template <class F, int... I>
+inline void UnrollSeq (F& Body, std::integer_sequence<int, I...>)
+{
+   (Body (I), ...);
+}
+
+template <int N, class F>
+inline void UnrollN (F&& Body)
+{
+   UnrollSeq (Body, std::make_integer_sequence<int, N>());
+}
+
+// defines the fixed-size vector template class
+template <class T, int N>
+class CVectorN
+{
+   static_assert (N > 0, "CVectorN: size must be positive");
+
+public:
+   CVectorN () = default;                          // values are not set
+   explicit CVectorN (T V);                        // all values set to V
+   CVectorN (const std::initializer_list<T>&);     // ctor with initializers
+   explicit CVectorN (const CVector<T>&);          // first N values of a CVector
+
+   // ------------------
+   // helper functions
+   // ------------------
+   static constexpr int GetSize () { return N; }
+   T*       data ()       { return m_Cells; }
+   const T* data () const { return m_Cells; }
+   void CopyTo (CVector<T>&) const;                // CVector must hold N values
+   void CopyFrom (const CVector<T>&);
+   T    TwoNorm () const;
+
+   // -------------------------------
+   // vector manipulations (mutator)
+   // -------------------------------
+   void Set (T);
+
+   // --------------------
+   // overloaded operators
+   // --------------------
+   T&        operator() (int);                     // row access
+   const T&  operator() (int) const;               // row access
+   CVectorN  operator- () const;
+   CVectorN  operator+ (const CVectorN&) const;
+   CVectorN  operator- (const CVectorN&) const;
+   CVectorN  operator* (T c) const;
+   void      operator+= (const CVectorN&);
+   void      operator-= (const CVectorN&);
+   void      operator*= (T c);
+   T         operator* (const CVectorN&) const;    // dot product
+
+private:
+   T m_Cells[N];            // values, stored 0-based
+};
+
+// defines the fixed-size matrix template class
+template <class T, int R, int C>
+class CMatrixNM
+{
+   static_assert (R > 0 && C > 0, "CMatrixNM: size must be positive");
+
+public:
+   CMatrixNM () = default;                         // values are not set
+   explicit CMatrixNM (T V);                       // all values set to V
+   CMatrixNM (const std::initializer_list<T>&);    // row-wise initializers
+   explicit CMatrixNM (const CMatrix<T>&);         // leading R x C block
+
+   // ------------------
+   // helper functions
+   // ------------------
+   static constexpr int GetRows () { return R; }
+   static constexpr int GetColumns () { return C; }
+   T*       data ()       { return &m_Cells[0][0]; }
+   const T* data () const { return &m_Cells[0][0]; }
+   void CopyTo (CMatrix<T>&) const;                // CMatrix must be R x C
+   void CopyFrom (const CMatrix<T>&);
+   CMatrixNM<T,C,R> Tr () const;                   // transpose
+   T    Determinant () const;                      // square, up to 3 x 3
+   bool Inverse (CMatrixNM& AI) const;             // square, up to 3 x 3
+   bool Solve (const CVectorN<T,R>& b,
+               CVectorN<T,C>& x) const;            // square, up to 3 x 3
+
+   // -------------------------------
+   // matrix manipulations (mutator)
+   // -------------------------------
+   void Set (T);
+
+   // --------------------
+   // overloaded operators
+   // --------------------
+   T&        operator() (int, int);                // row-column access
+   const T&  operator() (int, int) const;          // row-column access
+   CMatrixNM operator+ (const CMatrixNM&) const;
+   CMatrixNM operator- (const CMatrixNM&) const;
+   CMatrixNM operator* (T c) const;
+   void      operator+= (const CMatrixNM&);
+   void      operator-= (const CMatrixNM&);
+   void      operator*= (T c);
+   CVectorN<T,R> operator* (const CVectorN<T,C>&) const;
+   template <int K>
+   CMatrixNM<T,R,K> operator* (const CMatrixNM<T,C,K>&) const;
+
+private:
+   T m_Cells[R][C];         // values, stored 0-based and row-wise
+};
+
+// cross product of two 3-vectors
+template <class T>
+CVectorN<T,3> CrossProduct (const CVectorN<T,3>& A, const CVectorN<T,3>& B);
+
+// =============== CVectorN definitions =====================================
+template <class T, int N>
+CVectorN<T,N>::CVectorN (T V)
+// ---------------------------------------------------------------------------
+// Function: overloaded ctor
+// Input:    initial value of all the elements
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   Set (V);
+}
+
+template <class T, int N>
+CVectorN<T,N>::CVectorN (const std::initializer_list<T>& List)
+// ---------------------------------------------------------------------------
+// Function: ctor with initial values. missing values are set to zero
+// Input:    list of values (at most N)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   if (static_cast<int>(List.size()) > N)
+      throw CArrayBase::CError (CArrayBase::VECTOR_INVALID_SIZE);
+   Set (T(0));
+   int i = 0;
+   for (const T& V : List)
+      m_Cells[i++] = V;
+}
+
+template <class T, int N>
+CVectorN<T,N>::CVectorN (const CVector<T>& A)
+// ---------------------------------------------------------------------------
+// Function: ctor from a CVector
+// Input:    vector with at least N values
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   CopyFrom (A);
+}
+
+template <class T, int N>
+void CVectorN<T,N>::CopyTo (CVector<T>& A) const
+// ---------------------------------------------------------------------------
+// Function: copies the values into a CVector
+// Input:    vector of size N
+// Output:   vector values
+// ---------------------------------------------------------------------------
+{
+   if (A.GetSize() != N)
+      throw CArrayBase::CError (CArrayBase::VECTOR_INCOMPATIBLE_VECTORS, "",
+                                A.GetSize());
+   UnrollN<N> ([&] (int i) { A(i+1) = m_Cells[i]; });
+}
+
+template <class T, int N>
+void CVectorN<T,N>::CopyFrom (const CVector<T>& A)
+// ---------------------------------------------------------------------------
+// Function: copies the first N values of a CVector
+// Input:    vector with at least N values
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   if (A.GetSize() < N)
+      throw CArrayBase::CError (CArrayBase::VECTOR_INCOMPATIBLE_VECTORS, "",
+                                A.GetSize());
+   UnrollN<N> ([&] (int i) { m_Cells[i] = A(i+1); });
+}
+
+template <class T, int N>
+T CVectorN<T,N>::TwoNorm () const
+// ---------------------------------------------------------------------------
+// Function: computes the two-norm of the vector
+// Input:    none
+// Output:   the two-norm
+// ---------------------------------------------------------------------------
+{
+   return static_cast<T>(sqrt((*this)*(*this)));
+}
+
+template <class T, int N>
+void CVectorN<T,N>::Set (T V)
+// ---------------------------------------------------------------------------
+// Function: sets all the elements to the specified value
+// Input:    specified value
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   UnrollN<N> ([&] (int i) { m_Cells[i] = V; });
+}
+
+template <class T, int N>
+inline T& CVectorN<T,N>::operator() (int nR)
+// ---------------------------------------------------------------------------
+// Function: element access (1-based)
+// Input:    index
+// Output:   value at the index
+// ---------------------------------------------------------------------------
+{
+#ifdef _DEBUG
+   if (nR <= 0 || nR > N)
+      throw CArrayBase::CError (CArrayBase::VECTOR_INDEX_OUT_OF_BOUNDS, "", nR);
+#endif
+   return m_Cells[nR-1];
+}
+
+template <class T, int N>
+inline const T& CVectorN<T,N>::operator() (int nR) const
+// ---------------------------------------------------------------------------
+// Function: element access (1-based)
+// Input:    index
+// Output:   value at the index
+// ---------------------------------------------------------------------------
+{
+#ifdef _DEBUG
+   if (nR <= 0 || nR > N)
+      throw CArrayBase::CError (CArrayBase::VECTOR_INDEX_OUT_OF_BOUNDS, "", nR);
+#endif
+   return m_Cells[nR-1];
+}
+
+template <class T, int N>
+CVectorN<T,N> CVectorN<T,N>::operator- () const
+// ---------------------------------------------------------------------------
+// Function: unary minus
+// Input:    none
+// Output:   negated vector
+// ---------------------------------------------------------------------------
+{
+   CVectorN<T,N> VR;
+   UnrollN<N> ([&] (int i) { VR.m_Cells[i] = -m_Cells[i]; });
+   return VR;
+}
+
+template <class T, int N>
+CVectorN<T,N> CVectorN<T,N>::operator+ (const CVectorN<T,N>& B) const
+// ---------------------------------------------------------------------------
+// Function: vector sum
+// Input:    right-hand vector
+// Output:   sum
+// ---------------------------------------------------------------------------
+{
+   CVectorN<T,N> VR;
+   UnrollN<N> ([&] (int i) { VR.m_Cells[i] = m_Cells[i] + B.m_Cells[i]; });
+   return VR;
+}
+
+template <class T, int N>
+CVectorN<T,N> CVectorN<T,N>::operator- (const CVectorN<T,N>& B) const
+// ---------------------------------------------------------------------------
+// Function: vector difference
+// Input:    right-hand vector
+// Output:   difference
+// ---------------------------------------------------------------------------
+{
+   CVectorN<T,N> VR;
+   UnrollN<N> ([&] (int i) { VR.m_Cells[i] = m_Cells[i] - B.m_Cells[i]; });
+   return VR;
+}
+
+template <class T, int N>
+CVectorN<T,N> CVectorN<T,N>::operator* (T c) const
+// ---------------------------------------------------------------------------
+// Function: scales the vector
+// Input:    scale factor
+// Output:   scaled vector
+// ---------------------------------------------------------------------------
+{
+   CVectorN<T,N> VR;
+   UnrollN<N> ([&] (int i) { VR.m_Cells[i] = m_Cells[i]*c; });
+   return VR;
+}
+
+template <class T, int N>
+void CVectorN<T,N>::operator+= (const CVectorN<T,N>& B)
+// ---------------------------------------------------------------------------
+// Function: adds a vector
+// Input:    right-hand vector
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   UnrollN<N> ([&] (int i) { m_Cells[i] += B.m_Cells[i]; });
+}
+
+template <class T, int N>
+void CVectorN<T,N>::operator-= (const CVectorN<T,N>& B)
+// ---------------------------------------------------------------------------
+// Function: subtracts a vector
+// Input:    right-hand vector
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   UnrollN<N> ([&] (int i) { m_Cells[i] -= B.m_Cells[i]; });
+}
+
+template <class T, int N>
+void CVectorN<T,N>::operator*= (T c)
+// ---------------------------------------------------------------------------
+// Function: scales the vector
+// Input:    scale factor
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   UnrollN<N> ([&] (int i) { m_Cells[i] *= c; });
+}
+
+template <class T, int N>
+T CVectorN<T,N>::operator* (const CVectorN<T,N>& B) const
+// ---------------------------------------------------------------------------
+// Function: dot product
+// Input:    right-hand vector
+// Output:   dot product
+// ---------------------------------------------------------------------------
+{
+   T Sum = T(0);
+   UnrollN<N> ([&] (int i) { Sum += m_Cells[i]*B.m_Cells[i]; });
+   return Sum;
+}
+
+template <class T>
+CVectorN<T,3> CrossProduct (const CVectorN<T,3>& A, const CVectorN<T,3>& B)
+// ---------------------------------------------------------------------------
+// Function: cross product A x B
+// Input:    3-vectors A and B
+// Output:   A x B
+// ---------------------------------------------------------------------------
+{
+   return CVectorN<T,3> {A(2)*B(3) - A(3)*B(2),
+                         A(3)*B(1) - A(1)*B(3),
+                         A(1)*B(2) - A(2)*B(1)};
+}
+
+// =============== CMatrixNM definitions ====================================
+template <class T, int R, int C>
+CMatrixNM<T,R,C>::CMatrixNM (T V)
+// ---------------------------------------------------------------------------
+// Function: overloaded ctor
+// Input:    initial value of all the elements
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   Set (V);
+}
+
+template <class T, int R, int C>
+CMatrixNM<T,R,C>::CMatrixNM (const std::initializer_list<T>& List)
+// ---------------------------------------------------------------------------
+// Function: ctor with initial values given row by row. missing values
+//           are set to zero
+// Input:    list of values (at most R x C)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   if (static_cast<int>(List.size()) > R*C)
+      throw CArrayBase::CError (CArrayBase::MATRIX_INVALID_SIZE);
+   Set (T(0));
+   T* pCells = data ();
+   for (const T& V : List)
+      *(pCells++) = V;
+}
+
+template <class T, int R, int C>
+CMatrixNM<T,R,C>::CMatrixNM (const CMatrix<T>& A)
+// ---------------------------------------------------------------------------
+// Function: ctor from a CMatrix
+// Input:    matrix with at least R rows and C columns
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   CopyFrom (A);
+}
+
+template <class T, int R, int C>
+void CMatrixNM<T,R,C>::CopyTo (CMatrix<T>& A) const
+// ---------------------------------------------------------------------------
+// Function: copies the values into a CMatrix
+// Input:    R x C matrix
+// Output:   matrix values
+// ---------------------------------------------------------------------------
+{
+   if (A.GetRows() != R || A.GetColumns() != C)
+      throw CArrayBase::CError (CArrayBase::MATRIX_INCOMPATIBLE_MATRICES, "",
+                                A.GetRows(), A.GetColumns());
+   UnrollN<R> ([&] (int i) {
+      UnrollN<C> ([&] (int j) { A(i+1,j+1) = m_Cells[i][j]; }); });
+}
+
+template <class T, int R, int C>
+void CMatrixNM<T,R,C>::CopyFrom (const CMatrix<T>& A)
+// ---------------------------------------------------------------------------
+// Function: copies the leading R x C block of a CMatrix
+// Input:    matrix with at least R rows and C columns
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   if (A.GetRows() < R || A.GetColumns() < C)
+      throw CArrayBase::CError (CArrayBase::MATRIX_INCOMPATIBLE_MATRICES, "",
+                                A.GetRows(), A.GetColumns());
+   UnrollN<R> ([&] (int i) {
+      UnrollN<C> ([&] (int j) { m_Cells[i][j] = A(i+1,j+1); }); });
+}
+
+template <class T, int R, int C>
+CMatrixNM<T,C,R> CMatrixNM<T,R,C>::Tr () const
+// ---------------------------------------------------------------------------
+// Function: computes the transpose
+// Input:    none
+// Output:   transpose
+// ---------------------------------------------------------------------------
+{
+   CMatrixNM<T,C,R> MR;
+   UnrollN<R> ([&] (int i) {
+      UnrollN<C> ([&] (int j) { MR(j+1,i+1) = m_Cells[i][j]; }); });
+   return MR;
+}
+
+template <class T, int R, int C>
+T CMatrixNM<T,R,C>::Determinant () const
+// ---------------------------------------------------------------------------
+// Function: computes the determinant of a square matrix (up to 3 x 3)
+// Input:    none
+// Output:   determinant
+// ---------------------------------------------------------------------------
+{
+   static_assert (R == C && R <= 3, "CMatrixNM::Determinant: 1x1 to 3x3 only");
+   const auto& A = m_Cells;
+   if constexpr (R == 1)
+      return A[0][0];
+   else if constexpr (R == 2)
+      return A[0][0]*A[1][1] - A[0][1]*A[1][0];
+   else
+      return A[0][0]*(A[1][1]*A[2][2] - A[1][2]*A[2][1])
+           - A[0][1]*(A[1][0]*A[2][2] - A[1][2]*A[2][0])
+           + A[0][2]*(A[1][0]*A[2][1] - A[1][1]*A[2][0]);
+}
+
+template <class T, int R, int C>
+bool CMatrixNM<T,R,C>::Inverse (CMatrixNM<T,R,C>& AI) const
+// ---------------------------------------------------------------------------
+// Function: computes the inverse of a square matrix (up to 3 x 3) from
+//           its adjugate
+// Input:    matrix to hold the inverse
+// Output:   inverse; returns false if the matrix is singular
+// ---------------------------------------------------------------------------
+{
+   static_assert (R == C && R <= 3, "CMatrixNM::Inverse: 1x1 to 3x3 only");
+   T Det = Determinant ();
+   if (Det == T(0))
+      return false;
+   const auto& A = m_Cells;
+   if constexpr (R == 1)
+      AI(1,1) = T(1);
+   else if constexpr (R == 2)
+   {
+      AI(1,1) =  A[1][1]; AI(1,2) = -A[0][1];
+      AI(2,1) = -A[1][0]; AI(2,2) =  A[0][0];
+   }
+   else
+   {
+      AI(1,1) = A[1][1]*A[2][2] - A[1][2]*A[2][1];
+      AI(1,2) = A[0][2]*A[2][1] - A[0][1]*A[2][2];
+      AI(1,3) = A[0][1]*A[1][2] - A[0][2]*A[1][1];
+      AI(2,1) = A[1][2]*A[2][0] - A[1][0]*A[2][2];
+      AI(2,2) = A[0][0]*A[2][2] - A[0][2]*A[2][0];
+      AI(2,3) = A[0][2]*A[1][0] - A[0][0]*A[1][2];
+      AI(3,1) = A[1][0]*A[2][1] - A[1][1]*A[2][0];
+      AI(3,2) = A[0][1]*A[2][0] - A[0][0]*A[2][1];
+      AI(3,3) = A[0][0]*A[1][1] - A[0][1]*A[1][0];
+   }
+   AI *= T(1)/Det;
+   return true;
+}
+
+template <class T, int R, int C>
+bool CMatrixNM<T,R,C>::Solve (const CVectorN<T,R>& b, CVectorN<T,C>& x) const
+// ---------------------------------------------------------------------------
+// Function: solves A x = b for a square matrix (up to 3 x 3)
+// Input:    right-hand side b, vector to hold x
+// Output:   x; returns false if the matrix is singular
+// ---------------------------------------------------------------------------
+{
+   CMatrixNM<T,R,C> AI;
+   if (!Inverse (AI))
+      return false;
+   x = AI*b;
+   return true;
+}
+
+template <class T, int R, int C>
+void CMatrixNM<T,R,C>::Set (T V)
+// ---------------------------------------------------------------------------
+// Function: sets all the elements to the specified value
+// Input:    specified value
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   T* pCells = data ();
+   UnrollN<R*C> ([&] (int i) { pCells[i] = V; });
+}
+
+template <class T, int R, int C>
+inline T& CMatrixNM<T,R,C>::operator() (int nR, int nC)
+// ---------------------------------------------------------------------------
+// Function: element access (1-based)
+// Input:    row and column
+// Output:   value at the location
+// ---------------------------------------------------------------------------
+{
+#ifdef _DEBUG
+   if (nR <= 0 || nR > R || nC <= 0 || nC > C)
+      throw CArrayBase::CError (CArrayBase::MATRIX_INDEX_OUT_OF_BOUNDS, "",
+                                nR, nC);
+#endif
+   return m_Cells[nR-1][nC-1];
+}
+
+template <class T, int R, int C>
+inline const T& CMatrixNM<T,R,C>::operator() (int nR, int nC) const
+// ---------------------------------------------------------------------------
+// Function: element access (1-based)
+// Input:    row and column
+// Output:   value at the location
+// ---------------------------------------------------------------------------
+{
+#ifdef _DEBUG
+   if (nR <= 0 || nR > R || nC <= 0 || nC > C)
+      throw CArrayBase::CError (CArrayBase::MATRIX_INDEX_OUT_OF_BOUNDS, "",
+                                nR, nC);
+#endif
+   return m_Cells[nR-1][nC-1];
+}
+
+template <class T, int R, int C>
+CMatrixNM<T,R,C> CMatrixNM<T,R,C>::operator+ (const CMatrixNM<T,R,C>& B) const
+// ---------------------------------------------------------------------------
+// Function: matrix sum
+// Input:    right-hand matrix
+// Output:   sum
+// ---------------------------------------------------------------------------
+{
+   CMatrixNM<T,R,C> MR(*this);
+   MR += B;
+   return MR;
+}
+
+template <class T, int R, int C>
+CMatrixNM<T,R,C> CMatrixNM<T,R,C>::operator- (const CMatrixNM<T,R,C>& B) const
+// ---------------------------------------------------------------------------
+// Function: matrix difference
+// Input:    right-hand matrix
+// Output:   difference
+// ---------------------------------------------------------------------------
+{
+   CMatrixNM<T,R,C> MR(*this);
+   MR -= B;
+   return MR;
+}
+
+template <class T, int R, int C>
+CMatrixNM<T,R,C> CMatrixNM<T,R,C>::operator* (T c) const
+// ---------------------------------------------------------------------------
+// Function: scales the matrix
+// Input:    scale factor
+// Output:   scaled matrix
+// ---------------------------------------------------------------------------
+{
+   CMatrixNM<T,R,C> MR(*this);
+   MR *= c;
+   return MR;
+}
+
+template <class T, int R, int C>
+void CMatrixNM<T,R,C>::operator+= (const CMatrixNM<T,R,C>& B)
+// ---------------------------------------------------------------------------
+// Function: adds a matrix
+// Input:    right-hand matrix
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   T* pCells = data ();
+   const T* pB = B.data ();
+   UnrollN<R*C> ([&] (int i) { pCells[i] += pB[i]; });
+}
+
+template <class T, int R, int C>
+void CMatrixNM<T,R,C>::operator-= (const CMatrixNM<T,R,C>& B)
+// ---------------------------------------------------------------------------
+// Function: subtracts a matrix
+// Input:    right-hand matrix
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   T* pCells = data ();
+   const T* pB = B.data ();
+   UnrollN<R*C> ([&] (int i) { pCells[i] -= pB[i]; });
+}
+
+template <class T, int R, int C>
+void CMatrixNM<T,R,C>::operator*= (T c)
+// ---------------------------------------------------------------------------
+// Function: scales the matrix
+// Input:    scale factor
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   T* pCells = data ();
+   UnrollN<R*C> ([&] (int i) { pCells[i] *= c; });
+}
+
+template <class T, int R, int C>
+CVectorN<T,R> CMatrixNM<T,R,C>::operator* (const CVectorN<T,C>& x) const
+// ---------------------------------------------------------------------------
+// Function: matrix-vector product
+// Input:    vector x
+// Output:   A x
+// ---------------------------------------------------------------------------
+{
+   CVectorN<T,R> VR;
+   UnrollN<R> ([&] (int i) {
+      T Sum = T(0);
+      UnrollN<C> ([&] (int j) { Sum += m_Cells[i][j]*x(j+1); });
+      VR(i+1) = Sum; });
+   return VR;
+}
+
+template <class T, int R, int C>
+template <int K>
+CMatrixNM<T,R,K> CMatrixNM<T,R,C>::operator* (const CMatrixNM<T,C,K>& B) const
+// ---------------------------------------------------------------------------
+// Function: matrix-matrix product
+// Input:    right-hand matrix
+// Output:   A B
+// ---------------------------------------------------------------------------
+{
+   CMatrixNM<T,R,K> MR;
+   UnrollN<R> ([&] (int i) {
+      UnrollN<K> ([&] (int k) {
+         T Sum = T(0);
+         UnrollN<C> ([&] (int j) { Sum += m_Cells[i][j]*B(j+1,k+1); });
+         MR(i+1,k+1) = Sum; }); });
+   return MR;
+}
@@ -11,6 +11,15 @@
 // n is the number of columns in the matrix + 1. Note that the first location may have garbage
 // value since the first location is unused.
 // Similarly,  type nameofmatrix.m_pCells[2], n to view the entire second row of the matrix.
+// ---------------------------------------------------------------------------------------------------
+// Storage:
+// The cells live in one block, row after row. Consecutive rows are stride()
+// cells apart; stride() equals the # of columns unless the matrix was sized
+// with SetPaddedSize, which pads each row to a whole number of cache lines.
+// For plain element types the block is cache-line aligned, so with padding
+// every row starts on a cache line. data() and row() give 0-based raw access
+// for kernels that stream over rows; padding cells are not part of the
+// matrix and hold unspecified values.
 // **************************************************
 #pragma once
 
@@ -60,12 +69,19 @@ public:
    // used with the default constructor
    void SetSize (int, int, T);                  // sets the size of the matrix and initial value
    // and initial value
+   void SetPaddedSize (int, int);               // sets the size of the matrix with
+                                                // cache-line padded rows
 
    // ------------------
    // helper functions
    // ------------------
    int GetRows () const;              // gets the current number of rows
    int GetColumns () const;           // gets the current number of columns
+   T*       data ();                  // first cell of row 1 (0-based raw access)
+   const T* data () const;            // first cell of row 1 (0-based raw access)
+   int      stride () const;          // # of cells from one row to the next
+   T*       row (int);                // cells of row i, i = 0..rows-1 (0-based)
+   const T* row (int) const;          // cells of row i, i = 0..rows-1 (0-based)
    void GetName (std::string&) const; // gets the matrix name
    void Display (std::ostream& OF,
                  const std::string& strMessage) const;
@@ -114,13 +130,19 @@ public:
    CMatrix<T>  Tr ();       // computes the transpose 
    T           MaxNorm ();  // computes the max norm
 
+   static const size_t CACHELINE = 64;  // alignment of the cells (bytes)
+
 private:
    const int NUMPERROW = 6; // # of matrix elements to display per row/column
    std::string m_strName;   // matrix identifier
    T   **m_pCells;          // address where the matrix of
                             // type T is stored
+   bool m_bArena;           // row table and cells were drawn from an arena
    int m_nRows;             // number of rows in the matrix
    int m_nColumns;          // number of columns in the matrix
+   int m_nStride;           // number of cells from one row to the next
+   void Allocate (int, int, int);  // allocates rows with the given stride
+   size_t GetCellBytes () const;   // size of the cell block
    void Release ();         // similar to destructor
    void Initialize ();      // initialized values
    inline T GetTolerance () const; // tolerance for bool checks
@@ -129,7 +151,7 @@ private:
                           CVector<T>& x,
                           CVector<T>& b,
                           T TOL);
-   void ErrorHandler (ERRORVM) const;
+   void ErrorHandler (ERRORVM, long nR = 0, long nC = 0) const;
 };
 
 // =============== definitions ===========================================
@@ -155,6 +177,8 @@ void CMatrix<T>::Initialize ()
    m_pCells = nullptr;
    m_nRows = 0;
    m_nColumns = 0;
+   m_nStride = 0;
+   m_bArena = false;
 }
 
 template <class T>
@@ -203,10 +227,10 @@ CMatrix<T>::CMatrix (const CMatrix<T>& A)
 // ---------------------------------------------------------------------------
 {
    if (A.m_nRows <= 0 || A.m_nColumns <= 0)
-      ErrorHandler (MATRIX_INVALID_SIZE);
+      ErrorHandler (MATRIX_INVALID_SIZE, A.m_nRows, A.m_nColumns);
    Initialize();
    m_strName = A.m_strName;
-   SetSize (A.m_nRows, A.m_nColumns);
+   Allocate (A.m_nRows, A.m_nColumns, A.m_nStride);
    for (int i=1; i <= m_nRows; i++)
    {
       for (int j=1; j <= m_nColumns; j++)
@@ -229,6 +253,8 @@ CMatrix<T>::CMatrix (CMatrix<T>&& A)
    m_pCells = A.m_pCells;
    m_nRows = A.m_nRows;
    m_nColumns = A.m_nColumns;
+   m_nStride = A.m_nStride;
+   m_bArena = A.m_bArena;
    m_strName = A.m_strName;
 
    // release the data pointer from the source object so that
@@ -236,6 +262,7 @@ CMatrix<T>::CMatrix (CMatrix<T>&& A)
    A.m_pCells = nullptr;
    A.m_nRows = 0;
    A.m_nColumns = 0;
+   A.m_nStride = 0;
 }
 #endif
 
@@ -280,44 +307,120 @@ void CMatrix<T>::SetSize (int nR, int nC)
 // Input:    matrix size (# of rows and columns)
 // Output:   none
 // ---------------------------------------------------------------------------
+{
+   Allocate (nR, nC, nC);
+}
+
+template <class T>
+void CMatrix<T>::SetPaddedSize (int nR, int nC)
+// ---------------------------------------------------------------------------
+// Function: dynamically allocates memory with each row padded to a whole
+//           number of cache lines (when a cache line holds a whole number
+//           of cells) so that every row starts on a cache line
+// Input:    matrix size (# of rows and columns)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+   int nStride = nC;
+   if (CACHELINE % sizeof(T) == 0)
+   {
+      const int nLine = static_cast<int>(CACHELINE/sizeof(T));
+      nStride = ((nC + nLine - 1)/nLine)*nLine;
+   }
+   Allocate (nR, nC, nStride);
+}
+
+template <class T>
+void CMatrix<T>::Allocate (int nR, int nC, int nStride)
+// ---------------------------------------------------------------------------
+// Function: dynamically allocates memory. row i (1-based) starts nStride
+//           cells after row i-1. for plain element types the first row
+//           starts on a cache line and the block ahead of it holds the
+//           unused cell m_pCells[1][0]
+// Input:    matrix size (# of rows and columns), row stride (>= nC)
+// Output:   none
+// ---------------------------------------------------------------------------
 {
    // do nothing if the current size is the same as the requested size
-   if (nR == m_nRows && nC == m_nColumns)
+   if (nR == m_nRows && nC == m_nColumns && nStride == m_nStride)
       return;
 
-   m_ValueR = nR; m_ValueC = nC;
    // check whether nR and nC are legal
    if (nR <= 0 || nC <= 0)
    {
-      ErrorHandler (MATRIX_INVALID_SIZE);
-      m_nRows = m_nColumns = 0;
+      ErrorHandler (MATRIX_INVALID_SIZE, nR, nC);
+      m_nRows = m_nColumns = m_nStride = 0;
       return;
    }
    Release ();
-   size_t size = nR*nC + 1;
+   m_nRows = nR;
+   m_nColumns = nC;
+   m_nStride = nStride;
    try
    {
-      m_pCells = new T*[nR + 1];
+      if constexpr (IsPlain<T>())
+         m_pCells = static_cast<T**>(AllocateCells (sizeof(T*)*(nR+1),
+                                                    alignof(T*), m_bArena));
+      else
+         m_pCells = new T*[nR + 1];
    }
    catch (std::bad_alloc)
    {
-      ErrorHandler (MATRIX_ALLOCATION_ERROR);
+      m_nRows = m_nColumns = m_nStride = 0;
+      ErrorHandler (MATRIX_ALLOCATION_ERROR, nR, nC);
    }
+   T* pFirst = nullptr;   // first cell of row 1
    try
    {
-      m_pCells[0] = new T[size];
+      // same source as the row table (the thread's arena or the heap)
+      if constexpr (IsPlain<T>())
+      {
+         unsigned char* pBlock = static_cast<unsigned char*>(
+             AllocateCells (GetCellBytes (), CACHELINE, m_bArena));
+         m_pCells[0] = reinterpret_cast<T*>(pBlock);
+         pFirst = reinterpret_cast<T*>(pBlock + GetCellBytes () -
+                                       sizeof(T)*nR*nStride);
+      }
+      else
+      {
+         m_pCells[0] = new T[nR*nStride + 1];
+         pFirst = m_pCells[0] + 1;
+      }
    }
    catch (std::bad_alloc)
    {
-      ErrorHandler (MATRIX_ALLOCATION_ERROR);
+      if constexpr (IsPlain<T>())
+         FreeCells (m_pCells, alignof(T*), m_bArena);
+      else
+         delete [] m_pCells;
+      m_pCells = nullptr;
+      m_nRows = m_nColumns = m_nStride = 0;
+      ErrorHandler (MATRIX_ALLOCATION_ERROR, nR, nC);
    }
-   m_pCells[1] = m_pCells[0];
-   for (int i=2; i <= nR; i++)
-      m_pCells[i] = m_pCells[i-1]+nC;
-   m_nRows = nR;
-   m_nColumns = nC;
-   m_dAllocated += static_cast<double>(sizeof(T*)*(nR+1));
-   m_dAllocated += static_cast<double>(sizeof(T)*size);
+   for (int i=1; i <= nR; i++)
+      m_pCells[i] = pFirst + (i-1)*nStride - 1;
+   Count (m_Counters.dAllocated, static_cast<double>(sizeof(T*)*(nR+1)));
+   Count (m_Counters.dAllocated, static_cast<double>(GetCellBytes ()));
+}
+
+template <class T>
+size_t CMatrix<T>::GetCellBytes () const
+// ---------------------------------------------------------------------------
+// Function: size of the cell block for the current size and stride. for
+//           plain element types the rows are preceded by a whole number of
+//           cache lines holding the unused cell
+// Input:    none
+// Output:   returns the # of bytes
+// ---------------------------------------------------------------------------
+{
+   const size_t nCells = static_cast<size_t>(m_nRows)*m_nStride;
+   if constexpr (IsPlain<T>())
+   {
+      const size_t nLead = ((sizeof(T) + CACHELINE - 1)/CACHELINE)*CACHELINE;
+      return nLead + sizeof(T)*nCells;
+   }
+   else
+      return sizeof(T)*(nCells + 1);
 }
 
 template <class T>
@@ -347,14 +450,14 @@ CMatrix<T>::~CMatrix ()
    {
       delete [] m_pCells[0];
       m_pCells[0] = nullptr;
-      m_dDeAllocated += static_cast<double>(sizeof(T*)*(m_nRows+1));
+      Count (m_Counters.dDeAllocated, static_cast<double>(sizeof(T*)*(m_nRows+1)));
    }
    if (m_pCells != nullptr)
    {
       delete [] m_pCells;
       m_pCells = nullptr;
       size_t nSize = m_nRows*m_nColumns+1;
-      m_dDeAllocated += static_cast<double>(sizeof(T)*nSize);
+      Count (m_Counters.dDeAllocated, static_cast<double>(sizeof(T)*nSize));
    }
    m_nRows = 0;
    m_nColumns = 0;
@@ -372,18 +475,24 @@ void CMatrix<T>::Release ()
    // deallocate storage
    if (m_pCells != nullptr)
    {
-      delete [] m_pCells[0];
-      m_dDeAllocated += static_cast<double>(sizeof(T*)*(m_nRows+1));
+      if constexpr (IsPlain<T>())
+         FreeCells (m_pCells[0], CACHELINE, m_bArena);
+      else
+         delete [] m_pCells[0];
+      Count (m_Counters.dDeAllocated, static_cast<double>(GetCellBytes ()));
    }
    if (m_pCells != nullptr)
    {
-      delete [] m_pCells;
-      size_t nSize = m_nRows*m_nColumns+1;
-      m_dDeAllocated += static_cast<double>(sizeof(T)*nSize);
+      if constexpr (IsPlain<T>())
+         FreeCells (m_pCells, alignof(T*), m_bArena);
+      else
+         delete [] m_pCells;
+      Count (m_Counters.dDeAllocated, static_cast<double>(sizeof(T*)*(m_nRows+1)));
    }
    m_pCells = nullptr;
    m_nRows = 0;
    m_nColumns = 0;
+   m_nStride = 0;
 }
 
 // ----------------------------
@@ -452,6 +561,73 @@ int CMatrix<T>::GetColumns () const
    return (m_nColumns);
 }
 
+template <class T>
+T* CMatrix<T>::data ()
+// ---------------------------------------------------------------------------
+// Function: gets the first cell of the matrix. cell (i,j) (0-based) is at
+//           data()[i*stride()+j]
+// Input:    none
+// Output:   address of the first cell (nullptr if not sized)
+// ---------------------------------------------------------------------------
+{
+   return (m_pCells != nullptr ? m_pCells[1] + 1 : nullptr);
+}
+
+template <class T>
+const T* CMatrix<T>::data () const
+// ---------------------------------------------------------------------------
+// Function: gets the first cell of the matrix. cell (i,j) (0-based) is at
+//           data()[i*stride()+j]
+// Input:    none
+// Output:   address of the first cell (nullptr if not sized)
+// ---------------------------------------------------------------------------
+{
+   return (m_pCells != nullptr ? m_pCells[1] + 1 : nullptr);
+}
+
+template <class T>
+int CMatrix<T>::stride () const
+// ---------------------------------------------------------------------------
+// Function: gets the # of cells from the start of one row to the next
+// Input:    none
+// Output:   row stride (>= # of columns)
+// ---------------------------------------------------------------------------
+{
+   return (m_nStride);
+}
+
+template <class T>
+T* CMatrix<T>::row (int nR)
+// ---------------------------------------------------------------------------
+// Function: gets the cells of a row for 0-based access. bound checking
+//           is done only for the row index
+// Input:    row index (0-based)
+// Output:   address of the first cell of the row
+// ---------------------------------------------------------------------------
+{
+#ifdef _DEBUG
+   if (nR < 0 || nR >= m_nRows)
+      ErrorHandler (MATRIX_INDEX_OUT_OF_BOUNDS, nR+1);
+#endif
+   return m_pCells[nR+1] + 1;
+}
+
+template <class T>
+const T* CMatrix<T>::row (int nR) const
+// ---------------------------------------------------------------------------
+// Function: gets the cells of a row for 0-based access. bound checking
+//           is done only for the row index
+// Input:    row index (0-based)
+// Output:   address of the first cell of the row
+// ---------------------------------------------------------------------------
+{
+#ifdef _DEBUG
+   if (nR < 0 || nR >= m_nRows)
+      ErrorHandler (MATRIX_INDEX_OUT_OF_BOUNDS, nR+1);
+#endif
+   return m_pCells[nR+1] + 1;
+}
+
 template <class T>
 void CMatrix<T>::Set (T dV)
 // ---------------------------------------------------------------------------
@@ -619,8 +795,7 @@ T& CMatrix<T>::operator() (int nR, int nC)
 #ifdef _DEBUG
    if (nR <= 0 || nR > m_nRows || nC <= 0 || nC > m_nColumns)
    {
-      m_ValueR = nR; m_ValueC = nC;
-      ErrorHandler (MATRIX_INDEX_OUT_OF_BOUNDS);
+      ErrorHandler (MATRIX_INDEX_OUT_OF_BOUNDS, nR, nC);
       return m_pCells[0][0];
    }
    else
@@ -642,8 +817,7 @@ const T& CMatrix<T>::operator() (int nR, int nC) const
 #ifdef _DEBUG
    if (nR <= 0 || nR > m_nRows || nC <= 0 || nC > m_nColumns)
    {
-       m_ValueR = nR; m_ValueC = nC;
-       ErrorHandler (MATRIX_INDEX_OUT_OF_BOUNDS);
+       ErrorHandler (MATRIX_INDEX_OUT_OF_BOUNDS, nR, nC);
        return m_pCells[0][0];
    }
    else
@@ -667,8 +841,8 @@ T& CMatrix<T>::operator= (const CMatrix& matarg)
       // compatible matrices?
       if (m_nRows != matarg.m_nRows || m_nColumns != matarg.m_nColumns)
       {
-         m_ValueR = matarg.m_nRows; m_ValueC = matarg.m_nColumns;
-         ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+         ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, matarg.m_nRows,
+                       matarg.m_nColumns);
          return (T&)(*this);
       }
       // now copy
@@ -699,8 +873,7 @@ CMatrix<T>& CMatrix<T>::operator= (CMatrix&& A)
       // compatible matrices?
       if (m_nRows != A.m_nRows || m_nColumns != A.m_nColumns)
       {
-         m_ValueR = A.m_nRows; m_ValueC = A.m_nColumns;
-         ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+         ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, A.m_nRows, A.m_nColumns);
          return (*this);
       }
       // free the existing resource
@@ -710,12 +883,14 @@ CMatrix<T>& CMatrix<T>::operator= (CMatrix&& A)
       m_pCells = A.m_pCells;
       m_nRows = A.GetRows();
       m_nColumns = A.GetColumns();
+      m_nStride = A.m_nStride;
+      m_bArena = A.m_bArena;
       m_strName = A.m_strName;
 
       // release the data pointer from the source object so that
       // the destructor does not free the memory multiple times
       A.m_pCells = nullptr;
-      A.m_nRows = A.m_nColumns = 0;
+      A.m_nRows = A.m_nColumns = A.m_nStride = 0;
    }
 
    return *this;
@@ -733,8 +908,8 @@ bool CMatrix<T>::operator== (const CMatrix<T>& MRight)
    // compatible matrices?
    if (m_nRows != MRight.m_nRows || m_nColumns != MRight.m_nColumns)
    {
-      m_ValueR = MRight.m_nRows; m_ValueC = MRight.m_nColumns;
-      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, MRight.m_nRows,
+                    MRight.m_nColumns);
       return false;
    }
 
@@ -760,8 +935,8 @@ bool CMatrix<T>::operator!= (const CMatrix<T>& MRight)
    // compatible matrices?
    if (m_nRows != MRight.m_nRows || m_nColumns != MRight.m_nColumns)
    {
-      m_ValueR = MRight.m_nRows; m_ValueC = MRight.m_nColumns;
-      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, MRight.m_nRows,
+                    MRight.m_nColumns);
       return false;
    }
 
@@ -787,8 +962,8 @@ CMatrix<T> CMatrix<T>::operator+ (const CMatrix& MRight) const
    // compatible matrices?
    if (m_nRows != MRight.m_nRows || m_nColumns != MRight.m_nColumns)
    {
-      m_ValueR = MRight.m_nRows; m_ValueC = MRight.m_nColumns;
-      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, MRight.m_nRows,
+                    MRight.m_nColumns);
       return MRight;
    }
 
@@ -833,8 +1008,8 @@ void CMatrix<T>::operator+= (const CMatrix& MRight)
    if (m_nRows != MRight.m_nRows ||
        m_nColumns != MRight.m_nColumns)
    {
-      m_ValueR = MRight.m_nRows; m_ValueC = MRight.m_nColumns;
-      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, MRight.m_nRows,
+                    MRight.m_nColumns);
       return;
    }
    // now add
@@ -856,8 +1031,8 @@ CMatrix<T> CMatrix<T>::operator- (const CMatrix& MRight) const
    // compatible vectors?
    if (m_nRows != MRight.m_nRows || m_nColumns != MRight.m_nColumns)
    {
-      m_ValueR = MRight.m_nRows; m_ValueC = MRight.m_nColumns;
-      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, MRight.m_nRows,
+                    MRight.m_nColumns);
       return MRight;
    }
 
@@ -923,8 +1098,8 @@ void CMatrix<T>::operator-= (const CMatrix& MRight)
    if (m_nRows != MRight.m_nRows ||
          m_nColumns != MRight.m_nColumns)
    {
-      m_ValueR = MRight.m_nRows; m_ValueC = MRight.m_nColumns;
-      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+      ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, MRight.m_nRows,
+                    MRight.m_nColumns);
       return;
    }
    // now subtract
@@ -1045,21 +1220,22 @@ CMatrix<T> operator* (const CMatrix<T>& A,
    C.Set(zero);
    if (nColsA != nRowsB)
    {
-      CArrayBase::m_ValueR = nColsA; CArrayBase::m_ValueC = nRowsB;
-      throw CArrayBase::MATRIX_INCOMPATIBLE_MATRICES;
+      throw CArrayBase::CError (CArrayBase::MATRIX_INCOMPATIBLE_MATRICES,
+                                "", nColsA, nRowsB);
       return C;
    }
 
-   for (int i=1; i <= nRowsA; i++)
+   // row i of C accumulates a(i,k) times row k of B
+   for (int i=0; i < nRowsA; i++)
    {
-      for (int j=1; j <= nColsB; j++)
+      const T* pA = A.row(i);
+      T* pC = C.row(i);
+      for (int k=0; k < nColsA; k++)
       {
-         T sum = zero;
-         for (int k=1; k <= nColsA; k++)
-         {
-            sum += A(i,k)*B(k,j);
-         }
-         C(i,j) = sum;
+         const T aik = pA[k];
+         const T* pB = B.row(k);
+         for (int j=0; j < nColsB; j++)
+            pC[j] += aik*pB[j];
       }
    }
    return C;
@@ -1084,19 +1260,21 @@ CVector<TT> operator* (const CMatrix<TT>& A,
    c.Set(zero);
    if (nColsA != nRowsB)
    {
-      CArrayBase::m_ValueR = nColsA; CArrayBase::m_ValueC = nRowsB;
-      throw (CArrayBase::MATRIX_INCOMPATIBLE_MATRICES);
+      throw CArrayBase::CError (CArrayBase::MATRIX_INCOMPATIBLE_MATRICES,
+                                "", nColsA, nRowsB);
       return c;
    }
 
-   for (int i = 1; i <= nRowsA; i++)
+   const TT* pb = &b(1);
+   for (int i = 0; i < nRowsA; i++)
    {
+      const TT* pA = A.row(i);
       TT sum = zero;
-      for (int j = 1; j <= nColsA; j++)
+      for (int j = 0; j < nColsA; j++)
       {
-         sum += A(i, j)*b(j);
+         sum += pA[j]*pb[j];
       }
-      c(i) = sum;
+      c(i+1) = sum;
    }
 
    return c;
@@ -1198,8 +1376,7 @@ void CMatrix<T>::GaussElimination (CMatrix<T>& A,
    // check problem data
    if (A.GetColumns() != n || x.GetSize() != n || b.GetSize() != n)
    {
-       m_ValueR = A.GetRows(); m_ValueC = A.GetColumns(); 
-       ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES);
+       ErrorHandler (MATRIX_INCOMPATIBLE_MATRICES, A.GetRows(), A.GetColumns());
    }
 
    int i, j, k;   // loop indices
@@ -1213,8 +1390,7 @@ void CMatrix<T>::GaussElimination (CMatrix<T>& A,
    {
       if (fabs(A(k,k)) <= TOL)           // Step 2
       {
-         m_ValueR = k;
-         ErrorHandler (MATRIX_DEPENDENT_EQUATIONS);
+         ErrorHandler (MATRIX_DEPENDENT_EQUATIONS, k);
       }
       for (i=k+1; i <= n; i++)           // Step 3
       {
@@ -1229,8 +1405,7 @@ void CMatrix<T>::GaussElimination (CMatrix<T>& A,
    // back substitution
    if (fabs(A(n,n)) <= TOL)
    {
-       m_ValueR = n;
-       ErrorHandler (MATRIX_DEPENDENT_EQUATIONS);
+       ErrorHandler (MATRIX_DEPENDENT_EQUATIONS, n);
    }
    x(n) /= A(n,n);                       // Step 11
 
@@ -1245,13 +1420,14 @@ void CMatrix<T>::GaussElimination (CMatrix<T>& A,
 
 // ==================== Error Handler ========================
 template <class T>
-void CMatrix<T>::ErrorHandler (ERRORVM ErrorCode) const
+void CMatrix<T>::ErrorHandler (ERRORVM ErrorCode, long nR, long nC) const
 // ---------------------------------------------------------------------------
-// Function: channels error message to base class
+// Function: throws the error with the matrix name and the row and column
+//           (index or size) involved
 //           place a breakpoint here to detect the source of error
-// Input:    error code
+// Input:    error code, row, column
 // Output:   none
 // ---------------------------------------------------------------------------
 {
-   throw ErrorCode;
+   throw CError (ErrorCode, m_strName, nR, nC);
 }
@@ -7,6 +7,7 @@ Object-Oriented Numerical Analysis
 *********************************************/
 #include <iostream>
 #include <cctype>
+#include <charconv>
 #include "parserEXH.h"
 
 CParser::CParser ()
@@ -19,6 +20,9 @@ CParser::CParser ()
     m_strDelimiter = ", ";
     m_strComment = "$";
     m_bLowerCase = false;
+    m_nPos = 0;
+    for (int i = 0; i < 256; i++)
+        m_bDelimiter[i] = false;
 }
 
 CParser::CParser (const std::string& strDelimiter,
@@ -35,6 +39,9 @@ CParser::CParser (const std::string& strDelimiter,
     if (strComment.empty())
         throw Error::INVALIDCOMMENT;
     SetTraits (strDelimiter, strComment, bLowerCase);
+    m_nPos = 0;
+    for (int i = 0; i < 256; i++)
+        m_bDelimiter[i] = false;
 }
 
 CParser::~CParser ()
@@ -92,7 +99,7 @@ void CParser::ReadNextLine (std::ifstream& FileInput, int& nLineNum,
 // Restriction: Cannot read a line over 256 characters
 // ---------------------------------------------------------------------------
 {
-    static char szInp[MAXCHARSPARSER+1];
+    char szInp[MAXCHARSPARSER+1];
 
     // enough capacity to read and store?
     if (MAXCHARS > MAXCHARSPARSER)
@@ -158,7 +165,7 @@ void CParser::GetTokens (std::ifstream& IFile, int& nLineNumber,
 // Output:   vector containing the tokens, number of tokens
 // ---------------------------------------------------------------------------
 {
-    static char szEntireLine[MAXCHARSPARSER+1];
+    char szEntireLine[MAXCHARSPARSER+1];
 
     // comment character(s)
     int nCLen = static_cast<int>(strComment.length());
@@ -231,6 +238,160 @@ void CParser::GetTokens (std::ifstream& IFile, int& nLineNumber,
     }
 }
 
+void CParser::LoadBuffer (std::istream& IFile, bool bLowerCase)
+// ---------------------------------------------------------------------------
+// Function: reads the rest of a stream into the parser's buffer for
+//           buffered tokenizing. the stream is read in blocks, so it need
+//           not be seekable (pipes, decompressors)
+// Input:    istream object, lowercase conversion option
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    const size_t BLOCKSIZE = 65536;
+
+    m_strBuffer.clear ();
+    for (;;)
+    {
+        size_t nOld = m_strBuffer.size();
+        m_strBuffer.resize (nOld + BLOCKSIZE);
+        IFile.read (&m_strBuffer[nOld], static_cast<std::streamsize>(BLOCKSIZE));
+        m_strBuffer.resize (nOld + static_cast<size_t>(IFile.gcount()));
+        if (!IFile)
+            break;
+    }
+    if (IFile.bad())
+        throw Error::UNABLETOREAD;
+
+    // convert to lower case?
+    if (bLowerCase)
+    {
+        for (size_t i = 0; i < m_strBuffer.length(); i++)
+            m_strBuffer[i] = static_cast<char>(std::tolower (
+                             static_cast<unsigned char>(m_strBuffer[i])));
+    }
+    SetBuffer (m_strBuffer);
+}
+
+void CParser::SetBuffer (std::string_view strvBuffer)
+// ---------------------------------------------------------------------------
+// Function: sets the span to tokenize (e.g. a memory-mapped file). the
+//           span must stay valid while its tokens are in use
+// Input:    input span
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_strvInput = strvBuffer;
+    m_nPos = 0;
+}
+
+void CParser::GetTokens (int& nLineNumber,
+                         std::vector<std::string_view>& strvVTokens,
+                         int& nTokens, const std::string& strDelimiters,
+                         const std::string& strComment, bool& bEOF)
+// ---------------------------------------------------------------------------
+// Function: parses the next line of the buffer into distinct tokens based
+//           on the specified delimiter(s), skipping comment and blank
+//           lines. the tokens point into the buffer, so no line is copied
+//           and there is no limit on the line length
+// Input:    delimiters, comment character(s)
+// Output:   vector containing the tokens, number of tokens
+// ---------------------------------------------------------------------------
+{
+    // delimiter lookup table
+    if (strDelimiters != m_strTableDelimiters)
+    {
+        for (int i = 0; i < 256; i++)
+            m_bDelimiter[i] = false;
+        for (size_t i = 0; i < strDelimiters.length(); i++)
+            m_bDelimiter[static_cast<unsigned char>(strDelimiters[i])] = true;
+        m_strTableDelimiters = strDelimiters;
+    }
+    auto IsDelimiter = [this] (char c)
+    {
+        return m_bDelimiter[static_cast<unsigned char>(c)];
+    };
+
+    bEOF = false;
+    nTokens = 0;
+    for (;;)
+    {
+        if (m_nPos >= m_strvInput.length())
+            throw Error::UNABLETOREAD;
+
+        // next line (without the line terminator)
+        ++nLineNumber;
+        size_t nEnd = m_strvInput.find ('\n', m_nPos);
+        if (nEnd == std::string_view::npos)
+            nEnd = m_strvInput.length();
+        std::string_view strvLine = m_strvInput.substr (m_nPos, nEnd - m_nPos);
+        m_nPos = nEnd + 1;
+        if (m_nPos >= m_strvInput.length())
+            bEOF = true;
+        if (!strvLine.empty() && strvLine.back() == '\r')
+            strvLine.remove_suffix (1);
+
+        // comment line?
+        if (strvLine.substr (0, strComment.length()) == strComment)
+            continue;
+
+        // split the line
+        strvVTokens.clear ();
+        size_t nLength = strvLine.length(), i = 0;
+        for (;;)
+        {
+            // first character that is not a delimiter
+            while (i < nLength && IsDelimiter (strvLine[i]))
+                i++;
+            if (i >= nLength)
+                break;
+
+            // token runs to the next delimiter (or end quote)
+            size_t nStart = i;
+            if (i > 0 && strvLine[i-1] == '"')
+            {
+                i = strvLine.find ('"', i);
+                if (i == std::string_view::npos)
+                    throw Error::UNABLETOREAD; // missing end quote
+            }
+            else
+            {
+                while (i < nLength && !IsDelimiter (strvLine[i]))
+                    i++;
+            }
+
+            // trim leading and trailing blank spaces
+            std::string_view strvToken = strvLine.substr (nStart, i - nStart);
+            while (!strvToken.empty() && strvToken.front() == ' ')
+                strvToken.remove_prefix (1);
+            while (!strvToken.empty() && strvToken.back() == ' ')
+                strvToken.remove_suffix (1);
+            strvVTokens.push_back (strvToken);
+        }
+
+        nTokens = static_cast<int>(strvVTokens.size ());
+        if (nTokens == 0)
+            continue; // skip blank line
+        break;
+    }
+}
+
+bool CParser::IsEqual (std::string_view strvA, std::string_view strvB)
+// ---------------------------------------------------------------------------
+// Function: case-insensitive comparison (for tokens of a buffer that was
+//           not converted to lower case)
+// Input:    two strings
+// Output:   true if equal ignoring case
+// ---------------------------------------------------------------------------
+{
+    if (strvA.length() != strvB.length())
+        return false;
+    for (size_t i = 0; i < strvA.length(); i++)
+        if (std::tolower (static_cast<unsigned char>(strvA[i])) !=
+            std::tolower (static_cast<unsigned char>(strvB[i])))
+            return false;
+    return true;
+}
+
 int CParser::MaxCharactersPerLine () const
 // ----------------------------------------------------------------------------
 // Function: returns maximum # of characters per line that can be read
@@ -366,12 +527,7 @@ bool CParser::GetIntValue (const std::string& strUserInput,
 // Output:   integer value
 // ----------------------------------------------------------------------------
 {
-    long lV;
-
-    if (!GetLongValue (strUserInput, lV))
-        return false;
-    nV = static_cast<int> (lV);
-    return true;
+    return GetIntValue (std::string_view (strUserInput), nV);
 }
 
 bool CParser::GetLongValue (const std::string& strUserInput,
@@ -382,48 +538,13 @@ bool CParser::GetLongValue (const std::string& strUserInput,
 // Output:   long value
 // ----------------------------------------------------------------------------
 {
-    // initialize
-    int nSign = 1;	     // assume positive input
-    int nPos = 0;	     // current parsing position
-    std::string strTemp; // temporary string
-
-    // trim leading and trailing blanks
-    std::string strInput = strUserInput;
-    Trim (strInput);
-
-    // first character + or -
-    if (strInput[nPos] == '-')
-    {
-        nSign = -1;		// negative integer
-        nPos++;
-    }
-    else if (strInput[nPos] == '+')
-    {
-        nPos++;			// ignore + sign
-    }
-
-    // extract string without + or -
-    int nLast = static_cast<int>(strInput.length());
-    strTemp = strInput.substr(nPos, nLast-nPos);
-    // trim leading zeros
-    if (nLast > 1) TrimLeadingZeros (strTemp);
-
-    // rest of the string is legal?
-    int nLoc = static_cast<int>(strTemp.find_first_not_of ("0123456789"));
-    if (nLoc >= 0)		// invalid input
-        return false;		// set status for invalid input
-    // invalid input
-    else if (strTemp.length() == 0)
+    std::string_view strvInput = NumericSpan (strUserInput);
+    if (strvInput.empty())
         return false;
-    else
-    {	
-        // legal input so far.
-        AtoL (strTemp, lV, nSign);
-        // account for proper sign
-        lV *= nSign;
-    }
-
-    return true;
+    auto Result = std::from_chars (strvInput.data(),
+                                   strvInput.data() + strvInput.length(), lV);
+    return Result.ec == std::errc() &&
+           Result.ptr == strvInput.data() + strvInput.length();
 }
 
 bool CParser::GetFloatValue (const std::string& strUserInput,
@@ -434,13 +555,7 @@ bool CParser::GetFloatValue (const std::string& strUserInput,
 // Output:   float value
 // ----------------------------------------------------------------------------
 {
-    double dV;
-
-    if (!GetDoubleValue (strUserInput, dV))
-        return false;
-    fV = static_cast<float> (dV);
-
-    return true;
+    return GetFloatValue (std::string_view (strUserInput), fV);
 }
 
 bool CParser::GetDoubleValue (const std::string& strUserInput,
@@ -451,195 +566,142 @@ bool CParser::GetDoubleValue (const std::string& strUserInput,
 // Output:   double value
 // ----------------------------------------------------------------------------
 {
-    // initialize
-    double dSignM = 1.0;	// assume positive mantissa
-    double dSignE = 1.0;	// assume positive exponent
-    int nPos = 0;		    // current parsing position
-    std::string strTemp;    // temporary string
-
-    // store exponent, mantissa and fractional components
-    std::string strExponent= "", strMantissa = "",
-                strFraction = "";
-    long lVE, lVM; 
-    double dVF;
-
-    // trim leading and trailing blanks
-    std::string strInput = strUserInput;
-    Trim (strInput);
-
-    // first character + or -
-    if (strInput[nPos] == '-')
-    {
-        dSignM = -1.0;		// negative 
-        nPos++;
-    }
-    else if (strInput[nPos] == '+')
-    {
-        nPos++;			// ignore + sign
-    }
-
-    // extract string without + or - 
-    strTemp = strInput.substr(nPos, strInput.length()-nPos);
-    int nLast = static_cast<int>(strTemp.length());
-    // trim leading zeros (unless the input is 0)
-    if (nLast > 1) TrimLeadingZeros (strTemp);
-
-    // is there an exponent?
-    int nLocExp = static_cast<int>(strTemp.find_first_of ("eE"));
-    if (nLocExp >= 0)
-    { // yes
-        strExponent = strTemp.substr(nLocExp+1, nLast-nLocExp);
-        strMantissa = strTemp.substr(0, nLocExp);
-        nLast = static_cast<int>(strExponent.length());
-        if (nLast == 0) // nothing follows e or E
-        {
-            return false;
-        }
-        // first character + or - in the exponent
-        if (strExponent[0] == '-')
-        {
-            dSignE = -1.0;		// negative 
-            strExponent = strExponent.substr(1, nLast-1);
-        }
-        else if (strExponent[0] == '+')
-        {
-            strExponent = strExponent.substr(1, nLast-1);
-        }
-    }
-    else // no
-        strMantissa = strTemp;
-
-    // is there a decimal?
-    int nLocDec = static_cast<int>(strMantissa.find ("."));
-    if (nLocDec >= 0) {
-        nLast = static_cast<int>(strMantissa.length());
-        strFraction = strMantissa.substr(nLocDec+1, nLast-1);
-        strMantissa = strMantissa.substr(0, nLocDec);
-    }
+    return GetDoubleValue (std::string_view (strUserInput), dV);
+}
 
-    // valid string?
-    int nLocE = static_cast<int>(strExponent.find_first_not_of ("0123456789"));
-    int nLocM = static_cast<int>(strMantissa.find_first_not_of ("0123456789"));
-    int nLocF = static_cast<int>(strFraction.find_first_not_of ("0123456789"));
-    // invalid input
-    if (nLocE >= 0 || nLocM >= 0 || nLocF >= 0)
-        return false;		
-    // invalid input
-    else if (strMantissa.length() == 0 && strFraction.length() == 0)
-    {
-        dV = 0.0;
-        return true;
-    }
-    // valid input
-    else
-    {	
-        int nCharsE = static_cast<int>(strExponent.length()); 
-        int nCharsM = static_cast<int>(strMantissa.length()); 
-        //int nCharsF = static_cast<int>(strFraction.length()); 
-        // trim leading zeros
-        if (nCharsE > 0) {
-            TrimLeadingZeros (strExponent);
-            nCharsE = static_cast<int>(strExponent.length()); 
-        }
-        if (nCharsM > 0) {
-            TrimLeadingZeros (strMantissa);
-            nCharsM = static_cast<int>(strMantissa.length()); 
-        }
-        // value of exponent
-        if (!AtoL (strExponent, lVE, static_cast<int>(dSignE)))
-            return false;
-        // capacity of a long number
-        std::string strT;
-        int nChars = NumChars(DBL_MAX_10_EXP, strT);
-        if (nCharsE > nChars)
-            return false;
-        else if (nCharsE == nChars)
-        {
-            if (strT < strExponent) return false;
-        }
-            
-         // value of mantissa
-         if (!AtoL (strMantissa, lVM, static_cast<int>(dSignM)))
-             return false;
-         // value of fractional component
-         dVF = AtoDFraction (strFraction);
-
-         // account for proper sign and final value
-         dV = dSignM*(double(lVM) + dVF)*pow(10.0,dSignE*lVE);
-    }
+bool CParser::GetIntValue (std::string_view strvInput, int& nV) const
+// ----------------------------------------------------------------------------
+// Function: Converts a token view to an integer value (no copies, no
+//           locale)
+// Input:    token
+// Output:   integer value
+// ----------------------------------------------------------------------------
+{
+    strvInput = NumericSpan (strvInput);
+    if (strvInput.empty())
+        return false;
+    auto Result = std::from_chars (strvInput.data(),
+                                   strvInput.data() + strvInput.length(), nV);
+    return Result.ec == std::errc() &&
+           Result.ptr == strvInput.data() + strvInput.length();
+}
 
-    return true;
+bool CParser::GetFloatValue (std::string_view strvInput, float& fV) const
+// ----------------------------------------------------------------------------
+// Function: Converts a token view to a float value. the decimal string
+//           is rounded once, directly to float (no locale, no copies)
+// Input:    token
+// Output:   float value
+// ----------------------------------------------------------------------------
+{
+    strvInput = NumericSpan (strvInput);
+    if (strvInput.empty())
+        return false;
+    auto Result = std::from_chars (strvInput.data(),
+                                   strvInput.data() + strvInput.length(), fV,
+                                   std::chars_format::general);
+    return Result.ec == std::errc() &&
+           Result.ptr == strvInput.data() + strvInput.length();
 }
 
-// convert alpha string to long integer
-bool CParser::AtoL (const std::string& strTemp, long& lV,
-                    int nSign) const
+bool CParser::GetDoubleValue (std::string_view strvInput, double& dV) const
+// ----------------------------------------------------------------------------
+// Function: Converts a token view to a double value (correctly rounded,
+//           no locale, no copies)
+// Input:    token
+// Output:   double value
+// ----------------------------------------------------------------------------
 {
-    int nC = 0;
-    lV = 0;
-    int nLen = static_cast<int>(strTemp.length());
-
-    // capacity of a long number
-    //long lVMAX = (nSign >= 1 ? LONG_MAX : labs(LONG_MIN));
-    long lVMAX = (nSign >= 1 ? LONG_MAX : LONG_MAX);
-    std::string strT;
-    int nChars = NumChars(lVMAX, strT);
-    if (nLen > nChars)
+    strvInput = NumericSpan (strvInput);
+    if (strvInput.empty())
         return false;
-    else if (nLen == nChars)
-    {
-        if (strT < strTemp) return false;
-    }
-        
-    // Example: value of xyz is
-    //          z*10**0 + y*10**1 + z*10**2
-    for (int i=nLen-1; i >= 0; i--)
-    {
-        lV += static_cast<long>((strTemp[i] - '0')*pow(10.0, nC));
-        nC++;
-    }
+    auto Result = std::from_chars (strvInput.data(),
+                                   strvInput.data() + strvInput.length(), dV,
+                                   std::chars_format::general);
+    return Result.ec == std::errc() &&
+           Result.ptr == strvInput.data() + strvInput.length();
+}
 
+bool CParser::GetIntValues (const std::vector<std::string_view>& strvVTokens,
+                            const int nFirst, const int nCount,
+                            int nV[]) const
+// ----------------------------------------------------------------------------
+// Function: Converts a row of tokens to integer values
+// Input:    tokens, index of the first token, # of values
+// Output:   values, return value is false if a token is missing or invalid
+// ----------------------------------------------------------------------------
+{
+    if (nFirst < 0 || nCount < 0 ||
+        nFirst + nCount > static_cast<int>(strvVTokens.size()))
+        return false;
+    for (int i = 0; i < nCount; i++)
+        if (!GetIntValue (strvVTokens[nFirst+i], nV[i]))
+            return false;
     return true;
 }
 
-// convert alpha string to double value < 1
-double CParser::AtoDFraction (const std::string& strTemp) const
+bool CParser::GetFloatValues (const std::vector<std::string_view>& strvVTokens,
+                              const int nFirst, const int nCount,
+                              float fV[]) const
+// ----------------------------------------------------------------------------
+// Function: Converts a row of tokens to float values
+// Input:    tokens, index of the first token, # of values
+// Output:   values, return value is false if a token is missing or invalid
+// ----------------------------------------------------------------------------
 {
-    double dVF = 0.0;
-    int nC = 1;
-    // Example: value of .xyz is
-    //          x/10**1 + y/10**2 + z/10**3
-    for (int i=0; i < static_cast<int>(strTemp.length()); i++)
-    {
-        dVF += static_cast<double>(strTemp[i] - '0')*pow(10.0, -nC);
-        nC++;
-    }
-
-    return dVF;
+    if (nFirst < 0 || nCount < 0 ||
+        nFirst + nCount > static_cast<int>(strvVTokens.size()))
+        return false;
+    for (int i = 0; i < nCount; i++)
+        if (!GetFloatValue (strvVTokens[nFirst+i], fV[i]))
+            return false;
+    return true;
 }
 
-int CParser::NumChars (long lV, std::string& strT) const
+bool CParser::GetDoubleValues (const std::vector<std::string_view>& strvVTokens,
+                               const int nFirst, const int nCount,
+                               double dV[]) const
+// ----------------------------------------------------------------------------
+// Function: Converts a row of tokens to double values
+// Input:    tokens, index of the first token, # of values
+// Output:   values, return value is false if a token is missing or invalid
+// ----------------------------------------------------------------------------
 {
-    int nC = 0;
-    long lVT = lV;
-
-    while (lVT > 0)
-    {
-        strT = strT + ' ';
-        lVT /= 10;
-        nC++;
-    }
+    if (nFirst < 0 || nCount < 0 ||
+        nFirst + nCount > static_cast<int>(strvVTokens.size()))
+        return false;
+    for (int i = 0; i < nCount; i++)
+        if (!GetDoubleValue (strvVTokens[nFirst+i], dV[i]))
+            return false;
+    return true;
+}
 
-    int nX = nC-1;
-    while (lV > 0)
+std::string_view CParser::NumericSpan (std::string_view strvInput)
+// ----------------------------------------------------------------------------
+// Function: prepares a token for std::from_chars: blanks are trimmed and
+//           a leading + sign is dropped. only decimal numbers are
+//           accepted (no inf, nan or hexadecimal)
+// Input:    token
+// Output:   span to convert (empty if the token cannot be a number)
+// ----------------------------------------------------------------------------
+{
+    while (!strvInput.empty() && strvInput.front() == ' ')
+        strvInput.remove_prefix (1);
+    while (!strvInput.empty() && strvInput.back() == ' ')
+        strvInput.remove_suffix (1);
+    if (!strvInput.empty() && strvInput.front() == '+')
     {
-        int n = lV - (lV/10)*10;
-        lV /= 10;
-        strT[nX] = n + '0';
-        nX--;
+        strvInput.remove_prefix (1);
+        if (!strvInput.empty() && strvInput.front() == '-')
+            return std::string_view ();
     }
 
-    return nC;
+    size_t nPos = (!strvInput.empty() && strvInput.front() == '-') ? 1 : 0;
+    if (nPos >= strvInput.length() ||
+        (!std::isdigit (static_cast<unsigned char>(strvInput[nPos])) &&
+         strvInput[nPos] != '.'))
+        return std::string_view ();
+    return strvInput;
 }
 
 void CParser::ErrorMessage (Error err)
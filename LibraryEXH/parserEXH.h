@@ -8,6 +8,7 @@ Object-Oriented Numerical Analysis
 #pragma once
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class CParser
@@ -44,10 +45,32 @@ class CParser
                            bool bLowerCase = true);
         int MaxCharactersPerLine () const;
 
+        // buffered mode: the whole input is held in (or mapped to) one
+        // span and the tokens are views into it (no line length limit)
+        void LoadBuffer (std::istream& IFile, bool bLowerCase = true);
+        void SetBuffer (std::string_view strvBuffer);
+        void GetTokens (int& nLineNumber,
+                        std::vector<std::string_view>& strvVTokens,
+                        int& nTokens, const std::string& strDelimiters,
+                        const std::string& strComment, bool& bEOF);
+        static bool IsEqual (std::string_view strvA, std::string_view strvB);
+
         bool GetIntValue (const std::string& strInput, int& nV) const;
         bool GetLongValue (const std::string& strInput, long& lV) const;
         bool GetFloatValue (const std::string& strInput, float& fV) const;
         bool GetDoubleValue (const std::string& strInput, double& dV) const;
+        bool GetIntValue (std::string_view strvInput, int& nV) const;
+        bool GetFloatValue (std::string_view strvInput, float& fV) const;
+        bool GetDoubleValue (std::string_view strvInput, double& dV) const;
+        bool GetIntValues (const std::vector<std::string_view>& strvVTokens,
+                           const int nFirst, const int nCount,
+                           int nV[]) const;
+        bool GetFloatValues (const std::vector<std::string_view>& strvVTokens,
+                             const int nFirst, const int nCount,
+                             float fV[]) const;
+        bool GetDoubleValues (const std::vector<std::string_view>& strvVTokens,
+                              const int nFirst, const int nCount,
+                              double dV[]) const;
 
         void Trim (std::string& strTemp) const;
         void TrimLeft (std::string& strTemp) const;
@@ -61,8 +84,10 @@ class CParser
         std::string m_strDelimiter;
         std::string m_strComment;
         bool        m_bLowerCase;
-        bool AtoL (const std::string& strTemp, long& lV,
-                   int nSign) const;
-        double AtoDFraction (const std::string& strTemp) const;
-        int NumChars (long lV, std::string& strT) const;
+        std::string      m_strBuffer;     // input read by LoadBuffer
+        std::string_view m_strvInput;     // span being tokenized
+        size_t           m_nPos;          // start of the next line in the span
+        std::string      m_strTableDelimiters; // delimiters in m_bDelimiter
+        bool             m_bDelimiter[256];    // delimiter lookup table
+        static std::string_view NumericSpan (std::string_view strvInput);
 };
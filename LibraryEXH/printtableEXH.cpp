@@ -12,6 +12,7 @@ form to specified output file.
 *******************************************************************************/
 #include <float.h>
 #include <iomanip>
+#include <cstdarg>
 #include "printtableEXH.h"
 #include "GlobalErrorHandler.h"
 
@@ -22,18 +23,20 @@ CPrintTable::CPrintTable (const std::string& szFileName)
 // Output: Class member variables initialized
 // ----------------------------------------------------------------------------
 {
-    FOut = new std::ofstream;
+    m_pFile = new std::ofstream;
     try
     {
-        FOut->open (szFileName, std::ios::out | std::ofstream::app);
+        m_pFile->open (szFileName, std::ios::out | std::ofstream::app);
     }
     catch (std::ofstream::failure e)
     {
         ErrorHandler (4);
     }
+    FOut = m_pFile;
     m_nCols = 0;
     Initialize ();
     m_bFileOpened = true;
+    m_bUsingFile = true;
 }
 
 CPrintTable::CPrintTable (const int nColumns, const std::string& szFileName)
@@ -46,36 +49,40 @@ CPrintTable::CPrintTable (const int nColumns, const std::string& szFileName)
     if (nColumns <= 0 || nColumns > MAXCOLS)
         ErrorHandler (1);
 
-    FOut = new std::ofstream;
+    m_pFile = new std::ofstream;
     try
     {
-        FOut->open (szFileName, std::ios::out | std::ofstream::app);
+        m_pFile->open (szFileName, std::ios::out | std::ofstream::app);
     }
     catch (std::ofstream::failure e)
     {
         ErrorHandler (4);
     }
+    FOut = m_pFile;
     m_nCols = nColumns;
     Initialize ();
     m_bFileOpened = true;
+    m_bUsingFile = true;
 }
 
-CPrintTable::CPrintTable (std::ofstream* FileOutput)
+CPrintTable::CPrintTable (std::ostream* FileOutput)
 // ----------------------------------------------------------------------------
 // Function: Constructor
-// Input:  none
+// Input:  stream to print to (not owned)
 // Output: Class member variables initialized
 // ----------------------------------------------------------------------------
 {
     FOut = FileOutput;
+    m_pFile = nullptr;
     m_nCols = 0;
     Initialize ();
+    m_bUsingFile = true;
 }
 
-CPrintTable::CPrintTable (const int nColumns, std::ofstream* FileOutput)
+CPrintTable::CPrintTable (const int nColumns, std::ostream* FileOutput)
 // ----------------------------------------------------------------------------
 // Function: Constructor (overloaded)
-// Input:  none
+// Input:  number of columns, stream to print to (not owned)
 // Output: Class member variables initialized
 // ----------------------------------------------------------------------------
 {
@@ -84,8 +91,10 @@ CPrintTable::CPrintTable (const int nColumns, std::ofstream* FileOutput)
 
     // set the values
     FOut = FileOutput;
+    m_pFile = nullptr;
     m_nCols = nColumns;
     Initialize ();
+    m_bUsingFile = true;
 }
 
 CPrintTable::CPrintTable (const int nColumns)
@@ -99,6 +108,8 @@ CPrintTable::CPrintTable (const int nColumns)
         ErrorHandler(1);
 
     // set the values
+    FOut = &std::cout;
+    m_pFile = nullptr;
     m_nCols = nColumns;
     Initialize();
 }
@@ -128,8 +139,13 @@ void CPrintTable::Initialize ()
         m_dVMinValue[i] = DBL_MAX;
         m_dVSum[i] = 0.0;
         m_dVAbsSum[i] = 0.0;
+        m_VFormat[i] = ASIS;
+        m_nVPrecision[i] = -1;
     }
     m_bFileOpened = false;
+    m_bUsingFile = false;
+    m_strBuffer.clear ();
+    m_strBuffer.reserve (PAGESIZE + MAXWIDTH);
 }
 
 CPrintTable::~CPrintTable ()
@@ -139,10 +155,11 @@ CPrintTable::~CPrintTable ()
 // Output: none
 // ----------------------------------------------------------------------------
 {
+    WritePage ();
     if (m_bFileOpened)
     {
-        FOut->close ();
-        delete FOut;
+        m_pFile->close ();
+        delete m_pFile;
         m_bFileOpened = false;
     }
 }
@@ -170,13 +187,10 @@ void CPrintTable::SkipLines (int n) const
 // Output:   none
 // ----------------------------------------------------------------------------
 {
-    for (int i = 0; i < n; i++)
-    {
-        if (m_bFileOpened)
-            *FOut << "\n";
-        else
-            std::cout << "\n";
-    }
+    if (n > 0)
+        m_strBuffer.append (n, '\n');
+    if (m_strBuffer.size() >= PAGESIZE)
+        WritePage ();
 }
 
 void CPrintTable::SkipSpaces () const
@@ -186,13 +200,8 @@ void CPrintTable::SkipSpaces () const
 // Output: none
 // ----------------------------------------------------------------------------
 {
-    for (int i = 0; i < m_nMargin; i++)
-    {
-        if (m_bFileOpened)
-            *FOut << " ";
-        else
-            std::cout << " ";
-    }
+    if (m_nMargin > 0)
+        m_strBuffer.append (m_nMargin, ' ');
 }
 
 void CPrintTable::SkipSpaces (const int n) const
@@ -204,13 +213,7 @@ void CPrintTable::SkipSpaces (const int n) const
 {
     if (n <= 0)
         return;
-    for (int i = 0; i < n; i++)
-    {
-        if (m_bFileOpened)
-            *FOut << " ";
-        else
-            std::cout << " ";
-    }
+    m_strBuffer.append (n, ' ');
 }
 
 void CPrintTable::UpdateCurLine ()
@@ -232,10 +235,8 @@ void CPrintTable::NoDataInTable () const
 // ----------------------------------------------------------------------------
 {
     SkipSpaces ((m_nTotalWidth - 17) / 2);
-    if (m_bFileOpened)
-        *FOut << "No data in table." << "\n";
-    else
-        std::cout << "No data in table." << "\n";
+    Put ("No data in table.", 17);
+    m_strBuffer += '\n';
 }
 
 void CPrintTable::GetStatistics (CVector<double>& dVMin,
@@ -276,12 +277,7 @@ void CPrintTable::PrintNext (CVector<std::string>& szV, int i)
 {
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << szV(i);
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << szV(i);
+        PutField (szV(i).c_str(), szV(i).length());
     }
     DoNewLine ();
     m_nHit++;
@@ -297,10 +293,12 @@ void CPrintTable::AllDone ()
     if (m_nHit == 0)
         NoDataInTable ();
 
+    WritePage ();
     if (m_bFileOpened)
     {
-        FOut->close ();
-        delete FOut;
+        m_pFile->close ();
+        delete m_pFile;
+        FOut = &std::cout;
         m_bFileOpened = false;
     }
 }
@@ -312,13 +310,7 @@ void CPrintTable::SkipLinesAndSpaces (int n) const
 // Output:   none
 // ----------------------------------------------------------------------------
 {
-    for (int i = 0; i < n; i++)
-    {
-        if (m_bFileOpened)
-            *FOut << "\n";
-        else
-            std::cout << "\n";
-    }
+    SkipLines (n);
     SkipSpaces ();
 }
 
@@ -363,10 +355,8 @@ void CPrintTable::PrintTableHeading (const char* szHeading,
         int nLen = static_cast<int>(strlen(szHeading));
         nLen = (m_nTotalWidth - nLen) / 2;
         SkipSpaces (m_nMargin + nLen);
-        if (m_bFileOpened)
-            *FOut << szHeading << "\n";
-        else
-            std::cout << szHeading << "\n";
+        Put (szHeading);
+        m_strBuffer += '\n';
         SkipSpaces ();
     }
 
@@ -393,13 +383,7 @@ void CPrintTable::PrintTableHeading (const char* szHeading,
     // column headings
     if (nType <= 1)
     {
-        for (j = 0; j < m_nTotalWidth; j++)
-        {
-            if (m_bFileOpened)
-                *FOut << "-";
-            else
-                std::cout << "-";
-        }
+        m_strBuffer.append (m_nTotalWidth, '-');
     }
     for (j = 0; j < nLines; j++)
     {
@@ -409,24 +393,16 @@ void CPrintTable::PrintTableHeading (const char* szHeading,
             if (j == 0)
             {
                 TrimRight (szL1[i]);
-                if (m_bFileOpened)
-                    *FOut << std::setw(nWidth[i])
-                          << std::setiosflags(std::ios::left) << szL1[i];
-                else
-                    std::cout << std::setw(nWidth[i])
-                              << std::setiosflags(std::ios::left) << szL1[i];
+                Put (szL1[i]);
+                SkipSpaces (nWidth[i] - static_cast<int>(szL1[i].length()));
             }
             else
             {
                 if (!szL2[i].empty())
                 {
                     TrimRight(szL2[i]);
-                    if (m_bFileOpened)
-                        *FOut << std::setw(nWidth[i])
-                              << std::setiosflags(std::ios::left) << szL2[i];
-                    else
-                        std::cout << std::setw(nWidth[i])
-                                  << std::setiosflags(std::ios::left) << szL2[i];
+                    Put (szL2[i]);
+                    SkipSpaces (nWidth[i] - static_cast<int>(szL2[i].length()));
                 }
                 else
                     SkipSpaces (nWidth[i]);
@@ -437,13 +413,7 @@ void CPrintTable::PrintTableHeading (const char* szHeading,
     //if (nType == 0 || nType == 2)
     {
         SkipLines (1); SkipSpaces ();
-        for (j = 0; j < m_nTotalWidth; j++)
-        {
-            if (m_bFileOpened)
-                *FOut << "-";
-            else
-                std::cout << "-";
-        }
+        m_strBuffer.append (m_nTotalWidth, '-');
         SkipLines (1);
         SkipSpaces ();
     }
@@ -493,10 +463,8 @@ void CPrintTable::PrintTableHeading (const std::string& szHeading,
         int nLen = static_cast<int>(szHeading.length());
         nLen = (m_nTotalWidth - nLen) / 2;
         SkipSpaces (m_nMargin + nLen);
-        if (m_bFileOpened)
-            *FOut << szHeading << "\n";
-        else
-            std::cout << szHeading << "\n";
+        Put (szHeading);
+        m_strBuffer += '\n';
         SkipSpaces ();
     }
 
@@ -523,13 +491,7 @@ void CPrintTable::PrintTableHeading (const std::string& szHeading,
     // column headings
     if (nType <= 1)
     {
-        for (j = 0; j < m_nTotalWidth; j++)
-        {
-            if (m_bFileOpened)
-                *FOut << "-";
-            else
-                std::cout << "-";
-        }
+        m_strBuffer.append (m_nTotalWidth, '-');
     }
     for (j = 0; j < nLines; j++)
     {
@@ -539,24 +501,16 @@ void CPrintTable::PrintTableHeading (const std::string& szHeading,
             if (j == 0)
             {
                 TrimRight (szL1[i]);
-                if (m_bFileOpened)
-                    *FOut << std::setw(nWidth[i])
-                          << std::setiosflags(std::ios::left) << szL1[i];
-                else
-                    std::cout << std::setw(nWidth[i])
-                              << std::setiosflags(std::ios::left) << szL1[i];
+                Put (szL1[i]);
+                SkipSpaces (nWidth[i] - static_cast<int>(szL1[i].length()));
             }
             else
             {
                 if (!szL2[i].empty())
                 {
                     TrimRight(szL2[i]);
-                    if (m_bFileOpened)
-                        *FOut << std::setw(nWidth[i])
-                              << std::setiosflags(std::ios::left) << szL2[i];
-                    else
-                        std::cout << std::setw(nWidth[i])
-                                  << std::setiosflags(std::ios::left) << szL2[i];
+                    Put (szL2[i]);
+                    SkipSpaces (nWidth[i] - static_cast<int>(szL2[i].length()));
                 }
                 else
                     SkipSpaces (nWidth[i]);
@@ -566,13 +520,7 @@ void CPrintTable::PrintTableHeading (const std::string& szHeading,
     if (nType == 0 || nType == 2)
     {
         SkipLines (1); SkipSpaces ();
-        for (j = 0; j < m_nTotalWidth; j++)
-        {
-            if (m_bFileOpened)
-                *FOut << "-";
-            else
-                std::cout << "-";
-        }
+        m_strBuffer.append (m_nTotalWidth, '-');
         SkipLines (1);
         SkipSpaces ();
     }
@@ -595,17 +543,11 @@ void CPrintTable::PrintNextLine (const int nFormat, const char *sz)
     {
         case CENTERTEXT:
             SkipSpaces ((MAXWIDTH - static_cast<int>(strlen(sz))) / 2);
-            if (m_bFileOpened)
-                *FOut << sz;
-            else
-                std::cout << sz;
+            Put (sz);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << sz;
-            else
-                std::cout << sz;
+            Put (sz);
             break;
     }
 }
@@ -624,17 +566,11 @@ void CPrintTable::PrintNextLine (const int nFormat, const std::string& szM)
     {
         case CENTERTEXT:
             SkipSpaces ((MAXWIDTH - static_cast<int>(szM.length())) / 2);
-            if (m_bFileOpened)
-                *FOut << szM;
-            else
-                std::cout << szM;
+            Put (szM);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << szM;
-            else
-                std::cout << szM;
+            Put (szM);
             break;
     }
 }
@@ -656,17 +592,13 @@ void CPrintTable::PrintNextLine (const int nFormat, const char *sz1,
         case CENTERTEXT:
             SkipSpaces ((MAXWIDTH - static_cast<int>(strlen(sz1)) -
                 static_cast<int>(str.length())) / 2);
-            if (m_bFileOpened)
-                *FOut << sz1 << str;
-            else
-                std::cout << sz1 << str;
+            Put (sz1);
+            Put (str);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << sz1 << str;
-            else
-                std::cout << sz1 << str;
+            Put (sz1);
+            Put (str);
             break;
     }
 }
@@ -687,17 +619,13 @@ void CPrintTable::PrintNextLine (const int nFormat, const char *sz,
     {
         case CENTERTEXT:
             SkipSpaces ((m_nTotalWidth - static_cast<int>(strlen(sz))) / 2);
-            if (m_bFileOpened)
-                *FOut << sz << nV;
-            else
-                std::cout << sz << nV;
+            Put (sz);
+            PutNumber (nV);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << sz << nV;
-            else
-                std::cout << sz << nV;
+            Put (sz);
+            PutNumber (nV);
             break;
     }
 }
@@ -718,17 +646,13 @@ void CPrintTable::PrintNextLine (const int nFormat, const char *sz,
     {
         case CENTERTEXT:
             SkipSpaces ((m_nTotalWidth - static_cast<int>(strlen(sz))) / 2);
-            if (m_bFileOpened)
-                *FOut << sz << lV;
-            else
-                std::cout << sz << lV;
+            Put (sz);
+            PutNumber (lV);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << sz << lV;
-            else
-                std::cout << sz << lV;
+            Put (sz);
+            PutNumber (lV);
             break;
     }
 }
@@ -749,17 +673,13 @@ void CPrintTable::PrintNextLine (const int nFormat, const char *sz,
     {
         case CENTERTEXT:
             SkipSpaces ((m_nTotalWidth - static_cast<int>(strlen(sz))) / 2);
-            if (m_bFileOpened)
-                *FOut << sz << fV;
-            else
-                std::cout << sz << fV;
+            Put (sz);
+            PutNumber (fV);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << sz << fV;
-            else
-                std::cout << sz << fV;
+            Put (sz);
+            PutNumber (fV);
             break;
     }
 }
@@ -780,17 +700,13 @@ void CPrintTable::PrintNextLine (const int nFormat, const char *sz,
     {
         case CENTERTEXT:
             SkipSpaces ((m_nTotalWidth - static_cast<int>(strlen(sz))) / 2);
-            if (m_bFileOpened)
-                *FOut << sz << dV;
-            else
-                std::cout << sz << dV;
+            Put (sz);
+            PutNumber (dV);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << sz << dV;
-            else
-                std::cout << sz << dV;
+            Put (sz);
+            PutNumber (dV);
             break;
     }
 }
@@ -812,17 +728,15 @@ void CPrintTable::PrintNextLine (const int nFormat, const char *sz,
     {
         case CENTERTEXT:
             SkipSpaces ((m_nTotalWidth - static_cast<int>(strlen(sz))) / 2);
-            if (m_bFileOpened)
-                *FOut << sz << dV << sz1;
-            else
-                std::cout << sz << dV << sz1;
+            Put (sz);
+            PutNumber (dV);
+            Put (sz1);
             break;
         case ASIS:
         default:
-            if (m_bFileOpened)
-                *FOut << sz << dV << sz1;
-            else
-                std::cout << sz << dV << sz1;
+            Put (sz);
+            PutNumber (dV);
+            Put (sz1);
             break;
     }
 }
@@ -839,12 +753,7 @@ void CPrintTable::PrintNext (const int nV)
     UpdateMinMax (nV);
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << nV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << nV;
+        PutValue (nV);
     }
     DoNewLine ();
     m_nHit++;
@@ -863,12 +772,7 @@ void CPrintTable::PrintNext (const int nV, int nIndex)
     UpdateMinMax (nV, nIndex);
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << nV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << nV;
+        PutValue (nV);
     }
     DoNewLine ();
     m_nHit++;
@@ -886,12 +790,7 @@ void CPrintTable::PrintNext (const float fV)
     UpdateMinMax (fV);
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << fV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << fV;
+        PutValue (fV);
     }
     DoNewLine ();
     m_nHit++;
@@ -910,12 +809,7 @@ void CPrintTable::PrintNext (const float fV, int nIndex)
     UpdateMinMax (fV, nIndex);
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << fV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << fV;
+        PutValue (fV);
     }
     DoNewLine ();
     m_nHit++;
@@ -933,12 +827,7 @@ void CPrintTable::PrintNext (const double dV)
     UpdateMinMax (dV);
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << dV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << dV;
+        PutValue (dV);
     }
     DoNewLine ();
     m_nHit++;
@@ -957,12 +846,7 @@ void CPrintTable::PrintNext (const double dV, int nIndex)
     UpdateMinMax (dV, nIndex);
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << dV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << dV;
+        PutValue (dV);
     }
     DoNewLine ();
     m_nHit++;
@@ -978,12 +862,7 @@ void CPrintTable::PrintNext (const char* szV)
 {
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << szV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << szV;
+        PutField (szV, strlen(szV));
     }
     DoNewLine ();
     m_nHit++;
@@ -998,12 +877,7 @@ void CPrintTable::PrintNext (const std::string& szV)
 {
     if (m_bPrint)
     {
-        if (m_bFileOpened)
-            *FOut << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                  << szV;
-        else
-            std::cout << std::setw(m_nW[m_nCurCol]) << std::setiosflags(std::ios::left)
-                      << szV;
+        PutField (szV.c_str(), szV.length());
     }
     DoNewLine ();
     m_nHit++;
@@ -1040,16 +914,114 @@ void CPrintTable::DoNewLine ()
     m_nCurCol++;
     if (m_nCurCol == m_nCols)
     {
-        if (m_bFileOpened)
-            *FOut << "\n";
-        else
-            std::cout << "\n";
+        m_strBuffer += '\n';
         m_nCurLine++;
         m_nCurCol = 0;
+        if (m_strBuffer.size() >= PAGESIZE)
+            WritePage ();
         SkipSpaces();
     }
 }
 
+void CPrintTable::SetColumnFormat (const int nColumn, const TFORMAT Format,
+                                   const int nPrecision)
+// ----------------------------------------------------------------------------
+// Function: Sets how values in a column are printed
+// Input:  nColumn      column number (1-based)
+//         Format       ASIS (left justified), RIGHTJUSTIFY or CENTERTEXT
+//         nPrecision   digits after the decimal point for float/double
+//                      values (-1: use the precision of the stream)
+// Output: none
+// ----------------------------------------------------------------------------
+{
+    if (nColumn <= 0 || nColumn > m_nCols)
+        ErrorHandler (1);
+    m_VFormat[nColumn-1] = Format;
+    m_nVPrecision[nColumn-1] = nPrecision;
+}
+
+void CPrintTable::Flush ()
+// ----------------------------------------------------------------------------
+// Function: Writes the buffered text to the output stream
+// Input:  none
+// Output: none
+// ----------------------------------------------------------------------------
+{
+    WritePage ();
+    FOut->flush ();
+}
+
+void CPrintTable::Put (const char* szV) const
+// ----------------------------------------------------------------------------
+// Function: Appends text to the buffer
+// Input:  null-terminated text
+// Output: none
+// ----------------------------------------------------------------------------
+{
+    m_strBuffer.append (szV);
+}
+
+void CPrintTable::Put (const char* szV, const size_t nLength) const
+// ----------------------------------------------------------------------------
+// Function: Appends text to the buffer
+// Input:  text and its length
+// Output: none
+// ----------------------------------------------------------------------------
+{
+    m_strBuffer.append (szV, nLength);
+}
+
+void CPrintTable::Put (const std::string& szV) const
+// ----------------------------------------------------------------------------
+// Function: Appends text to the buffer
+// Input:  text
+// Output: none
+// ----------------------------------------------------------------------------
+{
+    m_strBuffer.append (szV);
+}
+
+void CPrintTable::PutField (const char* szV, const size_t nLength)
+// ----------------------------------------------------------------------------
+// Function: Appends text padded to the width of the current column
+// Input:  text and its length
+// Output: none
+// ----------------------------------------------------------------------------
+{
+    int nPad = m_nW[m_nCurCol] - static_cast<int>(nLength);
+    if (nPad <= 0)
+        m_strBuffer.append (szV, nLength);
+    else if (m_VFormat[m_nCurCol] == RIGHTJUSTIFY)
+    {
+        m_strBuffer.append (nPad, ' ');
+        m_strBuffer.append (szV, nLength);
+    }
+    else if (m_VFormat[m_nCurCol] == CENTERTEXT)
+    {
+        m_strBuffer.append (nPad/2, ' ');
+        m_strBuffer.append (szV, nLength);
+        m_strBuffer.append (nPad - nPad/2, ' ');
+    }
+    else
+    {
+        m_strBuffer.append (szV, nLength);
+        m_strBuffer.append (nPad, ' ');
+    }
+}
+
+void CPrintTable::WritePage () const
+// ----------------------------------------------------------------------------
+// Function: Writes the buffered text to the output stream in one call
+// Input:  none
+// Output: none
+// ----------------------------------------------------------------------------
+{
+    if (m_strBuffer.empty())
+        return;
+    FOut->write (m_strBuffer.data(), static_cast<std::streamsize>(m_strBuffer.size()));
+    m_strBuffer.clear ();
+}
+
 void CPrintTable::SetPrint (bool bPrint)
 // ----------------------------------------------------------------------------
 // Function: Set print option
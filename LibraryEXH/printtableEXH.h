@@ -8,6 +8,11 @@ Object-Oriented Numerical Analysis
 
 Contains CPrintTable class definitions for functions that print data in tabular
 form to specified output file.
+
+Rows are formatted into an internal character buffer (integers and floating
+point values through std::to_chars, with no stream state changes) and the
+buffer is written to the output stream a page at a time. The caller must
+call Flush or AllDone before writing to the same stream directly.
 ******************************************************************************/
 #pragma once
 
@@ -16,14 +21,17 @@ form to specified output file.
 #include <iomanip>
 #include <string>
 #include <cmath>
+#include <cstring>
+#include <charconv>
+#include <type_traits>
 #include "ArrayContainersEXH.h"         // vector and matrix containers
 
 class CPrintTable
 {
     public:
         CPrintTable (const int);                     // constructor (overloaded)
-        CPrintTable (const int, std::ofstream*);     // constructor (overloaded)
-        CPrintTable (std::ofstream*);                // constructor
+        CPrintTable (const int, std::ostream*);      // constructor (overloaded)
+        CPrintTable (std::ostream*);                 // constructor
         CPrintTable (const std::string& szFileName); // constructor
         CPrintTable (const int nColumns, 
                      const std::string& szFileName);
@@ -33,6 +41,7 @@ class CPrintTable
         static const int MAXCOLS      = 17;
         static const int MAXWIDTH     = 140;
         static const int MAXCOLWIDTH  = 20;
+        static const int PAGESIZE     = 65536;      // bytes written at a time
 
         // helper functions
         void Initialize ();
@@ -74,12 +83,19 @@ class CPrintTable
         void AllDone ();
         void SetPrint (bool);
         void PCopy (const int nWidth[]);
+        void SetColumnFormat (const int nColumn, const TFORMAT Format,
+                              const int nPrecision = -1);
+        void Flush ();
 
         enum DataType {TYPEUNDEFINED, TYPEINT, TYPELONG, TYPEFLOAT, TYPEDOUBLE};
 
     private: 
         // member variables
-        std::ofstream* FOut;                // ofstream to which to print           
+        std::ostream*  FOut;                // stream to which to print
+        std::ofstream* m_pFile;             // file opened in this class
+        mutable std::string m_strBuffer;    // formatted text not yet written
+        TFORMAT        m_VFormat[MAXCOLS];  // justification of each column
+        int            m_nVPrecision[MAXCOLS]; // fixed-point digits (-1: stream)
         int            m_nCols;             // number of columns in table
         std::string    m_szTemp;            // temporary string variable
         int            m_nCurCol;           // Current column number
@@ -108,6 +124,11 @@ class CPrintTable
         void SkipSpaces (const int) const;
         void ErrorHandler (const int nErrorCode) const;
         void NoDataInTable () const;
+        void Put (const char* szV) const;
+        void Put (const char* szV, const size_t nLength) const;
+        void Put (const std::string& szV) const;
+        void PutField (const char* szV, const size_t nLength);
+        void WritePage () const;
 
         // templates for statistics
         template <class T>
@@ -163,6 +184,49 @@ class CPrintTable
             m_dVAbsSum[m_nCurCol] += fabs((double)V);
         }
 
+        // templates for formatting
+        template <class T>
+        size_t FormatValue (char* pBuffer, const size_t nSize, const T V,
+                            const int nPrecision) const
+        {
+            std::to_chars_result Result;
+            if constexpr (std::is_integral_v<T>)
+                Result = std::to_chars (pBuffer, pBuffer + nSize, V);
+            else if (nPrecision >= 0)
+                Result = std::to_chars (pBuffer, pBuffer + nSize, V,
+                                        std::chars_format::fixed, nPrecision);
+            else
+            {
+                // same conversion as FOut << V
+                std::ios::fmtflags Flags = FOut->flags() & std::ios::floatfield;
+                int nDigits = static_cast<int>(FOut->precision());
+                if (Flags == std::ios::fixed)
+                    Result = std::to_chars (pBuffer, pBuffer + nSize, V,
+                                            std::chars_format::fixed, nDigits);
+                else if (Flags == std::ios::scientific)
+                    Result = std::to_chars (pBuffer, pBuffer + nSize, V,
+                                            std::chars_format::scientific, nDigits);
+                else
+                    Result = std::to_chars (pBuffer, pBuffer + nSize, V,
+                                            std::chars_format::general, nDigits);
+            }
+            return (Result.ec == std::errc()) ?
+                    static_cast<size_t>(Result.ptr - pBuffer) : 0;
+        }
+        template <class T>
+        void PutNumber (const T V) const
+        {
+            char szV[512];
+            Put (szV, FormatValue (szV, sizeof(szV), V, -1));
+        }
+        template <class T>
+        void PutValue (const T V)
+        {
+            char szV[512];
+            PutField (szV, FormatValue (szV, sizeof(szV), V,
+                                        m_nVPrecision[m_nCurCol]));
+        }
+
         // string extension functions
         const char* whitespace(void);
         const std::string& TrimLeft     (std::string& myString);
@@ -135,10 +135,16 @@ private:
    int m_nRows;             // number of rows in the vector
    T   *m_pCells;           // address where the vector of
                             // type T is stored
+   bool m_bArena;           // cells were drawn from an arena
+   // small vectors of plain types keep their cells (including the
+   // unused 0th cell) inline and never touch the heap or an arena
+   static const size_t SMALLBYTES = 32;
+   alignas(16) unsigned char m_cSmall[SMALLBYTES];
+   bool IsSmall () const;   // cells are held inline
    void Release ();         // similar to destructor
    void Initialize ();      // initialized values
    inline T GetTolerance () const; // tolerance for bool checks
-   void ErrorHandler (ERRORVM ErrorCode) const;
+   void ErrorHandler (ERRORVM ErrorCode, long nR = 0) const;
 };
 
 // =============== definitions ===========================================
@@ -163,6 +169,7 @@ void CVector<T>::Initialize ()
 {
    m_pCells = nullptr;
    m_nRows = 0;
+   m_bArena = false;
 }
 
 template <class T>
@@ -227,10 +234,18 @@ CVector<T>::CVector (CVector<T>&& A)
 // Output:   none
 // ---------------------------------------------------------------------------
 {
-   // copy the data pointer and its size from the source object
+   // copy the data pointer and its size from the source object.
+   // inline cells cannot be taken over and are copied instead
    m_pCells = A.m_pCells;
    m_nRows = A.GetSize();
+   m_bArena = A.m_bArena;
    m_strName = A.m_strName;
+   if (A.IsSmall())
+   {
+      m_pCells = reinterpret_cast<T*>(m_cSmall);
+      for (int i=1; i <= m_nRows; i++)
+         m_pCells[i] = A.m_pCells[i];
+   }
 
    // release the data pointer from the source object so that
    // the destructor does not free the memory
@@ -252,8 +267,7 @@ CVector<T>::CVector (const std::initializer_list<T>& List)
    int nR = static_cast<int>(List.size());
    if (nR == 0)
    {
-      m_ValueR = nR;
-      ErrorHandler (VECTOR_INVALID_SIZE);
+      ErrorHandler (VECTOR_INVALID_SIZE, nR);
    }
 
    SetSize (nR);
@@ -279,22 +293,32 @@ void CVector<T>::SetSize (int nR)
    // check whether nR is legal
    if (nR <= 0)
    {
-      m_ValueR = nR;
-      ErrorHandler (VECTOR_INVALID_SIZE);
+      ErrorHandler (VECTOR_INVALID_SIZE, nR);
       m_nRows = 0;
    }
    Release ();
    try
    {
-      m_pCells = new T [nR + 1];
+      if constexpr (IsPlain<T>())
+      {
+         if (sizeof(T)*(nR+1) <= SMALLBYTES && alignof(T) <= 16)
+         {
+            m_pCells = reinterpret_cast<T*>(m_cSmall);
+            m_bArena = false;
+         }
+         else
+            m_pCells = static_cast<T*>(AllocateCells (sizeof(T)*(nR+1),
+                                                      alignof(T), m_bArena));
+      }
+      else
+         m_pCells = new T [nR + 1];
    }
    catch (std::bad_alloc)
    {
-      m_ValueR = nR;
-      ErrorHandler (VECTOR_ALLOCATION_ERROR);
+      ErrorHandler (VECTOR_ALLOCATION_ERROR, nR);
    }
    m_nRows = nR;
-   m_dAllocated += static_cast<double>(sizeof(T)*(nR+1));
+   Count (m_Counters.dAllocated, static_cast<double>(sizeof(T)*(nR+1)));
 }
 
 template <class T>
@@ -332,13 +356,31 @@ void CVector<T>::Release ()
    // deallocate storage
    if (m_pCells != nullptr)
    {
-      delete [] m_pCells;
-      m_dDeAllocated += static_cast<double>(sizeof(T)*(m_nRows+1));
+      if constexpr (IsPlain<T>())
+      {
+         if (!IsSmall())
+            FreeCells (m_pCells, alignof(T), m_bArena);
+      }
+      else
+         delete [] m_pCells;
+      Count (m_Counters.dDeAllocated, static_cast<double>(sizeof(T)*(m_nRows+1)));
       m_pCells = nullptr;
       m_nRows = 0;
    }
 }
 
+template <class T>
+bool CVector<T>::IsSmall () const
+// ---------------------------------------------------------------------------
+// Function: checks whether the cells are held in the inline buffer
+// Input:    none
+// Output:   true if they are
+// ---------------------------------------------------------------------------
+{
+   return m_pCells != nullptr &&
+          m_pCells == reinterpret_cast<const T*>(m_cSmall);
+}
+
 // =============== member functions ===========================================
 template <class T>
 T* CVector<T>::begin ()
@@ -490,8 +532,7 @@ T& CVector<T>::operator() (int nR)  // T& is reference
    // row-column reference in bounds?
    if (nR <= 0 || nR > m_nRows)
    {
-      m_ValueR = nR;
-      ErrorHandler (VECTOR_INDEX_OUT_OF_BOUNDS);
+      ErrorHandler (VECTOR_INDEX_OUT_OF_BOUNDS, nR);
       return m_pCells[0];
    }
    else
@@ -522,8 +563,7 @@ const T& CVector<T>::operator() (int nR) const
    // row-column reference in bounds?
    if (nR <= 0 || nR > m_nRows)
    {
-      m_ValueR = nR;
-      ErrorHandler (VECTOR_INDEX_OUT_OF_BOUNDS);
+      ErrorHandler (VECTOR_INDEX_OUT_OF_BOUNDS, nR);
       return m_pCells[0];
    }
    else
@@ -571,8 +611,7 @@ CVector<T>& CVector<T>::operator= (const CVector<T>& matarg)
       // compatible vectors?
       if (m_nRows != matarg.m_nRows)
       {
-         m_ValueR = matarg.m_nRows;
-         ErrorHandler (CArrayBase::VECTOR_INCOMPATIBLE_VECTORS);
+         ErrorHandler (CArrayBase::VECTOR_INCOMPATIBLE_VECTORS, matarg.m_nRows);
          return *this;
       }
       // now copy
@@ -597,8 +636,7 @@ CVector<T>& CVector<T>::operator= (CVector<T>&& A)
       // compatible vectors?
       if (m_nRows != A.m_nRows)
       {
-         m_ValueR = A.m_nRows;
-         ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS);
+         ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS, A.m_nRows);
          return *this;
       }
       // free the existing resource
@@ -607,7 +645,14 @@ CVector<T>& CVector<T>::operator= (CVector<T>&& A)
       // copy the data pointer and its length from the source object
       m_pCells = A.m_pCells;
       m_nRows = A.GetSize();
+      m_bArena = A.m_bArena;
       m_strName = A.m_strName;
+      if (A.IsSmall())
+      {
+         m_pCells = reinterpret_cast<T*>(m_cSmall);
+         for (int i=1; i <= m_nRows; i++)
+            m_pCells[i] = A.m_pCells[i];
+      }
 
       // release the data pointer from the source object so that
       // the destructor does not free the memory multiple times
@@ -663,8 +708,7 @@ CVector<T> CVector<T>::operator+ (const CVector<T>& VRight) const
    // compatible vectors?
    if (m_nRows != VRight.m_nRows)
    {
-      m_ValueR = VRight.m_nRows;
-      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS);
+      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS, VRight.m_nRows);
       return VResult;
    }
 
@@ -687,8 +731,7 @@ void CVector<T>::operator+= (const CVector<T>& VRight)
    // compatible vectors?
    if (m_nRows != VRight.m_nRows)
    {
-      m_ValueR = VRight.m_nRows;
-      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS);
+      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS, VRight.m_nRows);
       return;
    }
    // now add
@@ -707,8 +750,7 @@ CVector<T> CVector<T>::operator- (const CVector<T>& VRight) const
    // compatible vectors?
    if (m_nRows != VRight.m_nRows)
    {
-      m_ValueR = VRight.m_nRows;
-      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS);
+      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS, VRight.m_nRows);
       return VRight;
    }
 
@@ -731,8 +773,7 @@ void CVector<T>::operator-= (const CVector<T>& VRight)
    // compatible vectors?
    if (m_nRows != VRight.m_nRows)
    {
-      m_ValueR = VRight.m_nRows;
-      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS);
+      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS, VRight.m_nRows);
       return;
    }
    // now add
@@ -781,8 +822,7 @@ T CVector<T>::operator* (const CVector<T>& VRight)
    // compatible vectors?
    if (m_nRows != VRight.m_nRows)
    {
-      m_ValueR = VRight.m_nRows;
-      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS);
+      ErrorHandler (VECTOR_INCOMPATIBLE_VECTORS, VRight.m_nRows);
       return 0;
    }
    // dot product
@@ -813,13 +853,14 @@ CVector<T> operator* (T c,
 
 // ==================== Error Handler ========================
 template <class T>
-void CVector<T>::ErrorHandler (ERRORVM ErrorCode) const
+void CVector<T>::ErrorHandler (ERRORVM ErrorCode, long nR) const
 // ---------------------------------------------------------------------------
-// Function: channels error message to base class
+// Function: throws the error with the vector name and the index or size
+//           involved
 //           place a breakpoint here to detect the source of error
-// Input:    error code
+// Input:    error code, index or size
 // Output:   none
 // ---------------------------------------------------------------------------
 {
-   throw ErrorCode;
+   throw CError (ErrorCode, m_strName, nR);
 }
@@ -63,70 +63,83 @@ void CLocalErrorHandler::ErrorHandler (ERRORCODE& ErrorCode)
     std::cerr << '\n';
     std::ostringstream strMessage;
 
+    std::cerr << Describe (ErrorCode);
+    if (ErrorCode != ERRORCODE::UNSTABLEFRAME && ErrorCode != ERRORCODE::INVALIDCOMMANDLINE &&
+        ErrorCode != ERRORCODE::INVALIDSECTION)
+        std::cerr << '\n' << "Error in input file line : "
+                  << m_nLineNumber;
+
+    std::string strM = strMessage.str();
+    std::cerr << strM << "\n";
+}
+
+const char* CLocalErrorHandler::Describe (const ERRORCODE ErrorCode)
+// ---------------------------------------------------------------------------
+// Function: gets the message for an error code
+// Input:    Error #
+// Output:   message text
+// ---------------------------------------------------------------------------
+{
     if (ErrorCode == ERRORCODE::INVALIDNUMNODES)                                 // invalid number of nodes
-        std::cerr << "Number of nodes must be >= 2.";
+        return "Number of nodes must be >= 2.";
     else if (ErrorCode == ERRORCODE::INVALIDNUMELEMENTS)                         // invalid number of elements
-        std::cerr << "Number of elements must be >= 1.";
+        return "Number of elements must be >= 1.";
     else if (ErrorCode == ERRORCODE::INVALIDDEBUGCODE)                           // invalid debug level
-        std::cerr << "Debug level must be 0 or 1.";
+        return "Debug level must be 0 or 1.";
     else if (ErrorCode == ERRORCODE::INVALIDNODENUM)                             // invalid node number
-        std::cerr << "Invalid node number";
+        return "Invalid node number";
     else if (ErrorCode == ERRORCODE::INVALIDELEMENTNUM)                          // invalid element number
-        std::cerr << "Invalid element number";
+        return "Invalid element number";
     else if (ErrorCode == ERRORCODE::INVALIDCSAREA)                              // invalid x/s area
-        std::cerr << "Area must be positive.";
+        return "Area must be positive.";
     else if (ErrorCode == ERRORCODE::INVALIDYM)                                  // invalid E
-        std::cerr << "Modulus of elasticity must be positive.";
+        return "Modulus of elasticity must be positive.";
     else if (ErrorCode == ERRORCODE::UNSTABLEFRAME)                              // unstable structure
-        std::cerr << "Unstable structure.";
+        return "Unstable structure.";
     else if (ErrorCode == ERRORCODE::INVALIDINPUT)                               // invalid input
-        std::cerr << "Invalid input detected in input file.";
+        return "Invalid input detected in input file.";
     else if (ErrorCode == ERRORCODE::INVALIDNODALFIXITY)                         // invalid fixity code
-        std::cerr << "Nodal fixity code must be 0 or 1.";
+        return "Nodal fixity code must be 0 or 1.";
     else if (ErrorCode == ERRORCODE::MISSINGEND)                                 // missing end statement
-        std::cerr << "Missing *END statement in input file.";
+        return "Missing *END statement in input file.";
     else if (ErrorCode == ERRORCODE::CANNOTOPENIFILE)                            // cannot open input file
-        std::cerr << "Cannot open specified input file.";
+        return "Cannot open specified input file.";
     else if (ErrorCode == ERRORCODE::CANNOTOPENOFILE)                            // cannot open output file
-        std::cerr << "Cannot open specified output file.";
+        return "Cannot open specified output file.";
     else if (ErrorCode == ERRORCODE::INVALIDCOMMANDLINE)                         // need 1 or 3 command line arguments
-        std::cerr << "Invalid number of command line arguments.";
+        return "Invalid number of command line arguments.";
+    else if (ErrorCode == ERRORCODE::INVALIDSECTION)                             // section not meshed or bad data
+        return "Invalid cross-section or material data for section analysis.";
     else if (ErrorCode == ERRORCODE::MTB_VECTORADDERROR)
-        std::cerr << "Vector: addition error.";
+        return "Vector: addition error.";
     else if (ErrorCode == ERRORCODE::MTB_VECTORSUBTRACTERROR)
-        std::cerr << "Vector: subtraction error.";
+        return "Vector: subtraction error.";
     else if (ErrorCode == ERRORCODE::MTB_VECTORNORMALIZEERROR)
-        std::cerr << "Vector: normalize error.";
+        return "Vector: normalize error.";
     else if (ErrorCode == ERRORCODE::MTB_VECTORTWONORMERROR)
-        std::cerr << "Vector: two norm error.";
+        return "Vector: two norm error.";
     else if (ErrorCode == ERRORCODE::MTB_VECTORCROSSPRODUCTERROR)
-        std::cerr << "Vector: cross-product error.";
+        return "Vector: cross-product error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXADDERROR)
-        std::cerr << "Matrix: addition error.";
+        return "Matrix: addition error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXSUBTRACTERROR)
-        std::cerr << "Matrix: subtraction error.";
+        return "Matrix: subtraction error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXMULTIPLYERROR)
-        std::cerr << "Matrix: multiplication error.";
+        return "Matrix: multiplication error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXTRANSPOSEERROR)
-        std::cerr << "Matrix: transpose error.";
+        return "Matrix: transpose error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXMULTVECERROR)
-        std::cerr << "Matrix: multiply vector error.";
+        return "Matrix: multiply vector error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXLUFACTERROR)
-        std::cerr << "Matrix: LU factorization error.";
+        return "Matrix: LU factorization error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXLUSOLVEERROR)
-        std::cerr << "Matrix: LU solve error.";
+        return "Matrix: LU solve error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXGAUSSELIMINATIONERROR)
-        std::cerr << "Matrix: Gaussian elimination error.";
+        return "Matrix: Gaussian elimination error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXLDLTFACTERROR)
-        std::cerr << "Matrix: LDLT factorization error.";
+        return "Matrix: LDLT factorization error.";
     else if (ErrorCode == ERRORCODE::MTB_MATRIXLDLTSOLVEERROR)
-        std::cerr << "Matrix: LDLT solve error.";
-
-    if (ErrorCode != ERRORCODE::UNSTABLEFRAME && ErrorCode != ERRORCODE::INVALIDCOMMANDLINE)
-        std::cerr << '\n' << "Error in input file line : "
-                  << m_nLineNumber;
-
-    std::string strM = strMessage.str();
-    std::cerr << strM << "\n";
+        return "Matrix: LDLT solve error.";
+    else
+        return "Unknown error ...?";
 }
-
@@ -32,6 +32,8 @@ class CLocalErrorHandler
             INVALIDCSAREA, INVALIDYM, MISSINGEND,
             UNSTABLEFRAME, INVALIDINPUT, INVALIDCOMMANDLINE,
             CANNOTOPENIFILE, CANNOTOPENOFILE,
+            // section analysis errors
+            INVALIDSECTION,
             // matrix toolbox errors
             MTB_VECTORADDERROR, MTB_VECTORSUBTRACTERROR, 
             MTB_VECTORDOTPRODUCTTERROR,
@@ -46,6 +48,7 @@ class CLocalErrorHandler
 
         void ErrorHandler (ERRORCODE& err);
         void ErrorHandler (ERRORCODE& err, int n);
+        static const char* Describe (const ERRORCODE err);
 
     protected:
         int m_nLineNumber; // line number in the input file
@@ -421,9 +421,12 @@ void CMatToolBox<T>::Add(const CMatrix<T>& A, const CMatrix<T>& B,
         ErrorHandler(Error::MATERR_ADD);
     }
 
-    for (int i = 1; i <= nRows; i++) {  // loop through rows
-        for (int j = 1; j <= nCols; j++) {  // loop through columns
-            C(i, j) = A(i, j) + B(i, j);    // add each element
+    for (int i = 0; i < nRows; i++) {  // loop through rows
+        const T* pA = A.row(i);
+        const T* pB = B.row(i);
+        T* pC = C.row(i);
+        for (int j = 0; j < nCols; j++) {  // loop through columns
+            pC[j] = pA[j] + pB[j];         // add each element
         }
     }
 
@@ -447,9 +450,12 @@ void CMatToolBox<T>::Subtract(const CMatrix<T>& A,
         ErrorHandler(Error::MATERR_SUBTRACT);
     }
 
-    for (int i = 1; i <= nRows; i++) {  // loop through rows
-        for (int j = 1; j <= nCols; j++) {  // loop through columns
-            C(i, j) = A(i, j) - B(i, j);    // subtract each element
+    for (int i = 0; i < nRows; i++) {  // loop through rows
+        const T* pA = A.row(i);
+        const T* pB = B.row(i);
+        T* pC = C.row(i);
+        for (int j = 0; j < nCols; j++) {  // loop through columns
+            pC[j] = pA[j] - pB[j];         // subtract each element
         }
     }
 
@@ -476,16 +482,19 @@ void CMatToolBox<T>::Multiply(const CMatrix<T>& A,
 
     C.Set(0);   // Make sure C is all zeros to start
 
-    for (int i = 1; i <= C.GetRows(); i++)
+    // row i of C accumulates A(i,k) times row k of B
+    for (int i = 0; i < m; i++)
     {
-        for (int j = 1; j <= C.GetColumns(); j++)
+        const T* pA = A.row(i);
+        T* pC = C.row(i);
+        for (int k = 0; k < n; k++)
         {
-            T sum = 0.0;
-            for (int k = 1; k <= A.GetColumns(); k++)
+            const T aik = pA[k];
+            const T* pB = B.row(k);
+            for (int j = 0; j < p; j++)
             {
-                sum += A(i, k) * B(k, j);
+                pC[j] += aik * pB[j];
             }
-            C(i, j) = sum;
         }
     }
 }
@@ -513,9 +522,10 @@ void CMatToolBox<T>::Scale(CMatrix<T>& A, T c)
     int nRows = A.GetRows();
     int nCols = A.GetColumns();
 
-    for (int i = 1; i <= nRows; i++) {  // loop through rows
-        for (int j = 1; j <= nCols; j++) {  // loop through columns
-            A(i, j) = A(i, j) * c;    // multiply by the scalar
+    for (int i = 0; i < nRows; i++) {  // loop through rows
+        T* pA = A.row(i);
+        for (int j = 0; j < nCols; j++) {  // loop through columns
+            pA[j] = pA[j] * c;             // multiply by the scalar
         }
     }
 
@@ -594,14 +604,16 @@ void CMatToolBox<T>::MatMultVec(const CMatrix<T>& A,
     b.Set(0);   // Make sure b is all zeros to start
 
 
-    for (int i = 1; i <= A.GetRows(); i++)
+    const T* px = &x(1);
+    for (int i = 0; i < m; i++)
     {
+        const T* pA = A.row(i);
         T sum = 0.0;
-        for (int j = 1; j <= A.GetColumns(); j++)
+        for (int j = 0; j < n; j++)
         {
-            sum += A(i, j) * x(j);
+            sum += pA[j] * px[j];
         }
-        b(i) = sum;
+        b(i + 1) = sum;
     }
 }
 
@@ -0,0 +1,121 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CAnalysisCache class.
+
+TODO:
+
+**********************************************/
+#include <cmath>
+#include "analysiscache.h"
+#include "capacitycache.h"
+
+CAnalysisCache::CAnalysisCache ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+CAnalysisCache::~CAnalysisCache ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+bool CAnalysisCache::CFingerprint::operator< (const CFingerprint& B) const
+// ---------------------------------------------------------------------------
+// Function: orders fingerprints for the map
+// Input:    fingerprint to compare with
+// Output:   true if this fingerprint comes first
+// ---------------------------------------------------------------------------
+{
+    if (nSection != B.nSection)
+        return nSection < B.nSection;
+    if (nMaterial != B.nMaterial)
+        return nMaterial < B.nMaterial;
+    return nReinforcement < B.nReinforcement;
+}
+
+unsigned long long CAnalysisCache::Fingerprint (const std::vector<float>& fVData)
+// ---------------------------------------------------------------------------
+// Function: fingerprint of a block of input values, quantized as in
+//           CCapacityCache so that formatting differences do not matter
+// Input:    values read from the block
+// Output:   64-bit fingerprint
+// ---------------------------------------------------------------------------
+{
+    std::vector<long long> nVKey(fVData.size() + 1);
+    nVKey[0] = static_cast<long long>(fVData.size());
+    for (size_t i = 0; i < fVData.size(); i++)
+        nVKey[i+1] = std::llround(static_cast<double>(fVData[i]) *
+                                  CCapacityCache::QUANTUM);
+    return CCapacityCache::Hash (nVKey);
+}
+
+long long CAnalysisCache::LoadKey (const float fP)
+// ---------------------------------------------------------------------------
+// Function: key of an axial load (quantized to 1/QUANTUM kip)
+// Input:    axial load
+// Output:   key
+// ---------------------------------------------------------------------------
+{
+    return std::llround(static_cast<double>(fP) * CCapacityCache::QUANTUM);
+}
+
+std::shared_ptr<CAnalysisCache::CEntry> CAnalysisCache::GetEntry (const CFingerprint& Print)
+// ---------------------------------------------------------------------------
+// Function: gets the entry of a section, creating an empty one the first
+//           time the section is seen
+// Input:    section fingerprint
+// Output:   entry (lock its mutex while reading or writing it)
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    std::shared_ptr<CEntry>& pEntry = m_Entries[Print];
+    if (!pEntry)
+        pEntry = std::make_shared<CEntry>();
+    return pEntry;
+}
+
+void CAnalysisCache::Clear ()
+// ---------------------------------------------------------------------------
+// Function: removes all entries
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    m_Entries.clear ();
+}
+
+int CAnalysisCache::GetSize () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of sections stored
+// Input:    none
+// Output:   # of entries
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    return static_cast<int>(m_Entries.size());
+}
+
+CAnalysisCache& CAnalysisCache::GetDefault ()
+// ---------------------------------------------------------------------------
+// Function: gets the cache shared by all elements of the run
+// Input:    none
+// Output:   default cache
+// ---------------------------------------------------------------------------
+{
+    static CAnalysisCache Default;
+    return Default;
+}
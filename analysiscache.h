@@ -0,0 +1,82 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Section results kept between analyses of the same
+section. A section is identified by three
+fingerprints computed from the parsed input: the
+geometry block, the material blocks and the
+reinforcement blocks (bars and transverse
+polylines). Results that do not depend on the
+demands (interaction diagram and surface) are
+stored once per section; results that depend on
+the axial load (moment capacity, moment-curvature)
+are stored per axial load. When only the *max
+values change, a re-analysis finds everything
+here and no section solve is repeated.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "interaction.h"
+#include "momentcurvature.h"
+
+class CAnalysisCache
+{
+    public:
+        CAnalysisCache ();   // ctor
+        ~CAnalysisCache ();  // dtor
+
+        struct CFingerprint
+        {
+            unsigned long long nSection;        // geometry block
+            unsigned long long nMaterial;       // material blocks
+            unsigned long long nReinforcement;  // reinforcement blocks
+            bool operator< (const CFingerprint& B) const;
+        };
+
+        struct CCapacity
+        {
+            float fMn, fPhiMn, fPhi, fC, fEpsT;
+        };
+
+        struct CEntry
+        {
+            std::mutex Mutex;                     // guards the members below
+            std::map<long long, CCapacity> Capacity;             // by axial load
+            std::map<std::pair<long long, int>, CMomentCurvature>
+                MomentCurvature;                  // by axial load and # of steps
+            int nInteractionPoints = 0;           // 0 until stored
+            CInteractionDiagram Interaction;
+            int nSurfaceAngles = 0;               // 0 until stored
+            int nSurfaceDepths = 0;
+            CInteractionSurface Surface;
+        };
+
+        // helper functions
+        static unsigned long long Fingerprint (const std::vector<float>& fVData);
+        static long long LoadKey (const float fP);
+        std::shared_ptr<CEntry> GetEntry (const CFingerprint& Print);
+        void Clear ();
+
+        // accessor functions
+        int GetSize () const;
+        static CAnalysisCache& GetDefault ();
+
+    private:
+        std::map<CFingerprint, std::shared_ptr<CEntry>> m_Entries;
+        mutable std::mutex m_Mutex;   // guards m_Entries
+
+        // no copies
+        CAnalysisCache (const CAnalysisCache&) = delete;
+        CAnalysisCache& operator= (const CAnalysisCache&) = delete;
+};
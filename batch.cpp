@@ -0,0 +1,449 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CBatchDriver class.
+
+TODO:
+
+**********************************************/
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <filesystem>
+#include <algorithm>
+#include <map>
+#include "batch.h"
+#include "element.h"
+#include "clockEXH.h"
+#include "arenaEXH.h"
+
+CBatchDriver::CBatchDriver ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_strSummary = "batch_summary.txt";
+    m_nThreads = 0;
+    m_pDiskCache = nullptr;
+    m_pResults = nullptr;
+}
+
+CBatchDriver::~CBatchDriver ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CBatchDriver::Run (int argc, char* argv[])
+// ---------------------------------------------------------------------------
+// Function: parses the batch command line, runs the jobs and writes the
+//           summary
+// Input:    command line arguments (argv[1] is -batch)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    bool bSummarySet = false;
+    std::vector<std::string> strVItems;
+    for (int i = 2; i < argc; i++)
+    {
+        std::string strArg = argv[i];
+        if ((strArg == "-o" || strArg == "-j" || strArg == "-s") && i+1 >= argc)
+            ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDCOMMANDLINE);
+        if (strArg == "-o")
+            SetOutputDirectory (argv[++i]);
+        else if (strArg == "-j")
+            m_nThreads = std::max(0, atoi(argv[++i]));
+        else if (strArg == "-s")
+        {
+            m_strSummary = argv[++i];
+            bSummarySet = true;
+        }
+        else
+            strVItems.push_back (strArg);
+    }
+    if (strVItems.empty())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDCOMMANDLINE);
+    if (!bSummarySet && !m_strOutputDir.empty())
+        m_strSummary = (std::filesystem::path(m_strOutputDir) / m_strSummary).string();
+
+    for (size_t i = 0; i < strVItems.size(); i++)
+        AddInput (strVItems[i]);
+
+    CClock Timer;
+    CThreadPool Pool(m_nThreads);
+    std::cout << "\nBatch of " << GetNumJobs() << " job(s) on "
+              << Pool.GetNumThreads() << " thread(s).\n";
+    Analyze (Pool);
+    WriteSummary (m_strSummary);
+
+    // machine-readable results in job order
+    if (m_pResults != nullptr)
+    {
+        for (size_t i = 0; i < m_Jobs.size(); i++)
+        {
+            if (m_Jobs[i].bOK)
+                m_pResults->Write (m_Jobs[i].Record);
+            else
+                m_pResults->Write (CResultWriter::ErrorRecord (
+                    m_Jobs[i].strInput, 1, m_Jobs[i].strMessage));
+        }
+        m_pResults->Flush ();
+    }
+
+    std::cout << GetNumJobs() - GetNumFailed() << " job(s) completed, "
+              << GetNumFailed() << " failed.\n";
+    std::cout << "Summary written to " << m_strSummary << "\n";
+    std::cout << "Elapsed wall clock time: " << Timer.DiffTime ()
+              << " seconds\n";
+}
+
+void CBatchDriver::AddInput (const std::string& strItem)
+// ---------------------------------------------------------------------------
+// Function: adds the jobs named by a command line item
+//           @file      manifest: one input file per line, optionally
+//                      followed by its output file (names with blanks in
+//                      double quotes); ** lines are comments
+//           directory  every .dat file in it
+//           pattern    files matching * and ? in the pattern's directory
+//           file       the file itself
+// Input:    command line item
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    namespace fs = std::filesystem;
+    if (!strItem.empty() && strItem[0] == '@')
+    {
+        std::ifstream Manifest(strItem.substr(1));
+        if (!Manifest)
+            ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+        std::string strLine;
+        while (std::getline (Manifest, strLine))
+        {
+            std::istringstream Line(strLine);
+            std::string strInput, strOutput;
+            if (!(Line >> std::quoted(strInput)) ||
+                strInput.compare (0, 2, "**") == 0)
+                continue;
+            Line >> std::quoted(strOutput);
+            AddJob (strInput, strOutput);
+        }
+        return;
+    }
+
+    std::error_code EC;
+    if (fs::is_directory (strItem, EC))
+    {
+        std::vector<std::string> strVFiles;
+        for (const fs::directory_entry& Entry : fs::directory_iterator(strItem, EC))
+            if (Entry.is_regular_file (EC) && Entry.path().extension() == ".dat")
+                strVFiles.push_back (Entry.path().string());
+        std::sort (strVFiles.begin(), strVFiles.end());
+        for (size_t i = 0; i < strVFiles.size(); i++)
+            AddJob (strVFiles[i], "");
+        return;
+    }
+
+    if (strItem.find_first_of ("*?") != std::string::npos)
+    {
+        fs::path Pattern(strItem);
+        fs::path Dir = Pattern.has_parent_path() ? Pattern.parent_path() : fs::path(".");
+        std::string strName = Pattern.filename().string();
+        std::vector<std::string> strVFiles;
+        for (const fs::directory_entry& Entry : fs::directory_iterator(Dir, EC))
+        {
+            if (!Entry.is_regular_file (EC))
+                continue;
+            if (Match (strName.c_str(), Entry.path().filename().string().c_str()))
+                strVFiles.push_back (Entry.path().string());
+        }
+        std::sort (strVFiles.begin(), strVFiles.end());
+        for (size_t i = 0; i < strVFiles.size(); i++)
+            AddJob (strVFiles[i], "");
+        return;
+    }
+
+    AddJob (strItem, "");
+}
+
+void CBatchDriver::AddJob (const std::string& strInput,
+                           const std::string& strOutput)
+// ---------------------------------------------------------------------------
+// Function: adds one job
+// Input:    input file, output file (empty to derive it from the input)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CJob Job;
+    Job.strInput = strInput;
+    Job.strOutput = strOutput.empty() ? OutputName (strInput) : strOutput;
+    Job.bOK = false;
+    Job.bRun = true;
+    Job.fMn = Job.fPhiMn = Job.fPhi = 0.0f;
+    Job.dTime = 0.0;
+    m_Jobs.push_back (Job);
+}
+
+void CBatchDriver::Analyze (CThreadPool& Pool)
+// ---------------------------------------------------------------------------
+// Function: runs all jobs on the pool. Jobs are handed out one at a time
+//           and the section analyses inside a job submit their own tasks
+//           to the same pool, where idle workers steal them. A job whose
+//           output file is already taken by an earlier job fails without
+//           being run.
+// Input:    thread pool
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    namespace fs = std::filesystem;
+    std::map<std::string, size_t> Outputs;  // output file -> first job
+    for (size_t i = 0; i < m_Jobs.size(); i++)
+    {
+        CJob& Job = m_Jobs[i];
+        std::error_code EC;
+        fs::path Out = fs::weakly_canonical (Job.strOutput, EC);
+        if (EC)
+            Out = fs::absolute (Job.strOutput, EC).lexically_normal();
+        auto Result = Outputs.emplace (Out.string(), i);
+        if (!Result.second)
+        {
+            Job.bRun = false;
+            Job.strMessage = "Output file is also the output of " +
+                             m_Jobs[Result.first->second].strInput + ".";
+            continue;
+        }
+        if (Out.has_parent_path())
+            fs::create_directories (Out.parent_path(), EC);
+    }
+
+    Pool.ParallelFor (0, GetNumJobs() - 1, [this, &Pool] (int i)
+    {
+        CJob& Job = m_Jobs[static_cast<size_t>(i)];
+        if (Job.bRun)
+            RunJob (Job, Pool);
+    });
+}
+
+void CBatchDriver::RunJob (CJob& Job, CThreadPool& Pool) const
+// ---------------------------------------------------------------------------
+// Function: analyzes one input file in its own CElement. All errors are
+//           trapped and recorded so that the other jobs carry on. The
+//           job's vectors and matrices live in an arena that is released
+//           in one piece when the job is done.
+// Input:    job, thread pool for the section analyses
+// Output:   job results
+// ---------------------------------------------------------------------------
+{
+    auto Start = std::chrono::steady_clock::now();
+    CArena Arena;                   // must outlive the element
+    CArena::CScope Scope(&Arena);
+    CElement Element;
+    Element.SetThreadPool (&Pool);
+    Element.SetDiskCache (m_pDiskCache);
+    try
+    {
+        Element.PrepareIO (Job.strInput, Job.strOutput);
+        Element.Analyze ();
+        float fC, fEpsT;
+        Element.GetMomentCapacity (Job.fMn, Job.fPhiMn, Job.fPhi, fC, fEpsT);
+        Element.GetRecord (Job.Record);
+        Job.bOK = true;
+    }
+    catch (CLocalErrorHandler::ERRORCODE&)
+    {
+        if (Element.GetDiagnostics().HasErrors())
+            Job.strMessage = Element.GetDiagnostics().GetSummary();
+        else
+            Job.strMessage = "Input or section analysis error.";
+    }
+    catch (CGlobalErrorHandler::ERRORCODE& err)
+    {
+        if (err == CGlobalErrorHandler::ERRORCODE::CANNOTOPENIFILE)
+            Job.strMessage = "Cannot open input file.";
+        else if (err == CGlobalErrorHandler::ERRORCODE::CANNOTOPENOFILE)
+            Job.strMessage = "Cannot open output file.";
+        else
+            Job.strMessage = "Library error.";
+    }
+    catch (CArrayBase::CError& err)
+    {
+        Job.strMessage = "Vector/matrix error. " + err.Describe();
+    }
+    catch (std::exception& err)
+    {
+        Job.strMessage = err.what();
+    }
+    catch (...)
+    {
+        Job.strMessage = "Unknown error.";
+    }
+    Job.dTime = std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                              - Start).count();
+}
+
+void CBatchDriver::WriteSummary (const std::string& strFileName) const
+// ---------------------------------------------------------------------------
+// Function: writes one line per job with its status and capacities
+// Input:    summary file name
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::ofstream Summary(strFileName, std::ios::out);
+    if (!Summary)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+
+    Summary << "XSDesigner batch summary: " << GetNumJobs() << " job(s), "
+            << GetNumFailed() << " failed" << '\n';
+    Summary << "Status          Mn      phi*Mn      phi    Time (s)  Input -> Output" << '\n';
+    Summary << "------  ----------  ----------  -------  ----------  ---------------" << '\n';
+    Summary << std::fixed;
+    for (size_t i = 0; i < m_Jobs.size(); i++)
+    {
+        const CJob& Job = m_Jobs[i];
+        Summary << std::setw(6) << std::left << (Job.bOK ? "OK" : "FAILED")
+                << std::right << std::setprecision(2)
+                << std::setw(12) << Job.fMn << std::setw(12) << Job.fPhiMn
+                << std::setprecision(4) << std::setw(9) << Job.fPhi
+                << std::setprecision(3) << std::setw(12) << Job.dTime
+                << "  " << Job.strInput << " -> " << Job.strOutput;
+        if (!Job.bOK)
+            Summary << "  (" << Job.strMessage << ")";
+        Summary << '\n';
+    }
+}
+
+int CBatchDriver::GetNumJobs () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of jobs
+// Input:    none
+// Output:   # of jobs
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_Jobs.size());
+}
+
+int CBatchDriver::GetNumFailed () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of jobs that did not complete
+// Input:    none
+// Output:   # of failed jobs
+// ---------------------------------------------------------------------------
+{
+    int n = 0;
+    for (size_t i = 0; i < m_Jobs.size(); i++)
+        if (!m_Jobs[i].bOK) n++;
+    return n;
+}
+
+void CBatchDriver::SetOutputDirectory (const std::string& strDir)
+// ---------------------------------------------------------------------------
+// Function: sets the directory for the output files (created if needed)
+// Input:    directory name
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::error_code EC;
+    std::filesystem::create_directories (strDir, EC);
+    m_strOutputDir = strDir;
+}
+
+void CBatchDriver::SetDiskCache (CDiskCache* pDiskCache)
+// ---------------------------------------------------------------------------
+// Function: sets the cache file shared by all jobs
+// Input:    cache file (nullptr = none)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pDiskCache = pDiskCache;
+}
+
+void CBatchDriver::SetResultWriter (CResultWriter* pResults)
+// ---------------------------------------------------------------------------
+// Function: sets the writer of the machine-readable results
+// Input:    results writer (nullptr = none)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pResults = pResults;
+}
+
+std::string CBatchDriver::OutputName (const std::string& strInput) const
+// ---------------------------------------------------------------------------
+// Function: output file of an input file: the input name with the .out
+//           extension. With an output directory the input's path relative
+//           to the working directory is kept below it, so that inputs of
+//           the same name in different directories do not share an output
+//           file; inputs outside the working directory keep only their
+//           file name
+// Input:    input file name
+// Output:   output file name
+// ---------------------------------------------------------------------------
+{
+    namespace fs = std::filesystem;
+    fs::path Out(strInput);
+    Out.replace_extension (".out");
+    if (!m_strOutputDir.empty())
+    {
+        std::error_code EC;
+        fs::path Relative = Out.lexically_normal();
+        if (Relative.has_root_path())
+            Relative = Relative.lexically_relative (fs::current_path (EC));
+        if (Relative.empty() || *Relative.begin() == "..")
+            Relative = Out.filename();
+        Out = fs::path(m_strOutputDir) / Relative;
+    }
+    return Out.string();
+}
+
+bool CBatchDriver::Match (const char* szPattern, const char* szName)
+// ---------------------------------------------------------------------------
+// Function: wildcard match (* any run of characters, ? one character)
+// Input:    pattern, file name
+// Output:   true if the name matches
+// ---------------------------------------------------------------------------
+{
+    const char* pStar = nullptr;
+    const char* pResume = nullptr;
+    while (*szName)
+    {
+        if (*szPattern == '?' || *szPattern == *szName)
+        {
+            szPattern++; szName++;
+        }
+        else if (*szPattern == '*')
+        {
+            pStar = szPattern++;
+            pResume = szName;
+        }
+        else if (pStar)
+        {
+            szPattern = pStar + 1;
+            szName = ++pResume;
+        }
+        else
+            return false;
+    }
+    while (*szPattern == '*')
+        szPattern++;
+    return *szPattern == '\0';
+}
+
+void CBatchDriver::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
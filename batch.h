@@ -0,0 +1,81 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Batch driver. Collects input files from the
+command line (files, directories, wildcard
+patterns and @manifest files), analyzes them
+concurrently on a work-stealing thread pool with
+one CElement per job, and writes one output file
+per job plus a summary table. With -o the output
+files keep the inputs' relative paths below the
+output directory; jobs that would share an output
+file fail.
+
+Command line:
+  XSDesigner [-cache file] [-results file] -batch [-o outdir] [-j threads]
+                    [-s summary] item [item ...]
+  item: file.dat | directory | pattern (*, ?) |
+        @manifest (one input [output] per line)
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include "threadpool.h"
+#include "diskcache.h"
+#include "resultwriter.h"
+#include "LocalErrorHandler.h"
+
+class CBatchDriver
+{
+    public:
+        CBatchDriver ();   // ctor
+        ~CBatchDriver ();  // dtor
+
+        // helper functions
+        void Run (int argc, char* argv[]);
+        void AddInput (const std::string& strItem);
+        void AddJob (const std::string& strInput, const std::string& strOutput);
+        void Analyze (CThreadPool& Pool);
+        void WriteSummary (const std::string& strFileName) const;
+
+        // accessor functions
+        int GetNumJobs () const;
+        int GetNumFailed () const;
+
+        // modifier functions
+        void SetOutputDirectory (const std::string& strDir);
+        void SetDiskCache (CDiskCache* pDiskCache);
+        void SetResultWriter (CResultWriter* pResults);
+
+    private:
+        struct CJob
+        {
+            std::string strInput;   // input file
+            std::string strOutput;  // output file
+            bool   bOK;             // analysis completed
+            bool   bRun;            // job is to be run (its output is unique)
+            std::string strMessage; // error description
+            float  fMn, fPhiMn;     // moment capacities
+            float  fPhi;            // strength reduction factor
+            double dTime;           // analysis time (s)
+            CResultWriter::CRecord Record; // machine-readable results
+        };
+        std::vector<CJob> m_Jobs;      // the jobs in input order
+        std::string m_strOutputDir;    // directory for the output files
+        std::string m_strSummary;      // summary file name
+        int m_nThreads;                // # of worker threads (0 = all)
+        CDiskCache* m_pDiskCache;      // results of earlier runs (nullptr = off)
+        CResultWriter* m_pResults;     // machine-readable results (nullptr = off)
+
+        void RunJob (CJob& Job, CThreadPool& Pool) const;
+        std::string OutputName (const std::string& strInput) const;
+        static bool Match (const char* szPattern, const char* szName);
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+};
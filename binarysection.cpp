@@ -0,0 +1,249 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CBinarySection class.
+
+TODO:
+
+**********************************************/
+#include <cstring>
+#include <fstream>
+#include "binarysection.h"
+#include "mappedfile.h"
+
+static_assert (sizeof(float) == 4 && sizeof(int) == 4,
+               "the .xsb layout assumes 32-bit int and float");
+
+namespace
+{
+    // appends an array padded to 8 bytes
+    template <class T>
+    void Append (std::vector<unsigned char>& cVImage, const std::vector<T>& tV)
+    {
+        size_t nBytes = tV.size()*sizeof(T);
+        size_t nStart = cVImage.size();
+        cVImage.resize (nStart + ((nBytes + 7) & ~static_cast<size_t>(7)), 0);
+        if (nBytes > 0)
+            memcpy (&cVImage[nStart], tV.data(), nBytes);
+    }
+
+    // copies an array out of the image and advances past its padding
+    template <class T>
+    bool Extract (const unsigned char* pData, const size_t nBytes,
+                  size_t& nOffset, const int nCount, std::vector<T>& tV)
+    {
+        size_t nArray = static_cast<size_t>(nCount)*sizeof(T);
+        size_t nPadded = (nArray + 7) & ~static_cast<size_t>(7);
+        if (nCount < 0 || nPadded > nBytes - nOffset)
+            return false;
+        tV.resize (static_cast<size_t>(nCount));
+        if (nArray > 0)
+            memcpy (tV.data(), pData + nOffset, nArray);
+        nOffset += nPadded;
+        return true;
+    }
+}
+
+CBinarySection::CBinarySection ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+CBinarySection::~CBinarySection ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CBinarySection::Write (const CModel& Model,
+                            std::vector<unsigned char>& cVImage)
+// ---------------------------------------------------------------------------
+// Function: builds the file image of a model
+// Input:    model
+// Output:   file image
+// ---------------------------------------------------------------------------
+{
+    static_assert (sizeof(CHeader) == HEADERSIZE, "CHeader must fill the header");
+    int nPoints = 0;
+    for (size_t i = 0; i < Model.nVPolyPoints.size(); i++)
+        nPoints += Model.nVPolyPoints[i];
+    if (Model.fVBarX.size() != Model.fVBarDia.size() ||
+        Model.fVBarY.size() != Model.fVBarDia.size() ||
+        Model.nVPolyPoints.size() != Model.fVTieDia.size() ||
+        Model.fVPolyX.size() != static_cast<size_t>(nPoints) ||
+        Model.fVPolyY.size() != static_cast<size_t>(nPoints) ||
+        Model.fVLength.size() != Model.fVSpacing.size())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+
+    CHeader Header;
+    memset (&Header, 0, sizeof(Header));
+    memcpy (Header.szMagic, "XSBINARY", 8);
+    Header.nVersion = VERSION;
+    Header.nHeaderSize = HEADERSIZE;
+    Header.nMemberType = Model.nMemberType;
+    Header.nSectionType = Model.nSectionType;
+    Header.nBars = static_cast<int>(Model.fVBarDia.size());
+    Header.nPolylines = static_cast<int>(Model.fVTieDia.size());
+    Header.nPoints = nPoints;
+    Header.nSpacings = static_cast<int>(Model.fVSpacing.size());
+    Header.nDesign = Model.bDesign ? 1 : 0;
+    Header.nDesignDia = static_cast<int>(Model.fVDesignDia.size());
+    memcpy (Header.fConcrete, Model.fConcrete, sizeof(Header.fConcrete));
+    memcpy (Header.fSteel, Model.fSteel, sizeof(Header.fSteel));
+    memcpy (Header.fDims, Model.fDims, sizeof(Header.fDims));
+    memcpy (Header.fMax, Model.fMax, sizeof(Header.fMax));
+    memcpy (Header.fDimMin, Model.fDimMin, sizeof(Header.fDimMin));
+    memcpy (Header.fDimMax, Model.fDimMax, sizeof(Header.fDimMax));
+    Header.fIncrement = Model.fIncrement;
+    Header.fCover = Model.fCover;
+    Header.nMinBars = Model.nMinBars;
+    Header.nMaxBars = Model.nMaxBars;
+    Header.fConcreteCost = Model.fConcreteCost;
+    Header.fSteelCost = Model.fSteelCost;
+
+    cVImage.assign (HEADERSIZE, 0);
+    Append (cVImage, Model.fVBarDia);
+    Append (cVImage, Model.fVBarX);
+    Append (cVImage, Model.fVBarY);
+    Append (cVImage, Model.fVTieDia);
+    Append (cVImage, Model.nVPolyPoints);
+    Append (cVImage, Model.fVPolyX);
+    Append (cVImage, Model.fVPolyY);
+    Append (cVImage, Model.fVSpacing);
+    Append (cVImage, Model.fVLength);
+    Append (cVImage, Model.fVDesignDia);
+
+    Header.nTotalSize = cVImage.size();
+    Header.nChecksum = Checksum (&cVImage[HEADERSIZE], cVImage.size() - HEADERSIZE);
+    memcpy (&cVImage[0], &Header, sizeof(Header));
+}
+
+void CBinarySection::Read (const unsigned char* pData, const size_t nBytes,
+                           CModel& Model)
+// ---------------------------------------------------------------------------
+// Function: extracts a model from a file image. The header, the array
+//           lengths and the checksum are validated before any value is
+//           used.
+// Input:    file image and its size
+// Output:   model
+// ---------------------------------------------------------------------------
+{
+    CHeader Header;
+    if (pData == nullptr || nBytes < HEADERSIZE)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    memcpy (&Header, pData, sizeof(Header));
+    if (memcmp (Header.szMagic, "XSBINARY", 8) != 0 ||
+        Header.nVersion != VERSION || Header.nHeaderSize != HEADERSIZE ||
+        Header.nTotalSize != nBytes ||
+        Header.nChecksum != Checksum (pData + HEADERSIZE, nBytes - HEADERSIZE))
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+
+    Model.nMemberType = Header.nMemberType;
+    Model.nSectionType = Header.nSectionType;
+    memcpy (Model.fConcrete, Header.fConcrete, sizeof(Model.fConcrete));
+    memcpy (Model.fSteel, Header.fSteel, sizeof(Model.fSteel));
+    memcpy (Model.fDims, Header.fDims, sizeof(Model.fDims));
+    memcpy (Model.fMax, Header.fMax, sizeof(Model.fMax));
+    Model.bDesign = (Header.nDesign != 0);
+    memcpy (Model.fDimMin, Header.fDimMin, sizeof(Model.fDimMin));
+    memcpy (Model.fDimMax, Header.fDimMax, sizeof(Model.fDimMax));
+    Model.fIncrement = Header.fIncrement;
+    Model.fCover = Header.fCover;
+    Model.nMinBars = Header.nMinBars;
+    Model.nMaxBars = Header.nMaxBars;
+    Model.fConcreteCost = Header.fConcreteCost;
+    Model.fSteelCost = Header.fSteelCost;
+
+    size_t nOffset = HEADERSIZE;
+    if (!Extract (pData, nBytes, nOffset, Header.nBars, Model.fVBarDia) ||
+        !Extract (pData, nBytes, nOffset, Header.nBars, Model.fVBarX) ||
+        !Extract (pData, nBytes, nOffset, Header.nBars, Model.fVBarY) ||
+        !Extract (pData, nBytes, nOffset, Header.nPolylines, Model.fVTieDia) ||
+        !Extract (pData, nBytes, nOffset, Header.nPolylines, Model.nVPolyPoints) ||
+        !Extract (pData, nBytes, nOffset, Header.nPoints, Model.fVPolyX) ||
+        !Extract (pData, nBytes, nOffset, Header.nPoints, Model.fVPolyY) ||
+        !Extract (pData, nBytes, nOffset, Header.nSpacings, Model.fVSpacing) ||
+        !Extract (pData, nBytes, nOffset, Header.nSpacings, Model.fVLength) ||
+        !Extract (pData, nBytes, nOffset, Header.nDesignDia, Model.fVDesignDia) ||
+        nOffset != nBytes)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+
+    // the polylines must account for every point
+    long long nPoints = 0;
+    for (size_t i = 0; i < Model.nVPolyPoints.size(); i++)
+    {
+        if (Model.nVPolyPoints[i] < 2)
+            ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+        nPoints += Model.nVPolyPoints[i];
+    }
+    if (nPoints != Header.nPoints)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+}
+
+void CBinarySection::Save (const std::string& strFileName,
+                           const std::vector<unsigned char>& cVImage)
+// ---------------------------------------------------------------------------
+// Function: writes a file image
+// Input:    file name, file image
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::ofstream FileOutput(strFileName, std::ios::out | std::ios::binary);
+    if (!FileOutput)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+    FileOutput.write (reinterpret_cast<const char*>(cVImage.data()),
+                      static_cast<std::streamsize>(cVImage.size()));
+    FileOutput.close ();
+    if (!FileOutput)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+}
+
+void CBinarySection::Load (const std::string& strFileName, CModel& Model)
+// ---------------------------------------------------------------------------
+// Function: maps a binary file and extracts its model
+// Input:    file name
+// Output:   model
+// ---------------------------------------------------------------------------
+{
+    CMappedFile File;
+    File.Open (strFileName);
+    Read (File.GetData(), File.GetSize(), Model);
+}
+
+unsigned long long CBinarySection::Checksum (const unsigned char* pData,
+                                             const size_t nBytes)
+// ---------------------------------------------------------------------------
+// Function: FNV-1a hash of a block of bytes
+// Input:    bytes and their number
+// Output:   checksum
+// ---------------------------------------------------------------------------
+{
+    unsigned long long nHash = 14695981039346656037ULL;
+    for (size_t i = 0; i < nBytes; i++)
+    {
+        nHash ^= pData[i];
+        nHash *= 1099511628211ULL;
+    }
+    return nHash;
+}
+
+void CBinarySection::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode)
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
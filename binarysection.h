@@ -0,0 +1,108 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Binary form of an input file (.xsb). The model
+is written once by the converter and then loaded
+without any text parsing: the file is mapped,
+the header and checksum are validated and the
+arrays are copied out of the view.
+
+File layout (little-endian):
+  header (HEADERSIZE bytes): magic, version,
+      header size, total size, checksum of the
+      bytes after the header, member and section
+      type, array lengths, materials, section
+      dimensions, max values and design data
+  arrays, each padded to 8 bytes:
+      bar diameters, bar x, bar y (# of bars)
+      tie diameters, # of points (# of polylines)
+      polyline x, polyline y (# of points)
+      spacings, lengths (# of zones)
+      design bar diameters
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include "constants.h"
+#include "LocalErrorHandler.h"
+
+class CBinarySection
+{
+    public:
+        CBinarySection ();   // ctor
+        ~CBinarySection ();  // dtor
+
+        static const int VERSION = 1;       // file format version
+        static const int HEADERSIZE = 184;  // bytes before the first array
+
+        // model data in the order of the text input
+        struct CModel
+        {
+            int   nMemberType;              // 0 column, 1 beam
+            int   nSectionType;             // CXSType::EPType
+            float fConcrete[3];             // f'c (psi), density, poisson's ratio
+            float fSteel[3];                // fy, Es, density
+            float fDims[MAXEPDIM];          // section dimensions
+            float fMax[6];                  // axial, loc., shear, loc., moment, loc.
+            std::vector<float> fVBarDia;    // bar diameters
+            std::vector<float> fVBarX;      // bar x-coordinates
+            std::vector<float> fVBarY;      // bar y-coordinates
+            std::vector<float> fVTieDia;    // tie diameter of each polyline
+            std::vector<int>   nVPolyPoints;// # of points of each polyline
+            std::vector<float> fVPolyX;     // polyline x-coordinates (all polylines)
+            std::vector<float> fVPolyY;     // polyline y-coordinates (all polylines)
+            std::vector<float> fVSpacing;   // provided stirrup spacings
+            std::vector<float> fVLength;    // length of each spacing zone
+            bool  bDesign;                  // *DESIGN block present
+            float fDimMin[MAXEPDIM];        // lower limits of the dimensions
+            float fDimMax[MAXEPDIM];        // upper limits of the dimensions
+            float fIncrement;               // dimension step
+            float fCover;                   // cover to the bar centers
+            int   nMinBars, nMaxBars;       // limits on the # of bars
+            std::vector<float> fVDesignDia; // candidate bar diameters
+            float fConcreteCost;            // concrete cost ($/ft^3)
+            float fSteelCost;               // steel cost ($/lb)
+        };
+
+        // helper functions
+        static void Write (const CModel& Model, std::vector<unsigned char>& cVImage);
+        static void Read (const unsigned char* pData, const size_t nBytes,
+                          CModel& Model);
+        static void Save (const std::string& strFileName,
+                          const std::vector<unsigned char>& cVImage);
+        static void Load (const std::string& strFileName, CModel& Model);
+
+    private:
+        struct CHeader
+        {
+            char szMagic[8];                  // "XSBINARY"
+            unsigned int nVersion;            // VERSION
+            unsigned int nHeaderSize;         // HEADERSIZE
+            unsigned long long nTotalSize;    // bytes in the file
+            unsigned long long nChecksum;     // checksum of the arrays
+            int   nMemberType, nSectionType;
+            int   nBars, nPolylines, nPoints, nSpacings;
+            int   nDesign, nDesignDia;
+            float fConcrete[3], fSteel[3];
+            float fDims[MAXEPDIM], fMax[6];
+            float fDimMin[MAXEPDIM], fDimMax[MAXEPDIM];
+            float fIncrement, fCover;
+            int   nMinBars, nMaxBars;
+            float fConcreteCost, fSteelCost;
+        };
+
+        static unsigned long long Checksum (const unsigned char* pData,
+                                            const size_t nBytes);
+        static void ErrorHandler (CLocalErrorHandler::ERRORCODE);
+
+        // no copies
+        CBinarySection (const CBinarySection&) = delete;
+        CBinarySection& operator= (const CBinarySection&) = delete;
+};
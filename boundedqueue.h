@@ -0,0 +1,141 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Blocking first-in first-out queue with a fixed
+capacity, used to connect the stages of the
+streaming pipeline. Push waits while the queue is
+full, so a fast producer cannot run ahead of its
+consumers; Pop waits while the queue is empty.
+Close wakes every waiting thread: no more items
+are accepted and Pop returns false once the queue
+has been drained.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include "LocalErrorHandler.h"
+
+template <class T>
+class CBoundedQueue
+{
+    public:
+        CBoundedQueue (const int nCapacity);
+        ~CBoundedQueue ();
+
+        // helper functions
+        bool Push (T&& Item);
+        bool Pop (T& Item);
+        void Close ();
+
+        // accessor functions
+        int GetCapacity () const;
+
+    private:
+        std::deque<T> m_Items;             // queued items
+        int m_nCapacity;                   // max. # of queued items
+        bool m_bClosed;                    // no more items are accepted
+        std::mutex m_Mutex;                // guards the items and the flag
+        std::condition_variable m_NotFull; // signals a pop or the close
+        std::condition_variable m_NotEmpty;// signals a push or the close
+
+        // no copies
+        CBoundedQueue (const CBoundedQueue&) = delete;
+        CBoundedQueue& operator= (const CBoundedQueue&) = delete;
+};
+
+template <class T>
+CBoundedQueue<T>::CBoundedQueue (const int nCapacity)
+// ---------------------------------------------------------------------------
+// Function: constructor
+// Input:    max. # of queued items (>= 1)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (nCapacity < 1)
+        throw CLocalErrorHandler::ERRORCODE::INVALIDINPUT;
+    m_nCapacity = nCapacity;
+    m_bClosed = false;
+}
+
+template <class T>
+CBoundedQueue<T>::~CBoundedQueue ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+template <class T>
+bool CBoundedQueue<T>::Push (T&& Item)
+// ---------------------------------------------------------------------------
+// Function: appends an item, waiting while the queue is full
+// Input:    item
+// Output:   false if the queue was closed (the item is dropped)
+// ---------------------------------------------------------------------------
+{
+    std::unique_lock<std::mutex> Lock(m_Mutex);
+    m_NotFull.wait (Lock, [this] {
+        return m_bClosed || static_cast<int>(m_Items.size()) < m_nCapacity; });
+    if (m_bClosed)
+        return false;
+    m_Items.push_back (std::move(Item));
+    Lock.unlock ();
+    m_NotEmpty.notify_one ();
+    return true;
+}
+
+template <class T>
+bool CBoundedQueue<T>::Pop (T& Item)
+// ---------------------------------------------------------------------------
+// Function: removes the oldest item, waiting while the queue is empty
+// Input:    none
+// Output:   item; false if the queue is closed and empty
+// ---------------------------------------------------------------------------
+{
+    std::unique_lock<std::mutex> Lock(m_Mutex);
+    m_NotEmpty.wait (Lock, [this] { return m_bClosed || !m_Items.empty(); });
+    if (m_Items.empty())
+        return false;
+    Item = std::move(m_Items.front());
+    m_Items.pop_front ();
+    Lock.unlock ();
+    m_NotFull.notify_one ();
+    return true;
+}
+
+template <class T>
+void CBoundedQueue<T>::Close ()
+// ---------------------------------------------------------------------------
+// Function: stops accepting items and wakes all waiting threads
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+        m_bClosed = true;
+    }
+    m_NotFull.notify_all ();
+    m_NotEmpty.notify_all ();
+}
+
+template <class T>
+int CBoundedQueue<T>::GetCapacity () const
+// ---------------------------------------------------------------------------
+// Function: gets the capacity
+// Input:    none
+// Output:   max. # of queued items
+// ---------------------------------------------------------------------------
+{
+    return m_nCapacity;
+}
@@ -0,0 +1,205 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CCapacityCache class.
+
+TODO:
+
+**********************************************/
+#include <cmath>
+#include <algorithm>
+#include "capacitycache.h"
+#include "constants.h"
+
+CCapacityCache::CCapacityCache ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+    : m_nHits(0), m_nMisses(0)
+{
+}
+
+CCapacityCache::~CCapacityCache ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CCapacityCache::CanonicalKey (const CXSType::EPType Type,
+                                   const float fDims[], const float fFc,
+                                   const float fFy, const float fEs,
+                                   const float fP,
+                                   const std::vector<float>& fVDia,
+                                   const std::vector<float>& fVX,
+                                   const std::vector<float>& fVY,
+                                   std::vector<long long>& nVKey,
+                                   const bool bMirror)
+// ---------------------------------------------------------------------------
+// Function: builds the canonical key of a section. The bars are stored
+//           as (y, x, diameter) triples in ascending order; the layout
+//           mirrored about the y-axis has the same capacity about x, so
+//           the lower of the two orderings is used unless bMirror is
+//           false (results that depend on the sign of My).
+// Input:    section type, dimensions (MAXEPDIM values), f'c, fy, Es,
+//           axial load, bar diameters and coordinates, mirror flag
+// Output:   key
+// ---------------------------------------------------------------------------
+{
+    auto Quantize = [] (const float fV) -> long long
+    {
+        return std::llround(static_cast<double>(fV) * QUANTUM);
+    };
+
+    nVKey.clear ();
+    nVKey.push_back (static_cast<long long>(Type));
+    for (int i = 0; i < MAXEPDIM; i++)
+        nVKey.push_back (Quantize (fDims[i]));
+    nVKey.push_back (Quantize (fFc));
+    nVKey.push_back (Quantize (fFy));
+    nVKey.push_back (Quantize (fEs));
+    nVKey.push_back (Quantize (fP));
+
+    size_t nBars = fVDia.size();
+    std::vector<long long> nVBars(3*nBars), nVMirror(3*nBars);
+    std::vector<size_t> nVOrder(nBars);
+    for (int nPass = 0; nPass < (bMirror ? 2 : 1); nPass++)
+    {
+        std::vector<long long>& nVOut = (nPass == 0) ? nVBars : nVMirror;
+        const float fSign = (nPass == 0) ? 1.0f : -1.0f;
+        for (size_t i = 0; i < nBars; i++)
+            nVOrder[i] = i;
+        std::sort (nVOrder.begin(), nVOrder.end(), [&] (size_t a, size_t b)
+        {
+            long long nYa = Quantize (fVY[a]), nYb = Quantize (fVY[b]);
+            if (nYa != nYb) return nYa < nYb;
+            long long nXa = Quantize (fSign*fVX[a]), nXb = Quantize (fSign*fVX[b]);
+            if (nXa != nXb) return nXa < nXb;
+            return Quantize (fVDia[a]) < Quantize (fVDia[b]);
+        });
+        for (size_t i = 0; i < nBars; i++)
+        {
+            size_t k = nVOrder[i];
+            nVOut[3*i]   = Quantize (fVY[k]);
+            nVOut[3*i+1] = Quantize (fSign*fVX[k]);
+            nVOut[3*i+2] = Quantize (fVDia[k]);
+        }
+    }
+    const std::vector<long long>& nVLow = (bMirror && nVMirror < nVBars) ? nVMirror : nVBars;
+    nVKey.insert (nVKey.end(), nVLow.begin(), nVLow.end());
+}
+
+unsigned long long CCapacityCache::Hash (const std::vector<long long>& nVKey)
+// ---------------------------------------------------------------------------
+// Function: 64-bit FNV-1a hash of a key
+// Input:    key
+// Output:   hash value
+// ---------------------------------------------------------------------------
+{
+    unsigned long long nHash = 14695981039346656037ULL;
+    for (size_t i = 0; i < nVKey.size(); i++)
+    {
+        unsigned long long nV = static_cast<unsigned long long>(nVKey[i]);
+        for (int nByte = 0; nByte < 8; nByte++)
+        {
+            nHash ^= (nV >> (8*nByte)) & 0xFFULL;
+            nHash *= 1099511628211ULL;
+        }
+    }
+    return nHash;
+}
+
+bool CCapacityCache::Find (const std::vector<long long>& nVKey,
+                           CCapacity& Cap)
+// ---------------------------------------------------------------------------
+// Function: looks up the capacity of a section
+// Input:    key
+// Output:   returns true if found, Cap is the stored capacity
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    auto Entry = m_Table.find (nVKey);
+    if (Entry == m_Table.end())
+    {
+        ++m_nMisses;
+        return false;
+    }
+    ++m_nHits;
+    Cap = Entry->second;
+    return true;
+}
+
+void CCapacityCache::Insert (const std::vector<long long>& nVKey,
+                             const CCapacity& Cap)
+// ---------------------------------------------------------------------------
+// Function: stores the capacity of a section
+// Input:    key, capacity
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    m_Table[nVKey] = Cap;
+}
+
+void CCapacityCache::Clear ()
+// ---------------------------------------------------------------------------
+// Function: removes all entries and resets the counters
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    m_Table.clear ();
+    m_nHits = 0;
+    m_nMisses = 0;
+}
+
+int CCapacityCache::GetSize () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of stored sections
+// Input:    none
+// Output:   # of entries
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    return static_cast<int>(m_Table.size());
+}
+
+long CCapacityCache::GetNumHits () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of successful lookups
+// Input:    none
+// Output:   # of hits
+// ---------------------------------------------------------------------------
+{
+    return m_nHits;
+}
+
+long CCapacityCache::GetNumMisses () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of failed lookups
+// Input:    none
+// Output:   # of misses
+// ---------------------------------------------------------------------------
+{
+    return m_nMisses;
+}
+
+CCapacityCache& CCapacityCache::GetDefault ()
+// ---------------------------------------------------------------------------
+// Function: gets the table shared by all elements
+// Input:    none
+// Output:   default table
+// ---------------------------------------------------------------------------
+{
+    static CCapacityCache Default;
+    return Default;
+}
@@ -0,0 +1,85 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Memo table of section capacities. A section is
+identified by a canonical key: the section type,
+dimensions, material data, axial load and the bar
+list, each quantized to QUANTUM and with the bars
+sorted (and mirrored about the y-axis if that
+orders them lower) so that the same section
+always gives the same key however its bars were
+listed. The table is shared by all threads; the
+default table lives for the whole run so that
+repeated candidates in later searches and batch
+jobs are not solved again.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include "xstype.h"
+
+class CCapacityCache
+{
+    public:
+        CCapacityCache ();   // ctor
+        ~CCapacityCache ();  // dtor
+
+        static const int QUANTUM = 1000; // key resolution (1/1000 in, ksi, kip)
+
+        struct CCapacity
+        {
+            float fMn;        // nominal moment capacity
+            float fPhiMn;     // design moment capacity
+            float fPhi;       // strength reduction factor
+            float fEpsT;      // net tensile strain
+            float fPhiPnMax;  // maximum design axial strength
+        };
+
+        // helper functions
+        static void CanonicalKey (const CXSType::EPType Type,
+                                  const float fDims[], const float fFc,
+                                  const float fFy, const float fEs,
+                                  const float fP,
+                                  const std::vector<float>& fVDia,
+                                  const std::vector<float>& fVX,
+                                  const std::vector<float>& fVY,
+                                  std::vector<long long>& nVKey,
+                                  const bool bMirror = true);
+        static unsigned long long Hash (const std::vector<long long>& nVKey);
+        bool Find (const std::vector<long long>& nVKey, CCapacity& Cap);
+        void Insert (const std::vector<long long>& nVKey,
+                     const CCapacity& Cap);
+        void Clear ();
+
+        // accessor functions
+        int  GetSize () const;
+        long GetNumHits () const;
+        long GetNumMisses () const;
+        static CCapacityCache& GetDefault ();
+
+    private:
+        struct CKeyHash
+        {
+            size_t operator() (const std::vector<long long>& nVKey) const
+            {
+                return static_cast<size_t>(CCapacityCache::Hash (nVKey));
+            }
+        };
+        std::unordered_map<std::vector<long long>, CCapacity, CKeyHash> m_Table;
+        mutable std::mutex m_Mutex;    // guards m_Table
+        std::atomic<long> m_nHits;     // # of successful lookups
+        std::atomic<long> m_nMisses;   // # of failed lookups
+
+        // no copies
+        CCapacityCache (const CCapacityCache&) = delete;
+        CCapacityCache& operator= (const CCapacityCache&) = delete;
+};
@@ -10,6 +10,7 @@ Introduction to Structural Analysis and Design
 Object-Oriented Numerical Analysis
 *********************************************/
 #pragma once
+#include <limits>
 const int NDIM = 2;		// spatial dimension
 const int DOFPN = 3;	// dof per node
 const int DOFPE = 6;	// dof per element
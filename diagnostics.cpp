@@ -0,0 +1,144 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+TODO:
+
+**********************************************/
+#include "diagnostics.h"
+
+CDiagnostics::CDiagnostics ()
+// ---------------------------------------------------------------------------
+// Function: constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_nErrors = 0;
+}
+
+CDiagnostics::~CDiagnostics ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CDiagnostics::Add (const SEVERITY Severity, const int nLine,
+                        const std::string& strMessage)
+// ---------------------------------------------------------------------------
+// Function: records a problem
+// Input:    severity, input line number, description
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_Entries.push_back ({Severity, nLine, strMessage});
+    if (Severity == SEVERITY::SEVERE)
+        m_nErrors++;
+}
+
+void CDiagnostics::Clear ()
+// ---------------------------------------------------------------------------
+// Function: removes all the problems recorded so far
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_Entries.clear ();
+    m_nErrors = 0;
+}
+
+void CDiagnostics::Write (std::ostream& OF, const int nLineOffset) const
+// ---------------------------------------------------------------------------
+// Function: lists the problems, one per line
+// Input:    output stream, # of lines before the one read as line 1
+//           (a section of a multi-section input)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_Entries.empty())
+        return;
+    OF << '\n';
+    OF << "-------------------------" << '\n';
+    OF << "INPUT DIAGNOSTICS" << '\n';
+    OF << "-------------------------" << '\n';
+    for (size_t i = 0; i < m_Entries.size(); i++)
+    {
+        const CEntry& Entry = m_Entries[i];
+        OF << (Entry.Severity == SEVERITY::SEVERE ? "Error  " : "Warning");
+        if (Entry.nLine > 0)
+            OF << "  line " << Entry.nLine + nLineOffset;
+        OF << ": " << Entry.strMessage << '\n';
+    }
+    OF << GetNumErrors() << " error(s), " << GetNumWarnings()
+       << " warning(s)." << '\n';
+}
+
+bool CDiagnostics::HasErrors () const
+// ---------------------------------------------------------------------------
+// Function: has a severe problem been recorded?
+// Input:    none
+// Output:   true if the job must be abandoned
+// ---------------------------------------------------------------------------
+{
+    return m_nErrors > 0;
+}
+
+int CDiagnostics::GetNumErrors () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of severe problems
+// Input:    none
+// Output:   # of errors
+// ---------------------------------------------------------------------------
+{
+    return m_nErrors;
+}
+
+int CDiagnostics::GetNumWarnings () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of warnings
+// Input:    none
+// Output:   # of warnings
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_Entries.size()) - m_nErrors;
+}
+
+const std::vector<CDiagnostics::CEntry>& CDiagnostics::GetEntries () const
+// ---------------------------------------------------------------------------
+// Function: gets the problems in the order they were found
+// Input:    none
+// Output:   list of problems
+// ---------------------------------------------------------------------------
+{
+    return m_Entries;
+}
+
+std::string CDiagnostics::GetSummary () const
+// ---------------------------------------------------------------------------
+// Function: one-line summary for a batch or stream report: the first
+//           error and the number of others
+// Input:    none
+// Output:   summary (empty if there is no error)
+// ---------------------------------------------------------------------------
+{
+    std::string strSummary;
+    for (size_t i = 0; i < m_Entries.size(); i++)
+    {
+        const CEntry& Entry = m_Entries[i];
+        if (Entry.Severity != SEVERITY::SEVERE)
+            continue;
+        if (Entry.nLine > 0)
+            strSummary = "Line " + std::to_string(Entry.nLine) + ": ";
+        strSummary += Entry.strMessage;
+        break;
+    }
+    if (m_nErrors > 1)
+        strSummary += " (+" + std::to_string(m_nErrors - 1) + " more)";
+    return strSummary;
+}
@@ -0,0 +1,54 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Problems found while reading one job's input.
+The reader records each problem with its line
+number and carries on where it can, so a run
+reports all of them at once. A job with any
+severe problem is abandoned after the read;
+the other jobs of a batch or stream are not
+affected.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <ostream>
+
+class CDiagnostics
+{
+    public:
+        CDiagnostics ();   // ctor
+        ~CDiagnostics ();  // dtor
+
+        enum class SEVERITY { WARNING, SEVERE };
+        struct CEntry
+        {
+            SEVERITY    Severity;   // warning or severe (job abandoned)
+            int         nLine;      // input line (0 = not tied to a line)
+            std::string strMessage; // description
+        };
+
+        // helper functions
+        void Add (const SEVERITY Severity, const int nLine,
+                  const std::string& strMessage);
+        void Clear ();
+        void Write (std::ostream& OF, const int nLineOffset = 0) const;
+
+        // accessor functions
+        bool HasErrors () const;
+        int  GetNumErrors () const;
+        int  GetNumWarnings () const;
+        const std::vector<CEntry>& GetEntries () const;
+        std::string GetSummary () const;
+
+    private:
+        std::vector<CEntry> m_Entries;  // problems in the order found
+        int m_nErrors;                  // # of severe problems
+};
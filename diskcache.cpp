@@ -0,0 +1,627 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CDiskCache class.
+
+TODO:
+
+**********************************************/
+#include <cstddef>
+#include <cstring>
+#include "diskcache.h"
+#include "capacitycache.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+static const char CACHEMAGIC[8] = {'X', 'S', 'D', 'C', 'A', 'C', 'H', 'E'};
+
+CDiskCache::CDiskCache ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+    : m_nHits(0), m_nMisses(0)
+{
+#ifdef _WIN32
+    m_hFile = nullptr;
+    m_hMapping = nullptr;
+#else
+    m_nFile = -1;
+#endif
+    m_pView = nullptr;
+    m_nViewSize = 0;
+    m_nIndexed = 0;
+    m_nCommitted = 0;
+}
+
+CDiskCache::~CDiskCache ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Close ();
+}
+
+void CDiskCache::Open (const std::string& strFileName)
+// ---------------------------------------------------------------------------
+// Function: opens (or creates) a cache file and indexes its records.
+//           an empty file gets its header under the writer lock so that two
+//           runs starting together do not both write it
+// Input:    file name
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    static_assert (sizeof(CHeader) == HEADERSIZE, "cache header size");
+    static_assert (sizeof(CRecord) == 32, "cache record header size");
+
+    Close ();
+    std::unique_lock<std::shared_mutex> Lock(m_Mutex);
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA (strFileName.c_str(),
+                                GENERIC_READ | GENERIC_WRITE,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                                OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+    m_hFile = hFile;
+#else
+    m_nFile = open (strFileName.c_str(), O_RDWR | O_CREAT, 0644);
+    if (m_nFile < 0)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+#endif
+    m_strFileName = strFileName;
+
+    bool bValid = AcquireWriter ();
+    CHeader Header;
+    if (bValid && FileSize () == 0)
+    {
+        std::memset (&Header, 0, sizeof(Header));
+        std::memcpy (Header.szMagic, CACHEMAGIC, sizeof(CACHEMAGIC));
+        Header.nVersion = VERSION;
+        Header.nHeaderSize = HEADERSIZE;
+        Header.nCommitted = 0;
+        bValid = WriteAt (0, &Header, sizeof(Header));
+    }
+    else if (bValid)
+    {
+        bValid = ReadAt (0, &Header, sizeof(Header)) &&
+                 std::memcmp (Header.szMagic, CACHEMAGIC, sizeof(CACHEMAGIC)) == 0 &&
+                 Header.nVersion == VERSION && Header.nHeaderSize == HEADERSIZE;
+    }
+    ReleaseWriter ();
+
+    if (!bValid)
+    {
+        CloseFile ();
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    }
+    Refresh ();
+}
+
+void CDiskCache::Close ()
+// ---------------------------------------------------------------------------
+// Function: unmaps and closes the cache file
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::unique_lock<std::shared_mutex> Lock(m_Mutex);
+    CloseFile ();
+}
+
+void CDiskCache::CloseFile ()
+// ---------------------------------------------------------------------------
+// Function: releases the view, the file and the index. m_Mutex must be
+//           held
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Unmap ();
+#ifdef _WIN32
+    if (m_hFile != nullptr)
+        CloseHandle (static_cast<HANDLE>(m_hFile));
+    m_hFile = nullptr;
+#else
+    if (m_nFile >= 0)
+        close (m_nFile);
+    m_nFile = -1;
+#endif
+    m_Index.clear ();
+    m_nIndexed = 0;
+    m_nCommitted = 0;
+    m_strFileName.clear ();
+}
+
+bool CDiskCache::Find (const KIND Kind, const std::vector<long long>& nVKey,
+                       std::vector<float>& fVValue)
+// ---------------------------------------------------------------------------
+// Function: looks up a result. lookups run concurrently on the shared
+//           side of m_Mutex; only when the committed length in the mapped
+//           header shows records appended by other runs since the last
+//           refresh are they indexed (exclusively) before a miss is
+//           reported
+// Input:    result kind, canonical key
+// Output:   returns true if found, fVValue is the packed result
+// ---------------------------------------------------------------------------
+{
+    unsigned long long nHash = RecordHash (Kind, nVKey);
+    {
+        std::shared_lock<std::shared_mutex> Lock(m_Mutex);
+        if (!IsOpen ())
+            return false;
+        if (Lookup (Kind, nHash, nVKey, fVValue))
+        {
+            m_nHits++;
+            return true;
+        }
+        if (MappedCommitted () == m_nCommitted)
+        {
+            m_nMisses++;
+            return false;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> Lock(m_Mutex);
+    if (!IsOpen ())
+        return false;
+    Refresh ();
+    if (!Lookup (Kind, nHash, nVKey, fVValue))
+    {
+        m_nMisses++;
+        return false;
+    }
+    m_nHits++;
+    return true;
+}
+
+bool CDiskCache::Insert (const KIND Kind, const std::vector<long long>& nVKey,
+                         const std::vector<float>& fVValue)
+// ---------------------------------------------------------------------------
+// Function: appends a result (single writer protocol). nothing is written
+//           if another run stored the same key first
+// Input:    result kind, canonical key, packed result
+// Output:   returns true if the result is in the file
+// ---------------------------------------------------------------------------
+{
+    std::unique_lock<std::shared_mutex> Lock(m_Mutex);
+    if (!IsOpen ())
+        return false;
+
+    // record image
+    CRecord Record;
+    Record.nMagic = RECORDMAGIC;
+    Record.nKind = static_cast<unsigned int>(Kind);
+    Record.nHash = RecordHash (Kind, nVKey);
+    Record.nKeys = static_cast<unsigned int>(nVKey.size());
+    Record.nValues = static_cast<unsigned int>(fVValue.size());
+    size_t nKeyBytes = nVKey.size()*sizeof(long long);
+    size_t nValueBytes = fVValue.size()*sizeof(float);
+    size_t nBytes = sizeof(CRecord) + nKeyBytes + nValueBytes;
+    nBytes = (nBytes + 7) & ~static_cast<size_t>(7);
+    std::vector<unsigned char> cVBuffer(nBytes, 0);
+    unsigned char* pBody = cVBuffer.data() + sizeof(CRecord);
+    if (nKeyBytes > 0)
+        std::memcpy (pBody, nVKey.data(), nKeyBytes);
+    if (nValueBytes > 0)
+        std::memcpy (pBody + nKeyBytes, fVValue.data(), nValueBytes);
+    Record.nChecksum = Checksum (pBody, nKeyBytes + nValueBytes);
+    std::memcpy (cVBuffer.data(), &Record, sizeof(CRecord));
+
+    if (!AcquireWriter ())
+        return false;
+
+    // records other writers appended may hold the same key
+    std::vector<float> fVFound;
+    Refresh ();
+    if (Lookup (Kind, Record.nHash, nVKey, fVFound))
+    {
+        ReleaseWriter ();
+        return true;
+    }
+
+    // record first (on disk), then the committed length
+    unsigned long long nCommitted = 0;
+    bool bOK = ReadAt (offsetof(CHeader, nCommitted), &nCommitted,
+                       sizeof(nCommitted)) &&
+               WriteAt (HEADERSIZE + nCommitted, cVBuffer.data(), nBytes) &&
+               Sync ();
+    if (bOK)
+    {
+        nCommitted += nBytes;
+        bOK = WriteAt (offsetof(CHeader, nCommitted), &nCommitted,
+                       sizeof(nCommitted));
+    }
+    ReleaseWriter ();
+
+    Refresh ();
+    return bOK;
+}
+
+void CDiskCache::Refresh ()
+// ---------------------------------------------------------------------------
+// Function: maps the committed part of the file and indexes the records
+//           added since the last refresh. a record that fails its checks
+//           is skipped by its length; if its length does not fit in the
+//           committed part the rest of it is skipped, since the next
+//           writer appends at the committed length. the exclusive side of
+//           m_Mutex must be held
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    unsigned long long nCommitted = 0;
+    if (!ReadAt (offsetof(CHeader, nCommitted), &nCommitted, sizeof(nCommitted)))
+        return;
+    unsigned long long nSize = HEADERSIZE + nCommitted;
+    if (nSize > FileSize ())
+        return;
+    if (nSize > m_nViewSize || m_pView == nullptr)
+    {
+        Unmap ();
+        if (!Map (nSize))
+            return;
+    }
+
+    while (m_nIndexed + sizeof(CRecord) <= nCommitted)
+    {
+        const unsigned char* pRecord = m_pView + HEADERSIZE + m_nIndexed;
+        CRecord Record;
+        std::memcpy (&Record, pRecord, sizeof(CRecord));
+        unsigned long long nBody = static_cast<unsigned long long>(Record.nKeys)*sizeof(long long) +
+                                   static_cast<unsigned long long>(Record.nValues)*sizeof(float);
+        unsigned long long nBytes = (sizeof(CRecord) + nBody + 7) & ~7ULL;
+        if (m_nIndexed + nBytes > nCommitted)
+            break;
+        if (Record.nMagic == RECORDMAGIC &&
+            Checksum (pRecord + sizeof(CRecord), static_cast<size_t>(nBody)) ==
+            Record.nChecksum)
+            m_Index.emplace (Record.nHash, m_nIndexed);
+        m_nIndexed += nBytes;
+    }
+    m_nIndexed = nCommitted;
+    m_nCommitted = nCommitted;
+}
+
+unsigned long long CDiskCache::MappedCommitted () const
+// ---------------------------------------------------------------------------
+// Function: committed length as currently published in the mapped header
+//           (the header is always in the view, and a shared mapping shows
+//           the writes of other runs without a system call). m_Mutex must
+//           be held (either side)
+// Input:    none
+// Output:   # of committed record bytes
+// ---------------------------------------------------------------------------
+{
+    if (m_pView == nullptr)
+        return ~0ULL;
+    const volatile unsigned long long* pCommitted =
+        reinterpret_cast<const volatile unsigned long long*>(
+            m_pView + offsetof(CHeader, nCommitted));
+    return *pCommitted;
+}
+
+bool CDiskCache::Lookup (const KIND Kind, const unsigned long long nHash,
+                         const std::vector<long long>& nVKey,
+                         std::vector<float>& fVValue) const
+// ---------------------------------------------------------------------------
+// Function: searches the indexed records. m_Mutex must be held (either
+//           side)
+// Input:    result kind, record hash, canonical key
+// Output:   returns true if found, fVValue is the packed result
+// ---------------------------------------------------------------------------
+{
+    auto Range = m_Index.equal_range (nHash);
+    for (auto Entry = Range.first; Entry != Range.second; ++Entry)
+    {
+        const unsigned char* pRecord = m_pView + HEADERSIZE + Entry->second;
+        CRecord Record;
+        std::memcpy (&Record, pRecord, sizeof(CRecord));
+        if (Record.nKind != static_cast<unsigned int>(Kind) ||
+            Record.nKeys != nVKey.size())
+            continue;
+        size_t nKeyBytes = nVKey.size()*sizeof(long long);
+        const unsigned char* pBody = pRecord + sizeof(CRecord);
+        if (nKeyBytes > 0 && std::memcmp (pBody, nVKey.data(), nKeyBytes) != 0)
+            continue;
+        fVValue.resize (Record.nValues);
+        if (Record.nValues > 0)
+            std::memcpy (fVValue.data(), pBody + nKeyBytes,
+                         Record.nValues*sizeof(float));
+        return true;
+    }
+    return false;
+}
+
+unsigned long long CDiskCache::RecordHash (const KIND Kind,
+                                           const std::vector<long long>& nVKey)
+// ---------------------------------------------------------------------------
+// Function: hash of a record (the result kind is mixed into the key hash)
+// Input:    result kind, canonical key
+// Output:   hash value
+// ---------------------------------------------------------------------------
+{
+    return CCapacityCache::Hash (nVKey) ^
+           (static_cast<unsigned long long>(Kind) * 0x9E3779B97F4A7C15ULL);
+}
+
+unsigned long long CDiskCache::Checksum (const unsigned char* pData,
+                                         const size_t nBytes)
+// ---------------------------------------------------------------------------
+// Function: 64-bit FNV-1a checksum of a record body
+// Input:    data, # of bytes
+// Output:   checksum
+// ---------------------------------------------------------------------------
+{
+    unsigned long long nHash = 14695981039346656037ULL;
+    for (size_t i = 0; i < nBytes; i++)
+    {
+        nHash ^= pData[i];
+        nHash *= 1099511628211ULL;
+    }
+    return nHash;
+}
+
+bool CDiskCache::Map (const unsigned long long nSize)
+// ---------------------------------------------------------------------------
+// Function: maps the first nSize bytes of the file read-only
+// Input:    # of bytes
+// Output:   returns true if mapped
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    HANDLE hMapping = CreateFileMappingA (static_cast<HANDLE>(m_hFile), NULL,
+                                          PAGE_READONLY,
+                                          static_cast<DWORD>(nSize >> 32),
+                                          static_cast<DWORD>(nSize & 0xFFFFFFFFULL),
+                                          NULL);
+    if (hMapping == NULL)
+        return false;
+    void* pView = MapViewOfFile (hMapping, FILE_MAP_READ, 0, 0,
+                                 static_cast<SIZE_T>(nSize));
+    if (pView == NULL)
+    {
+        CloseHandle (hMapping);
+        return false;
+    }
+    m_hMapping = hMapping;
+#else
+    void* pView = mmap (nullptr, static_cast<size_t>(nSize), PROT_READ,
+                        MAP_SHARED, m_nFile, 0);
+    if (pView == MAP_FAILED)
+        return false;
+#endif
+    m_pView = static_cast<const unsigned char*>(pView);
+    m_nViewSize = nSize;
+    return true;
+}
+
+void CDiskCache::Unmap ()
+// ---------------------------------------------------------------------------
+// Function: releases the view of the file
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_pView == nullptr)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile (m_pView);
+    CloseHandle (static_cast<HANDLE>(m_hMapping));
+    m_hMapping = nullptr;
+#else
+    munmap (const_cast<unsigned char*>(m_pView), static_cast<size_t>(m_nViewSize));
+#endif
+    m_pView = nullptr;
+    m_nViewSize = 0;
+}
+
+bool CDiskCache::AcquireWriter ()
+// ---------------------------------------------------------------------------
+// Function: takes the writer lock (blocks until it is free). on Windows a
+//           byte far past the end of the file is locked so that readers
+//           of the records are never blocked
+// Input:    none
+// Output:   returns true if the lock is held
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    OVERLAPPED Overlapped = {};
+    Overlapped.Offset = 0xFFFFFFFE;
+    Overlapped.OffsetHigh = 0x7FFFFFFF;
+    return LockFileEx (static_cast<HANDLE>(m_hFile), LOCKFILE_EXCLUSIVE_LOCK,
+                       0, 1, 0, &Overlapped) != 0;
+#else
+    return flock (m_nFile, LOCK_EX) == 0;
+#endif
+}
+
+void CDiskCache::ReleaseWriter ()
+// ---------------------------------------------------------------------------
+// Function: releases the writer lock
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    OVERLAPPED Overlapped = {};
+    Overlapped.Offset = 0xFFFFFFFE;
+    Overlapped.OffsetHigh = 0x7FFFFFFF;
+    UnlockFileEx (static_cast<HANDLE>(m_hFile), 0, 1, 0, &Overlapped);
+#else
+    flock (m_nFile, LOCK_UN);
+#endif
+}
+
+unsigned long long CDiskCache::FileSize () const
+// ---------------------------------------------------------------------------
+// Function: current size of the file
+// Input:    none
+// Output:   # of bytes (0 on error)
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    LARGE_INTEGER nSize;
+    if (!GetFileSizeEx (static_cast<HANDLE>(m_hFile), &nSize))
+        return 0;
+    return static_cast<unsigned long long>(nSize.QuadPart);
+#else
+    struct stat Stat;
+    if (fstat (m_nFile, &Stat) != 0)
+        return 0;
+    return static_cast<unsigned long long>(Stat.st_size);
+#endif
+}
+
+bool CDiskCache::ReadAt (const unsigned long long nOffset, void* pData,
+                         const size_t nBytes) const
+// ---------------------------------------------------------------------------
+// Function: reads bytes at an offset of the file
+// Input:    offset, # of bytes
+// Output:   returns true if all bytes were read, pData holds them
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    OVERLAPPED Overlapped = {};
+    Overlapped.Offset = static_cast<DWORD>(nOffset & 0xFFFFFFFFULL);
+    Overlapped.OffsetHigh = static_cast<DWORD>(nOffset >> 32);
+    DWORD nRead = 0;
+    return ReadFile (static_cast<HANDLE>(m_hFile), pData,
+                     static_cast<DWORD>(nBytes), &nRead, &Overlapped) &&
+           nRead == nBytes;
+#else
+    return pread (m_nFile, pData, nBytes, static_cast<off_t>(nOffset)) ==
+           static_cast<ssize_t>(nBytes);
+#endif
+}
+
+bool CDiskCache::WriteAt (const unsigned long long nOffset, const void* pData,
+                          const size_t nBytes)
+// ---------------------------------------------------------------------------
+// Function: writes bytes at an offset of the file
+// Input:    offset, data, # of bytes
+// Output:   returns true if all bytes were written
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    OVERLAPPED Overlapped = {};
+    Overlapped.Offset = static_cast<DWORD>(nOffset & 0xFFFFFFFFULL);
+    Overlapped.OffsetHigh = static_cast<DWORD>(nOffset >> 32);
+    DWORD nWritten = 0;
+    return WriteFile (static_cast<HANDLE>(m_hFile), pData,
+                      static_cast<DWORD>(nBytes), &nWritten, &Overlapped) &&
+           nWritten == nBytes;
+#else
+    return pwrite (m_nFile, pData, nBytes, static_cast<off_t>(nOffset)) ==
+           static_cast<ssize_t>(nBytes);
+#endif
+}
+
+bool CDiskCache::Sync ()
+// ---------------------------------------------------------------------------
+// Function: flushes the data written so far to disk
+// Input:    none
+// Output:   returns true if flushed
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    return FlushFileBuffers (static_cast<HANDLE>(m_hFile)) != 0;
+#elif defined(__APPLE__)
+    return fsync (m_nFile) == 0;
+#else
+    return fdatasync (m_nFile) == 0;
+#endif
+}
+
+bool CDiskCache::IsOpen () const
+// ---------------------------------------------------------------------------
+// Function: checks whether a cache file is open
+// Input:    none
+// Output:   true if open
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    return m_hFile != nullptr;
+#else
+    return m_nFile >= 0;
+#endif
+}
+
+int CDiskCache::GetNumRecords () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of records indexed so far
+// Input:    none
+// Output:   # of records
+// ---------------------------------------------------------------------------
+{
+    std::shared_lock<std::shared_mutex> Lock(m_Mutex);
+    return static_cast<int>(m_Index.size());
+}
+
+long CDiskCache::GetNumHits () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of successful lookups
+// Input:    none
+// Output:   # of hits
+// ---------------------------------------------------------------------------
+{
+    return m_nHits;
+}
+
+long CDiskCache::GetNumMisses () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of failed lookups
+// Input:    none
+// Output:   # of misses
+// ---------------------------------------------------------------------------
+{
+    return m_nMisses;
+}
+
+const std::string& CDiskCache::GetFileName () const
+// ---------------------------------------------------------------------------
+// Function: gets the name of the cache file
+// Input:    none
+// Output:   file name (empty if no file is open)
+// ---------------------------------------------------------------------------
+{
+    return m_strFileName;
+}
+
+CDiskCache& CDiskCache::GetDefault ()
+// ---------------------------------------------------------------------------
+// Function: gets the cache shared by all elements of the run
+// Input:    none
+// Output:   default cache
+// ---------------------------------------------------------------------------
+{
+    static CDiskCache Default;
+    return Default;
+}
+
+void CDiskCache::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
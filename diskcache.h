@@ -0,0 +1,143 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Persistent section results shared between runs.
+The cache file is an append-only log of records,
+each holding a canonical section key (type,
+dimensions, material data and bar set as built
+by CCapacityCache::CanonicalKey), a result kind
+and the result packed as floats. A lookup hashes
+the key, finds the record through an index of the
+memory-mapped file and compares the full key, so
+records are content-addressed and never updated.
+
+File layout:
+  header (HEADERSIZE bytes): magic, version,
+      header size, committed length
+  record: magic, kind, key hash, # of keys,
+      # of values, checksum, keys (64-bit),
+      values (32-bit), padding to 8 bytes
+
+Protocol: readers need no lock. They map the file
+read-only and use only the records within the
+committed length (a record must also pass its
+checksum; one that fails is skipped). A writer
+takes an exclusive lock on the file, appends the
+record, flushes it to disk and only then advances
+the committed length, so a reader never sees a
+partial record and an interrupted write is
+overwritten by the next writer. Within a run,
+lookups share the index and take the exclusive
+side of m_Mutex only to index new records, which
+they detect from the committed length in the
+mapped header.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include "LocalErrorHandler.h"
+
+class CDiskCache
+{
+    public:
+        CDiskCache ();   // ctor
+        ~CDiskCache ();  // dtor
+
+        enum class KIND { CAPACITY = 1, INTERACTION = 2, SURFACE = 3,
+                          MOMENTCURVATURE = 4 };
+        static const int VERSION = 3;      // file format version (and result meaning)
+        static const int HEADERSIZE = 64;  // bytes before the first record
+
+        // helper functions
+        void Open (const std::string& strFileName);
+        void Close ();
+        bool Find (const KIND Kind, const std::vector<long long>& nVKey,
+                   std::vector<float>& fVValue);
+        bool Insert (const KIND Kind, const std::vector<long long>& nVKey,
+                     const std::vector<float>& fVValue);
+
+        // accessor functions
+        bool IsOpen () const;
+        int  GetNumRecords () const;
+        long GetNumHits () const;
+        long GetNumMisses () const;
+        const std::string& GetFileName () const;
+        static CDiskCache& GetDefault ();
+
+    private:
+        struct CHeader
+        {
+            char szMagic[8];                  // "XSDCACHE"
+            unsigned int nVersion;            // VERSION
+            unsigned int nHeaderSize;         // HEADERSIZE
+            unsigned long long nCommitted;    // bytes of records after the header
+            unsigned char cPad[HEADERSIZE-24];
+        };
+        struct CRecord
+        {
+            unsigned int nMagic;              // RECORDMAGIC
+            unsigned int nKind;               // KIND
+            unsigned long long nHash;         // hash of kind and key
+            unsigned int nKeys;               // # of key values
+            unsigned int nValues;             // # of result values
+            unsigned long long nChecksum;     // checksum of keys and values
+        };
+        static const unsigned int RECORDMAGIC = 0x31525358; // "XSR1"
+
+        std::string m_strFileName;            // cache file
+#ifdef _WIN32
+        void* m_hFile;                        // file handle
+        void* m_hMapping;                     // file mapping handle
+#else
+        int   m_nFile;                        // file descriptor
+#endif
+        const unsigned char* m_pView;         // read-only view of the file
+        unsigned long long m_nViewSize;       // bytes mapped
+        unsigned long long m_nIndexed;        // record bytes indexed so far
+        unsigned long long m_nCommitted;      // committed length at the last refresh
+        std::unordered_multimap<unsigned long long,
+                                unsigned long long> m_Index; // hash -> record offset
+        mutable std::shared_mutex m_Mutex;    // guards the view and the index
+        std::atomic<long> m_nHits;            // # of successful lookups
+        std::atomic<long> m_nMisses;          // # of failed lookups
+
+        void Refresh ();
+        void CloseFile ();
+        unsigned long long MappedCommitted () const;
+        bool Lookup (const KIND Kind, const unsigned long long nHash,
+                     const std::vector<long long>& nVKey,
+                     std::vector<float>& fVValue) const;
+        static unsigned long long RecordHash (const KIND Kind,
+                                              const std::vector<long long>& nVKey);
+        static unsigned long long Checksum (const unsigned char* pData,
+                                            const size_t nBytes);
+
+        // file primitives (Win32 or POSIX)
+        bool Map (const unsigned long long nSize);
+        void Unmap ();
+        bool AcquireWriter ();
+        void ReleaseWriter ();
+        unsigned long long FileSize () const;
+        bool ReadAt (const unsigned long long nOffset, void* pData,
+                     const size_t nBytes) const;
+        bool WriteAt (const unsigned long long nOffset, const void* pData,
+                      const size_t nBytes);
+        bool Sync ();
+
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+
+        // no copies
+        CDiskCache (const CDiskCache&) = delete;
+        CDiskCache& operator= (const CDiskCache&) = delete;
+};
@@ -12,6 +12,9 @@ Object-Oriented Numerical Analysis
 Implementation of the CElement class.
 
 *********************************************/
+#include <cfloat>
+#include <cmath>
+#include <limits>
 #include "element.h"
 #include "MatToolBox.h"
 #include "constants.h"
@@ -25,11 +28,24 @@ CElement::CElement ()
 // ---------------------------------------------------------------------------
 {
     m_nDOF = m_nLineNumber = m_nElementLoads = 0;
+    m_nXSR = m_nTR = 0;
     m_nDebugLevel = 0;
     m_strDelimiters = "\t, "; // tab space and comma delimited file
     m_strComment = "**";
     m_fLength = 0.0f;
     m_Type = CElement::ElementType::COLUMN;
+    m_fMaxAxial = m_fAxialLoc = m_fMaxShear = m_fShearLoc = 0.0f;
+    m_fMaxMoment = m_fMomentLoc = 0.0f;
+    m_fMn = m_fPhiMn = m_fPhi = m_fNADepth = m_fEpsT = 0.0f;
+    m_bFiberModel = false;
+    m_pPool = &CThreadPool::GetDefault();
+    m_pCache = nullptr;
+    m_Fingerprint = CAnalysisCache::CFingerprint{0, 0, 0};
+    m_nReused = 0;
+    m_pDiskCache = nullptr;
+    m_nDiskHits = 0;
+    m_bBinaryInput = false;
+    m_bTimestamps = true;
 }
 
 CElement::~CElement ()
@@ -39,6 +55,9 @@ CElement::~CElement ()
 // Output:   none
 // ---------------------------------------------------------------------------
 {
+    // release the cross-section objects
+    for (int i = 1; i <= m_EPData.GetSize(); i++)
+        delete m_EPData(i);
 }
 
 void CElement::Analyze()
@@ -52,48 +71,795 @@ void CElement::Analyze()
     Timer.MarkTime();
     Timer.GetDateTime(m_strDateTime);
 
-    // read the problem size
-    ReadProblemSize();
-
     // set problem size
     SetSize();
 
-    // read nodal and element data
-    ReadModel();
+    // read nodal and element data (one pass; sizes the bar data). A job
+    // with input errors lists them in its output file and goes no further.
+    try
+    {
+        if (m_bBinaryInput)
+            ReadBinary();
+        else
+            ReadModel(m_FileInput);
+    }
+    catch (CLocalErrorHandler::ERRORCODE&)
+    {
+        m_Diagnostics.Write(m_FileOutput);
+        throw;
+    }
 
-    // find Mu/phi
-    FindMomentCapcity();
+    AnalyzeSection();
 
     // create output file
     Timer.GetDateTime(m_strEndDateTime);
-    CreateOutput();
+    CreateOutput(m_FileOutput);
+}
+
+void CElement::ParseModel(std::istream& Input, CBinarySection::CModel& Model)
+// ---------------------------------------------------------------------------
+// Function: reads one section from a text input stream without analyzing
+//           it (parse stage of the streaming pipeline)
+// Input:    input stream
+// Output:   model
+// ---------------------------------------------------------------------------
+{
+    SetSize();
+    ReadModel(Input);
+    if (m_EPData(1) == nullptr)
+        ErrorHandler(CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    GetModel(Model);
+}
+
+void CElement::AnalyzeModel(const CBinarySection::CModel& Model,
+                            std::ostream& OF)
+// ---------------------------------------------------------------------------
+// Function: analyzes a section that has already been read and writes its
+//           results (analysis stage of the streaming pipeline)
+// Input:    model, output stream
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Timer.MarkTime();
+    Timer.GetDateTime(m_strDateTime);
+
+    SetSize();
+    SetModel(Model);
+    AnalyzeSection();
+
+    Timer.GetDateTime(m_strEndDateTime);
+    CreateOutput(OF);
+}
+
+void CElement::AnalyzeSection()
+// ---------------------------------------------------------------------------
+// Function: runs the section checks on the model that has been read
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    // results of an earlier analysis of the same section
+    m_nReused = 0;
+    m_nDiskHits = 0;
+    if (m_pCache != nullptr)
+    {
+        ComputeFingerprint();
+        m_pCached = m_pCache->GetEntry(m_Fingerprint);
+    }
+
+    // find Mu/phi
+    FindMomentCapcity();
+
+    // moment-curvature response at the design axial load
+    ComputeMomentCurvature();
+
+    // shear strength and stirrup spacing
+    ComputeShear();
+
+    // interaction diagram and biaxial surface for columns
+    if (m_Type == ElementType::COLUMN)
+    {
+        ComputeInteractionDiagram();
+        ComputeInteractionSurface();
+    }
+
+    // cheapest section for the demands
+    if (m_Designer.IsDefined())
+        DesignSection();
 }
 
 void CElement::FindMomentCapcity()
 // ---------------------------------------------------------------------------
-// Function: Calculates the moment capacity of the element
+// Function: Calculates the moment capacity of the element. Rectangular,
+//           T and circular sections use the closed-form stress block
+//           selected at compile time; other shapes use the fiber model.
+//           Beams are checked in pure flexure and columns on the design
+//           curve where phi*Pn equals the maximum factored axial load.
 // Input:    none
 // Output:   none
 // ---------------------------------------------------------------------------
 {
-    float As, fc, fy;
-    fc = m_ConcMatData(1).GetCompStr();
+    float fc, fy, fEs;
+    fc = m_ConcMatData(1).GetCompStr() / 1000.0f; // psi -> ksi
     fy = m_ReMatData(1).GetYieldStr();
+    fEs = m_ReMatData(1).GetYM();
 
     CXSType* pXSGrp;
     CXSType::EPType myType;
-    CVector<float> fV(MAXEPDIM);
     pXSGrp = m_EPData(1);
     pXSGrp->GetType(myType);
-    pXSGrp->GetDimensions(fV);
 
-	delete pXSGrp;
+    // materials for phi and for the fiber model (meshed on demand)
+    m_Fibers.SetMaterials(fc, fy, fEs);
+    m_Fibers.SetSpiral(myType == CXSType::EPType::CIRCS);
+    m_bFiberModel = false;
+
+    float fP = DesignAxialLoad();
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        auto Entry = m_pCached->Capacity.find(CAnalysisCache::LoadKey(fP));
+        if (Entry != m_pCached->Capacity.end())
+        {
+            const CAnalysisCache::CCapacity& Cap = Entry->second;
+            m_fMn = Cap.fMn;
+            m_fPhiMn = Cap.fPhiMn;
+            m_fPhi = Cap.fPhi;
+            m_fNADepth = Cap.fC;
+            m_fEpsT = Cap.fEpsT;
+            m_nReused++;
+            return;
+        }
+    }
+
+    // results of earlier runs
+    std::vector<long long> nVKey;
+    std::vector<float> fVValue;
+    if (m_pDiskCache != nullptr)
+    {
+        DiskKey(CDiskCache::KIND::CAPACITY, fP, 0, 0, nVKey);
+        if (m_pDiskCache->Find(CDiskCache::KIND::CAPACITY, nVKey, fVValue) &&
+            fVValue.size() == 5)
+        {
+            m_fMn = fVValue[0];
+            m_fPhiMn = fVValue[1];
+            m_fPhi = fVValue[2];
+            m_fNADepth = fVValue[3];
+            m_fEpsT = fVValue[4];
+            m_nDiskHits++;
+        }
+        else
+            fVValue.clear();
+    }
+
+    if (fVValue.empty())
+    {
+        if (myType == CXSType::EPType::RECTS)
+            WhitneyCapacity<CXSType::EPType::RECTS>(*pXSGrp, fc, fy, fEs, fP);
+        else if (myType == CXSType::EPType::TSECTION)
+            WhitneyCapacity<CXSType::EPType::TSECTION>(*pXSGrp, fc, fy, fEs, fP);
+        else if (myType == CXSType::EPType::CIRCS)
+            WhitneyCapacity<CXSType::EPType::CIRCS>(*pXSGrp, fc, fy, fEs, fP);
+        else
+        {
+            BuildFiberModel();
+            m_Fibers.FindMomentCapacity(fP, m_fMn, m_fPhiMn, m_fNADepth,
+                                        m_fEpsT, m_fPhi);
+        }
+        if (m_pDiskCache != nullptr)
+            m_pDiskCache->Insert(CDiskCache::KIND::CAPACITY, nVKey,
+                                 {m_fMn, m_fPhiMn, m_fPhi, m_fNADepth, m_fEpsT});
+    }
+
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        m_pCached->Capacity[CAnalysisCache::LoadKey(fP)] =
+            CAnalysisCache::CCapacity{m_fMn, m_fPhiMn, m_fPhi, m_fNADepth, m_fEpsT};
+    }
+}
+
+template <CXSType::EPType TYPE>
+void CElement::WhitneyCapacity(const CXSType& XS, const float fFc,
+                               const float fFy, const float fEs,
+                               const float fP)
+// ---------------------------------------------------------------------------
+// Function: moment capacity from the closed-form stress block of a
+//           standard section type
+// Input:    cross-section, f'c, fy and Es (ksi), axial load
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CWhitneySection<TYPE> Section(XS, fFc, fFy, fEs);
+    if (m_nXSR > 0)
+        Section.AddBars(m_ReData(1));
+    Section.FindMomentCapacity(fP, m_Fibers, m_fMn, m_fPhiMn, m_fNADepth,
+                               m_fEpsT, m_fPhi);
+}
+
+void CElement::BuildFiberModel()
+// ---------------------------------------------------------------------------
+// Function: meshes the section and adds the bars the first time the
+//           fiber model is needed. FindMomentCapcity sets the materials.
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_bFiberModel)
+        return;
+    m_Fibers.Mesh(*m_EPData(1));
+    if (m_nXSR > 0)
+        m_Fibers.AddBars(m_ReData(1));
+    m_bFiberModel = true;
+}
+
+void CElement::ComputeInteractionDiagram(const int nPoints)
+// ---------------------------------------------------------------------------
+// Function: builds the axial load - moment interaction diagram of the
+//           section. The points are computed concurrently on the
+//           element's thread pool. FindMomentCapcity must have built the fiber model.
+// Input:    # of points on the diagram
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        if (m_pCached->nInteractionPoints == nPoints)
+        {
+            m_Interaction = m_pCached->Interaction;
+            m_nReused++;
+            return;
+        }
+    }
+
+    std::vector<long long> nVKey;
+    std::vector<float> fVValue;
+    bool bFound = false;
+    if (m_pDiskCache != nullptr)
+    {
+        DiskKey(CDiskCache::KIND::INTERACTION, 0.0f, nPoints, 0, nVKey);
+        bFound = m_pDiskCache->Find(CDiskCache::KIND::INTERACTION, nVKey,
+                                    fVValue) &&
+                 m_Interaction.Unpack(fVValue);
+    }
+
+    if (bFound)
+        m_nDiskHits++;
+    else
+    {
+        BuildFiberModel();
+        m_Fibers.ComputeInteraction(m_Interaction, nPoints,
+                                    *m_pPool);
+        if (m_pDiskCache != nullptr)
+        {
+            m_Interaction.Pack(fVValue);
+            m_pDiskCache->Insert(CDiskCache::KIND::INTERACTION, nVKey, fVValue);
+        }
+    }
+
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        m_pCached->Interaction = m_Interaction;
+        m_pCached->nInteractionPoints = nPoints;
+    }
+}
+
+const CInteractionDiagram& CElement::GetInteractionDiagram() const
+// ---------------------------------------------------------------------------
+// Function: gets the interaction diagram computed by
+//           ComputeInteractionDiagram
+// Input:    none
+// Output:   interaction diagram
+// ---------------------------------------------------------------------------
+{
+    return m_Interaction;
+}
+
+void CElement::ComputeMomentCurvature(const int nSteps,
+                                      const bool bWarmStart)
+// ---------------------------------------------------------------------------
+// Function: computes the moment-curvature response of the section at
+//           the axial load used for the capacity check (the maximum
+//           axial load for columns, zero for beams). FindMomentCapcity
+//           must have built the fiber model.
+// Input:    # of curvature steps, warm start flag
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    float fP = DesignAxialLoad();
+    std::pair<long long, int> Key(CAnalysisCache::LoadKey(fP),
+                                  bWarmStart ? nSteps : -nSteps);
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        auto Entry = m_pCached->MomentCurvature.find(Key);
+        if (Entry != m_pCached->MomentCurvature.end())
+        {
+            m_MomentCurvature = Entry->second;
+            m_nReused++;
+            return;
+        }
+    }
+
+    std::vector<long long> nVKey;
+    std::vector<float> fVValue;
+    bool bFound = false;
+    if (m_pDiskCache != nullptr)
+    {
+        DiskKey(CDiskCache::KIND::MOMENTCURVATURE, fP, nSteps,
+                bWarmStart ? 1 : 0, nVKey);
+        bFound = m_pDiskCache->Find(CDiskCache::KIND::MOMENTCURVATURE, nVKey,
+                                    fVValue) &&
+                 m_MomentCurvature.Unpack(fVValue);
+    }
+
+    if (bFound)
+        m_nDiskHits++;
+    else
+    {
+        BuildFiberModel();
+        m_Fibers.ComputeMomentCurvature(fP, nSteps, bWarmStart,
+                                        m_MomentCurvature);
+        if (m_pDiskCache != nullptr)
+        {
+            m_MomentCurvature.Pack(fVValue);
+            m_pDiskCache->Insert(CDiskCache::KIND::MOMENTCURVATURE, nVKey,
+                                 fVValue);
+        }
+    }
+
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        m_pCached->MomentCurvature[Key] = m_MomentCurvature;
+    }
+}
+
+const CMomentCurvature& CElement::GetMomentCurvature() const
+// ---------------------------------------------------------------------------
+// Function: gets the curve computed by ComputeMomentCurvature
+// Input:    none
+// Output:   moment-curvature response
+// ---------------------------------------------------------------------------
+{
+    return m_MomentCurvature;
+}
+
+void CElement::ComputeInteractionSurface(const int nAngles,
+                                         const int nDepths)
+// ---------------------------------------------------------------------------
+// Function: builds the biaxial P-Mx-My interaction surface with the
+//           neutral axis rotated in equal steps through 360 degrees. The
+//           sweeps run concurrently on the element's thread pool.
+//           FindMomentCapcity must have built the fiber model.
+// Input:    # of neutral axis angles, # of points per depth sweep
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::vector<float> fVAngles(static_cast<size_t>(std::max(nAngles, 0)));
+    for (int i = 0; i < nAngles; i++)
+        fVAngles[static_cast<size_t>(i)] = static_cast<float>(2.0*PI*i/nAngles);
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        if (m_pCached->nSurfaceAngles == nAngles &&
+            m_pCached->nSurfaceDepths == nDepths)
+        {
+            m_Surface = m_pCached->Surface;
+            m_nReused++;
+            return;
+        }
+    }
+
+    std::vector<long long> nVKey;
+    std::vector<float> fVValue;
+    bool bFound = false;
+    if (m_pDiskCache != nullptr)
+    {
+        DiskKey(CDiskCache::KIND::SURFACE, 0.0f, nAngles, nDepths, nVKey);
+        bFound = m_pDiskCache->Find(CDiskCache::KIND::SURFACE, nVKey,
+                                    fVValue) &&
+                 m_Surface.Unpack(fVValue);
+    }
+
+    if (bFound)
+        m_nDiskHits++;
+    else
+    {
+        BuildFiberModel();
+        m_Fibers.ComputeSurface(m_Surface, fVAngles, nDepths,
+                                *m_pPool);
+        if (m_pDiskCache != nullptr)
+        {
+            m_Surface.Pack(fVValue);
+            m_pDiskCache->Insert(CDiskCache::KIND::SURFACE, nVKey, fVValue);
+        }
+    }
+
+    if (m_pCached)
+    {
+        std::lock_guard<std::mutex> Lock(m_pCached->Mutex);
+        m_pCached->Surface = m_Surface;
+        m_pCached->nSurfaceAngles = nAngles;
+        m_pCached->nSurfaceDepths = nDepths;
+    }
+}
+
+const CInteractionSurface& CElement::GetInteractionSurface() const
+// ---------------------------------------------------------------------------
+// Function: gets the surface computed by ComputeInteractionSurface
+// Input:    none
+// Output:   interaction surface
+// ---------------------------------------------------------------------------
+{
+    return m_Surface;
+}
+
+void CElement::ComputeShear()
+// ---------------------------------------------------------------------------
+// Function: computes the shear strength of the section and the stirrup
+//           spacing required along the member from the maximum shear
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    float fPu, fAxialLoc, fVu, fShearLoc, fMaxMoment, fMomentLoc;
+    m_ElementData(1).GetMaxValues(fPu, fAxialLoc, fVu, fShearLoc,
+                                  fMaxMoment, fMomentLoc);
+    m_Shear.SetSection(*m_EPData(1));
+    if (m_nXSR > 0)
+        m_Shear.SetBars(m_ReData(1));
+    for (int i = 1; i <= m_nTR; i++)
+        m_Shear.AddStirrup(m_TransReData(i));
+    m_Shear.SetMaterials(m_ConcMatData(1).GetCompStr() / 1000.0f,
+                         m_ReMatData(1).GetYieldStr());
+    m_Shear.SetDemands(m_Type == ElementType::COLUMN, fPu, fVu, fShearLoc,
+                       fMomentLoc);
+    m_Shear.Compute();
+}
+
+const CShearDesign& CElement::GetShearDesign() const
+// ---------------------------------------------------------------------------
+// Function: gets the results of ComputeShear
+// Input:    none
+// Output:   shear design
+// ---------------------------------------------------------------------------
+{
+    return m_Shear;
+}
+
+void CElement::DesignSection()
+// ---------------------------------------------------------------------------
+// Function: searches the ranges of the *DESIGN block for the cheapest
+//           section that carries the maximum values. The candidates are
+//           evaluated on the element's thread pool and their capacities
+//           are shared through the default capacity table.
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    float fPu, fAxialLoc, fMaxShear, fShearLoc, fMu, fMomentLoc;
+    m_ElementData(1).GetMaxValues(fPu, fAxialLoc, fMaxShear, fShearLoc,
+                                  fMu, fMomentLoc);
+    m_Designer.SetMaterials(m_ConcMatData(1).GetCompStr() / 1000.0f,
+                            m_ReMatData(1).GetYieldStr(),
+                            m_ReMatData(1).GetYM(),
+                            m_ReMatData(1).GetDensity());
+    m_Designer.SetDemands(fPu, fMu);
+    m_Designer.Design(*m_pPool, CCapacityCache::GetDefault());
+}
+
+const CSectionDesigner& CElement::GetSectionDesigner() const
+// ---------------------------------------------------------------------------
+// Function: gets the search run by DesignSection
+// Input:    none
+// Output:   section designer
+// ---------------------------------------------------------------------------
+{
+    return m_Designer;
+}
+
+void CElement::GetMomentCapacity(float& fMn, float& fPhiMn, float& fPhi,
+                                 float& fC, float& fEpsT) const
+// ---------------------------------------------------------------------------
+// Function: gets the results of FindMomentCapcity
+// Input:    variables to hold the results
+// Output:   Mn, phi*Mn, phi, neutral axis depth, net tensile strain
+// ---------------------------------------------------------------------------
+{
+    fMn = m_fMn;
+    fPhiMn = m_fPhiMn;
+    fPhi = m_fPhi;
+    fC = m_fNADepth;
+    fEpsT = m_fEpsT;
+}
+
+void CElement::GetRecord(CResultWriter::CRecord& Record) const
+// ---------------------------------------------------------------------------
+// Function: gets the results of the section checks as one record of the
+//           machine-readable results. A ratio is FLT_MAX if the section
+//           has no capacity for the demand and NaN if it was not checked.
+// Input:    none
+// Output:   record (source is the input file, section # is 1)
+// ---------------------------------------------------------------------------
+{
+    const char* szType[] = {"circular", "rectangular", "t"};
+    float fAxialLoc, fShearLoc, fMomentLoc;
+    m_ElementData(1).GetMaxValues(Record.fPu, fAxialLoc, Record.fVu,
+                                  fShearLoc, Record.fMu, fMomentLoc);
+    CXSType::EPType XSType;
+    m_EPData(1)->GetType(XSType);
+
+    Record.strSource = m_strInputName;
+    Record.nSection = 1;
+    Record.bError = false;
+    Record.strMessage.clear();
+    Record.strMember = (m_Type == ElementType::COLUMN) ? "column" : "beam";
+    Record.strType = szType[static_cast<int>(XSType)];
+    Record.fMn = m_fMn;
+    Record.fPhi = m_fPhi;
+    Record.fPhiMn = m_fPhiMn;
+    Record.fC = m_fNADepth;
+    Record.fEpsT = m_fEpsT;
+    float fVc, fVsMax;
+    m_Shear.GetStrengths(fVc, fVsMax);
+    Record.fPhiVc = CShearDesign::PHI*fVc;
+
+    // flexure at Pu
+    float fMu = std::fabs(Record.fMu);
+    Record.fFlexureDC = (fMu == 0.0f) ? 0.0f :
+                        (m_fPhiMn > 0.0f) ? fMu/m_fPhiMn : FLT_MAX;
+
+    // shear with the provided stirrups (concrete alone if none are given)
+    float fVu = std::fabs(Record.fVu);
+    if (m_Shear.GetNumProvided() > 0)
+    {
+        Record.fShearDC = 0.0f;
+        for (int i = 1; i <= m_Shear.GetNumProvided(); i++)
+        {
+            float fStart, fEnd, fS, fRatio;
+            m_Shear.GetProvided(i, fStart, fEnd, fS, fRatio);
+            Record.fShearDC = std::max(Record.fShearDC, fRatio);
+        }
+    }
+    else
+        Record.fShearDC = (fVu == 0.0f) ? 0.0f :
+                          (Record.fPhiVc > 0.0f) ? fVu/Record.fPhiVc : FLT_MAX;
+
+    // axial load and moment (columns)
+    Record.fPMDC = (m_Surface.GetNumAngles() > 0) ?
+                   m_Surface.GetCapacityRatio(Record.fPu, Record.fMu, 0.0f) :
+                   std::numeric_limits<float>::quiet_NaN();
 
+    // governing check
+    const char* szCheck[] = {"flexure", "shear", "pm"};
+    float fDC[] = {Record.fFlexureDC, Record.fShearDC, Record.fPMDC};
+    float fMax = -1.0f;
+    Record.strGoverning = "none";
+    for (int i = 0; i < 3; i++)
+    {
+        if (!std::isnan(fDC[i]) && fDC[i] > fMax)
+        {
+            fMax = fDC[i];
+            Record.strGoverning = szCheck[i];
+        }
+    }
+    Record.bOK = (fMax <= 1.0f);
+}
+
+const CDiagnostics& CElement::GetDiagnostics() const
+// ---------------------------------------------------------------------------
+// Function: gets the problems found in the input
+// Input:    none
+// Output:   diagnostics
+// ---------------------------------------------------------------------------
+{
+    return m_Diagnostics;
+}
+
+void CElement::ComputeFingerprint()
+// ---------------------------------------------------------------------------
+// Function: fingerprints the geometry, material and reinforcement blocks
+//           from the values read, so that an input that differs only in
+//           the demands (or in formatting) maps to the same section
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::vector<float> fVData;
+
+    // geometry
+    CXSType::EPType Type;
+    m_EPData(1)->GetType(Type);
+    CVectorN<float,MAXEPDIM> fVDims;
+    m_EPData(1)->GetDimensions(fVDims);
+    fVData.push_back(static_cast<float>(Type));
+    for (int i = 1; i <= MAXEPDIM; i++)
+        fVData.push_back(fVDims(i));
+    m_Fingerprint.nSection = CAnalysisCache::Fingerprint(fVData);
+
+    // concrete and reinforcement materials
+    fVData.clear();
+    fVData.push_back(m_ConcMatData(1).GetCompStr());
+    fVData.push_back(m_ConcMatData(1).GetDensity());
+    fVData.push_back(m_ConcMatData(1).GetPoisson());
+    fVData.push_back(m_ReMatData(1).GetYieldStr());
+    fVData.push_back(m_ReMatData(1).GetYM());
+    fVData.push_back(m_ReMatData(1).GetDensity());
+    m_Fingerprint.nMaterial = CAnalysisCache::Fingerprint(fVData);
+
+    // bars and transverse reinforcement polylines
+    fVData.clear();
+    float fDia, fX, fY;
+    fVData.push_back(static_cast<float>(m_nXSR));
+    if (m_nXSR > 0)
+    {
+        for (int i = 1; i <= m_ReData(1).GetNumBars(); i++)
+        {
+            m_ReData(1).GetBar(i, fDia, fX, fY);
+            fVData.push_back(fDia);
+            fVData.push_back(fX);
+            fVData.push_back(fY);
+        }
+    }
+    for (int i = 1; i <= m_nTR; i++)
+    {
+        fVData.push_back(m_TransReData(i).GetTieDiameter());
+        for (int j = 1; j <= m_TransReData(i).GetNumPoints(); j++)
+        {
+            m_TransReData(i).GetPoint(j, fX, fY);
+            fVData.push_back(fX);
+            fVData.push_back(fY);
+        }
+    }
+    m_Fingerprint.nReinforcement = CAnalysisCache::Fingerprint(fVData);
+}
+
+float CElement::DesignAxialLoad() const
+// ---------------------------------------------------------------------------
+// Function: axial load used for the section checks
+// Input:    none
+// Output:   maximum axial load for columns, zero for beams
+// ---------------------------------------------------------------------------
+{
+    float fP = 0.0f;
+    if (m_Type == ElementType::COLUMN)
+    {
+        float fAxialLoc, fMaxShear, fShearLoc, fMaxMoment, fMomentLoc;
+        m_ElementData(1).GetMaxValues(fP, fAxialLoc, fMaxShear, fShearLoc,
+                                      fMaxMoment, fMomentLoc);
+    }
+    return fP;
+}
+
+void CElement::DiskKey(const CDiskCache::KIND Kind, const float fP,
+                       const int nA, const int nB,
+                       std::vector<long long>& nVKey) const
+// ---------------------------------------------------------------------------
+// Function: builds the cache file key of a result: the canonical key of
+//           the section (type, dimensions, materials, axial load and bar
+//           set) followed by the result's own parameters. The biaxial
+//           surface depends on the sign of My, so its key is not
+//           mirrored.
+// Input:    result kind, axial load, result parameters (e.g. # of points)
+// Output:   key
+// ---------------------------------------------------------------------------
+{
+    CXSType::EPType Type;
+    m_EPData(1)->GetType(Type);
+    CVectorN<float,MAXEPDIM> fVDims;
+    m_EPData(1)->GetDimensions(fVDims);
+    float fDims[MAXEPDIM];
+    for (int i = 0; i < MAXEPDIM; i++)
+        fDims[i] = fVDims(i+1);
+
+    std::vector<float> fVDia, fVX, fVY;
+    float fDia, fX, fY;
+    if (m_nXSR > 0)
+    {
+        for (int i = 1; i <= m_ReData(1).GetNumBars(); i++)
+        {
+            m_ReData(1).GetBar(i, fDia, fX, fY);
+            fVDia.push_back(fDia);
+            fVX.push_back(fX);
+            fVY.push_back(fY);
+        }
+    }
+
+    CCapacityCache::CanonicalKey(Type, fDims,
+                                 m_ConcMatData(1).GetCompStr() / 1000.0f,
+                                 m_ReMatData(1).GetYieldStr(),
+                                 m_ReMatData(1).GetYM(), fP,
+                                 fVDia, fVX, fVY, nVKey,
+                                 Kind != CDiskCache::KIND::SURFACE);
+    nVKey.push_back(nA);
+    nVKey.push_back(nB);
+}
+
+const CAnalysisCache::CFingerprint& CElement::GetFingerprint() const
+// ---------------------------------------------------------------------------
+// Function: gets the section fingerprints (set by Analyze when an
+//           analysis cache is in use)
+// Input:    none
+// Output:   fingerprints
+// ---------------------------------------------------------------------------
+{
+    return m_Fingerprint;
+}
+
+int CElement::GetNumReused() const
+// ---------------------------------------------------------------------------
+// Function: gets the number of results the last Analyze took from the
+//           analysis cache
+// Input:    none
+// Output:   # of reused results
+// ---------------------------------------------------------------------------
+{
+    return m_nReused;
+}
+
+int CElement::GetNumDiskHits() const
+// ---------------------------------------------------------------------------
+// Function: gets the number of results the last Analyze read from the
+//           cache file
+// Input:    none
+// Output:   # of results read
+// ---------------------------------------------------------------------------
+{
+    return m_nDiskHits;
+}
+
+void CElement::SetAnalysisCache(CAnalysisCache* pCache)
+// ---------------------------------------------------------------------------
+// Function: turns incremental re-analysis on (results of sections seen
+//           before are reused) or off (nullptr)
+// Input:    analysis cache
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pCache = pCache;
+    m_pCached.reset();
+}
+
+void CElement::SetDiskCache(CDiskCache* pDiskCache)
+// ---------------------------------------------------------------------------
+// Function: turns the persistent cache on (results stored by earlier runs
+//           are read and new results are appended) or off (nullptr)
+// Input:    cache file
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pDiskCache = pDiskCache;
+}
+
+void CElement::SetTimestamps(const bool bTimestamps)
+// ---------------------------------------------------------------------------
+// Function: turns the start/end times in the output on or off (off when
+//           the output must be reproducible, e.g. in a pipe)
+// Input:    true to print them
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_bTimestamps = bTimestamps;
+}
+
+void CElement::SetThreadPool(CThreadPool* pPool)
+// ---------------------------------------------------------------------------
+// Function: sets the thread pool used by the section analyses (the
+//           shared default pool unless set)
+// Input:    thread pool
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pPool = (pPool != nullptr) ? pPool : &CThreadPool::GetDefault();
 }
 
 void CElement::SetSize()
 // ---------------------------------------------------------------------------
-// Function: memory allocation for all major arrays in the program
+// Function: memory allocation for the fixed-size arrays in the program.
+//           ReadModel sizes the reinforcement arrays as it reads them.
 // Input:    none
 // Output:   none
 // ---------------------------------------------------------------------------
@@ -101,12 +867,10 @@ void CElement::SetSize()
     // allocate space for nodal loads data
     m_NodalLoadData.SetSize(2);
     m_ConcMatData.SetSize(1);
-    m_ReData.SetSize(m_nXSR);
-    m_TransReData.SetSize(m_nTR);
     m_ElementData.SetSize(1);
-    m_nVTransSegments.SetSize(m_nTR);
     m_ReMatData.SetSize(1);
     m_EPData.SetSize(1);
+    m_EPData.Set(nullptr);
 }
 
 void CElement::SetEPropertyGroup (CXSType* pEPG)
@@ -158,6 +922,23 @@ void CElement::SetMaxValues(const float fMaxAxial, const float fAxialLoc,
     m_fMomentLoc = fMomentLoc;
 }
 
+void CElement::GetMaxValues(float& fMaxAxial, float& fAxialLoc,
+    float& fMaxShear, float& fShearLoc,
+    float& fMaxMoment, float& fMomentLoc) const
+// ---------------------------------------------------------------------------
+// Function: gets the max values and their locations
+// Input:    variables to hold the max values and their locations
+// Output:   max values and their locations
+// ---------------------------------------------------------------------------
+{
+    fMaxAxial = m_fMaxAxial;
+    fAxialLoc = m_fAxialLoc;
+    fMaxShear = m_fMaxShear;
+    fShearLoc = m_fShearLoc;
+    fMaxMoment = m_fMaxMoment;
+    fMomentLoc = m_fMomentLoc;
+}
+
 int CElement::GetMatPropertyGroup () const
 // ---------------------------------------------------------------------------
 // Function: gets the material group group # associated with the element
@@ -220,5 +1001,8 @@ void CElement::ErrorHandler(CGlobalErrorHandler::ERRORCODE ErrorCode) const
 
 void CElement::DisplayErrorMessage(CLocalErrorHandler::ERRORCODE err)
 {
-    m_LEH.ErrorHandler(err, m_nLineNumber);
+    if (m_Diagnostics.GetEntries().empty())
+        m_LEH.ErrorHandler(err, m_nLineNumber);
+    else
+        m_Diagnostics.Write(std::cerr);
 }
\ No newline at end of file
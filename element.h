@@ -25,6 +25,17 @@ Object-Oriented Numerical Analysis
 #include "reinforcement.h"
 #include "xstype.h"
 #include "rectsolid.h"
+#include "fibersection.h"
+#include "interaction.h"
+#include "momentcurvature.h"
+#include "whitneysection.h"
+#include "sectiondesign.h"
+#include "shear.h"
+#include "analysiscache.h"
+#include "diskcache.h"
+#include "binarysection.h"
+#include "resultwriter.h"
+#include "diagnostics.h"
 #include "nodalloads.h"
 #include "LocalErrorHandler.h"
 #include "MatToolBox.h"
@@ -52,21 +63,58 @@ class CElement
         // helper functions
         void Banner(std::ostream& OF);
         void PrepareIO(int argc, char* argv[]);
+        void PrepareIO(const std::string& strInput,
+                       const std::string& strOutput);
         void Analyze();
+        void ParseModel(std::istream& Input, CBinarySection::CModel& Model);
+        void AnalyzeModel(const CBinarySection::CModel& Model,
+                          std::ostream& OF);
+        bool CompileInput(const std::string& strInput,
+                          const std::string& strBinary);
         void TerminateProgram();
         void DisplayErrorMessage(CLocalErrorHandler::ERRORCODE);
+        void ComputeInteractionDiagram(const int nPoints =
+                                       CInteractionDiagram::DEFAULTPOINTS);
+        void ComputeMomentCurvature(const int nSteps =
+                                    CMomentCurvature::DEFAULTSTEPS,
+                                    const bool bWarmStart = true);
+        void ComputeInteractionSurface(const int nAngles =
+                                       CInteractionSurface::DEFAULTANGLES,
+                                       const int nDepths =
+                                       CInteractionDiagram::DEFAULTPOINTS);
+        void DesignSection();
+        void ComputeShear();
 
         // accessor functions
         int  GetMatPropertyGroup () const;
         CXSType* GetEPropertyGroup () const;
         void GetLength(float& fLength) const;
         ElementType GetType() const; // returns element type
+        void GetMaxValues(float& fMaxAxial, float& fAxialLoc,
+                          float& fMaxShear, float& fShearLoc,
+                          float& fMaxMoment, float& fMomentLoc) const;
+        const CInteractionDiagram& GetInteractionDiagram() const;
+        const CInteractionSurface& GetInteractionSurface() const;
+        const CMomentCurvature& GetMomentCurvature() const;
+        const CSectionDesigner& GetSectionDesigner() const;
+        const CShearDesign& GetShearDesign() const;
+        const CAnalysisCache::CFingerprint& GetFingerprint() const;
+        int  GetNumReused() const;
+        int  GetNumDiskHits() const;
+        void GetMomentCapacity(float& fMn, float& fPhiMn, float& fPhi,
+                               float& fC, float& fEpsT) const;
+        void GetRecord(CResultWriter::CRecord& Record) const;
+        const CDiagnostics& GetDiagnostics() const;
         
         // modifier functions
         void SetEPropertyGroup (CXSType*);
         void SetMatPropertyGroup (const int);
         void SetLength(const float fLength);
         void SetType(ElementType Type); // sets element type
+        void SetThreadPool(CThreadPool* pPool);
+        void SetAnalysisCache(CAnalysisCache* pCache);
+        void SetDiskCache(CDiskCache* pDiskCache);
+        void SetTimestamps(const bool bTimestamps);
         void SetMaxValues(const float fMaxAxial, const float fAxialLoc,
                           const float fMaxShear, const float fShearLoc,
                           const float fMaxMoment,const float fMomentLoc);
@@ -92,6 +140,29 @@ class CElement
         CXSType* m_pEPGroup; // element property group
         ElementType m_Type;  // element type (beam or column)
 
+        CFiberSection m_Fibers; // fiber model of the section
+        bool m_bFiberModel;    // fiber model has been meshed
+        CThreadPool* m_pPool;  // pool for the interaction diagram/surface
+        float m_fMn;           // nominal moment capacity
+        float m_fPhiMn;        // design moment capacity
+        float m_fPhi;          // strength reduction factor
+        float m_fNADepth;      // neutral axis depth at Mn
+        float m_fEpsT;         // net tensile strain at Mn
+        CInteractionDiagram m_Interaction; // P-M interaction diagram (columns)
+        CInteractionSurface m_Surface;     // P-Mx-My interaction surface (columns)
+        CMomentCurvature m_MomentCurvature; // moment-curvature response
+        CSectionDesigner m_Designer;        // section design search (*DESIGN)
+        CShearDesign m_Shear;               // shear strength and stirrup spacing
+
+        // incremental re-analysis
+        CAnalysisCache* m_pCache;                       // results of earlier analyses (nullptr = off)
+        std::shared_ptr<CAnalysisCache::CEntry> m_pCached; // entry of this section
+        CAnalysisCache::CFingerprint m_Fingerprint;     // section, material and reinforcement fingerprints
+        int m_nReused;                                  // # of results taken from the cache
+        CDiskCache* m_pDiskCache;                       // results of earlier runs (nullptr = off)
+        int m_nDiskHits;                                // # of results read from the cache file
+        bool m_bTimestamps;                             // print the start/end times in the output
+
         CVector<CElement>			m_ElementData;             // element data
         CVector<CMaterial>			m_ConcMatData;            // concrete material data
         CVector<CMaterial>          m_ReMatData;              // reinforcement material data
@@ -111,6 +182,8 @@ class CElement
 
         // input and output
         std::ifstream m_FileInput;	   // file input
+        std::string m_strInputName;    // input file name
+        bool    m_bBinaryInput;        // input is a binary (.xsb) file
         int m_nLineNumber;	           // current line number in input file
         CParser m_Parse;               // parser for free format read
         int     m_nV;                  // integer value that is read in
@@ -118,19 +191,36 @@ class CElement
         CVector<int> m_nVTransSegments;         // number of transverse reinforcement segments
         std::string m_strDelimiters;   // delimiters used in input file
         std::string m_strComment;      // characters to signify comment line
-        std::vector<std::string> m_strVTokens; // vector to store tokens read
+        std::vector<std::string_view> m_strVTokens; // tokens read (views into the input buffer)
         std::string m_strDateTime;     // date and time at start of analysis
         std::string m_strEndDateTime;     // date and time at end of analysis
         int     m_nTokens;             // number of tokens read
         std::ofstream m_FileOutput;	   // file output
         CFileIO m_FIO;                 // for file operations
         CLocalErrorHandler m_LEH;      // for handling errors detected by program
-
-
-        void ReadProblemSize();
-        void ReadModel();
-        void CreateOutput();
+        CDiagnostics m_Diagnostics;    // problems found in the input
+
+
+        void ReadModel(std::istream& Input);
+        void ReadDesign();
+        bool ReadBarPattern(const CVector<float>& fVXSDims,
+                            std::vector<float>& fVBars);
+        void ReadBinary();
+        void GetModel(CBinarySection::CModel& Model) const;
+        void SetModel(const CBinarySection::CModel& Model);
+        void CreateOutput(std::ostream& OF);
+        void AnalyzeSection();
         void FindMomentCapcity();
+        template <CXSType::EPType TYPE>
+        void WhitneyCapacity(const CXSType& XS, const float fFc,
+                             const float fFy, const float fEs,
+                             const float fP);
+        void BuildFiberModel();
+        void ComputeFingerprint();
+        float DesignAxialLoad() const;
+        void DiskKey(const CDiskCache::KIND Kind, const float fP,
+                     const int nA, const int nB,
+                     std::vector<long long>& nVKey) const;
 
         // modifier functions
         void SetSize();
@@ -138,5 +228,7 @@ class CElement
         // error handlers
         void ErrorHandler(CLocalErrorHandler::ERRORCODE);        // gateway to local error handler
         void ErrorHandler(CGlobalErrorHandler::ERRORCODE) const; // gateway to global error handler
-        void IOErrorHandler(ERRORCODE nCode) const;
+        void IOErrorHandler(const ERRORCODE nCode);
+        void InputError(const ERRORCODE nCode);
+        static const char* IOErrorMessage(const ERRORCODE nCode);
 };
@@ -0,0 +1,1008 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CFiberSection class.
+
+TODO:
+
+**********************************************/
+#include <cmath>
+#include <algorithm>
+#include "fibersection.h"
+#include "constants.h"
+
+CFiberSection::CFiberSection ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_nConcrete = m_nFibers = 0;
+    m_fXc = m_fYc = 0.0f;
+    m_fAg = m_fAs = 0.0f;
+    m_fFc = m_fFy = m_fEs = 0.0f;
+    m_fBeta1 = 0.85f;
+    m_fEpsCU = 0.003f;
+    m_fEc = m_fEps0 = m_fFr = 0.0f;
+    m_bSpiral = false;
+}
+
+CFiberSection::~CFiberSection ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CFiberSection::SetMaterials (const float fFc, const float fFy,
+                                  const float fEs)
+// ---------------------------------------------------------------------------
+// Function: sets the material data and the ACI stress block factor
+// Input:    concrete strength, steel yield strength and modulus (ksi)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (fFc <= 0.0f || fFy <= 0.0f || fEs <= 0.0f)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    m_fFc = fFc;
+    m_fFy = fFy;
+    m_fEs = fEs;
+
+    // beta1 is 0.85 up to 4 ksi, reduced by 0.05 per ksi to 0.65
+    m_fBeta1 = 0.85f - 0.05f * (m_fFc - 4.0f);
+    m_fBeta1 = std::min(0.85f, std::max(0.65f, m_fBeta1));
+
+    // Ec = 57000 sqrt(f'c) and fr = 7.5 sqrt(f'c) with f'c in psi
+    float fRootFc = static_cast<float>(sqrt(1000.0*m_fFc));
+    m_fEc = 57.0f * fRootFc;
+    m_fFr = 7.5f * fRootFc / 1000.0f;
+    m_fEps0 = 2.0f * m_fFc / m_fEc;
+}
+
+void CFiberSection::SetSpiral (const bool bSpiral)
+// ---------------------------------------------------------------------------
+// Function: sets the type of transverse reinforcement used for phi
+// Input:    true for spirals, false for ties
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_bSpiral = bSpiral;
+}
+
+void CFiberSection::Mesh (const CXSType& XS, int nDivX, int nDivY)
+// ---------------------------------------------------------------------------
+// Function: discretizes the concrete section into fibers
+//           rectangle: dimensions are width and depth, origin at the centroid
+//           T-section: dimensions are total depth, flange width, web
+//                      width and flange thickness; the origin is on the web
+//                      centerline at the underside of the flange
+//           circle:    dimension is the radius, origin at the center
+// Input:    cross-section, # of divisions across the width and depth
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CXSType::EPType Type;
+    CVectorN<float,MAXEPDIM> fVDims;
+    XS.GetType (Type);
+    XS.GetDimensions (fVDims);
+
+    nDivX = std::max(nDivX, 1);
+    nDivY = std::max(nDivY, 1);
+
+    m_fVX.clear(); m_fVY.clear(); m_fVA.clear(); m_nVMat.clear();
+    m_fVDX.clear(); m_fVDY.clear();
+    m_fVOutlineX.clear(); m_fVOutlineY.clear();
+    m_nConcrete = m_nFibers = 0;
+    m_fAs = 0.0f;
+
+    if (Type == CXSType::EPType::RECTS)
+    {
+        float fB = fVDims(1);
+        float fH = fVDims(2);
+        AddRectangle (-0.5f*fB, -0.5f*fH, 0.5f*fB, 0.5f*fH, nDivX, nDivY);
+        float fXO[] = {-0.5f*fB, 0.5f*fB, 0.5f*fB, -0.5f*fB};
+        float fYO[] = {-0.5f*fH, -0.5f*fH, 0.5f*fH, 0.5f*fH};
+        m_fVOutlineX.assign (fXO, fXO+4);
+        m_fVOutlineY.assign (fYO, fYO+4);
+    }
+    else if (Type == CXSType::EPType::TSECTION)
+    {
+        float fH  = fVDims(1);
+        float fBf = fVDims(2);
+        float fBw = fVDims(3);
+        float fTf = fVDims(4);
+        // split the depth divisions between flange and web
+        int nDivF = std::max(1, static_cast<int>(nDivY * fTf / fH + 0.5f));
+        int nDivW = std::max(1, nDivY - nDivF);
+        AddRectangle (-0.5f*fBf, 0.0f, 0.5f*fBf, fTf, nDivX, nDivF);
+        AddRectangle (-0.5f*fBw, fTf-fH, 0.5f*fBw, 0.0f,
+                      std::max(1, static_cast<int>(nDivX * fBw / fBf + 0.5f)),
+                      nDivW);
+        float fXO[] = {-0.5f*fBw, 0.5f*fBw, 0.5f*fBw, 0.5f*fBf,
+                       0.5f*fBf, -0.5f*fBf, -0.5f*fBf, -0.5f*fBw};
+        float fYO[] = {fTf-fH, fTf-fH, 0.0f, 0.0f, fTf, fTf, 0.0f, 0.0f};
+        m_fVOutlineX.assign (fXO, fXO+8);
+        m_fVOutlineY.assign (fYO, fYO+8);
+    }
+    else if (Type == CXSType::EPType::CIRCS)
+    {
+        float fR = fVDims(1);
+        AddCircle (fR, 2*nDivX, std::max(1, nDivY/2));
+        const int NUMOUTLINE = 72;
+        for (int i = 0; i < NUMOUTLINE; i++)
+        {
+            double dT = 2.0*PI*i/NUMOUTLINE;
+            m_fVOutlineX.push_back (static_cast<float>(fR*cos(dT)));
+            m_fVOutlineY.push_back (static_cast<float>(fR*sin(dT)));
+        }
+    }
+    else
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    // gross area and centroid
+    double dA = 0.0, dAX = 0.0, dAY = 0.0;
+    for (size_t i = 0; i < m_fVA.size(); i++)
+    {
+        dA  += m_fVA[i];
+        dAX += m_fVA[i]*m_fVX[i];
+        dAY += m_fVA[i]*m_fVY[i];
+    }
+    m_fAg = static_cast<float>(dA);
+    m_fXc = static_cast<float>(dAX/dA);
+    m_fYc = static_cast<float>(dAY/dA);
+
+    PadFibers ();
+    m_nConcrete = m_nFibers = static_cast<int>(m_fVA.size());
+}
+
+void CFiberSection::AddBars (const CReinforcement& Re)
+// ---------------------------------------------------------------------------
+// Function: adds the reinforcing bars as point fibers (replaces any
+//           bars added earlier)
+// Input:    reinforcement data
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_nConcrete == 0)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    m_fVX.resize (m_nConcrete); m_fVY.resize (m_nConcrete);
+    m_fVA.resize (m_nConcrete); m_nVMat.resize (m_nConcrete);
+    m_fVDX.resize (m_nConcrete); m_fVDY.resize (m_nConcrete);
+
+    float fDia, fX, fY;
+    m_fAs = 0.0f;
+    for (int i = 1; i <= Re.GetNumBars(); i++)
+    {
+        Re.GetBar (i, fDia, fX, fY);
+        float fA = static_cast<float>(PI) * fDia * fDia / 4.0f;
+        m_fVX.push_back (fX);
+        m_fVY.push_back (fY);
+        m_fVA.push_back (fA);
+        m_fVDX.push_back (0.0f);
+        m_fVDY.push_back (0.0f);
+        m_nVMat.push_back (static_cast<int>(MATID::STEEL));
+        m_fAs += fA;
+    }
+
+    PadFibers ();
+    m_nFibers = static_cast<int>(m_fVA.size());
+}
+
+void CFiberSection::AddRectangle (float fX1, float fY1, float fX2, float fY2,
+                                  int nDivX, int nDivY)
+// ---------------------------------------------------------------------------
+// Function: adds a rectangular patch of concrete fibers
+// Input:    lower left and upper right corners, # of divisions
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    float fDX = (fX2 - fX1) / nDivX;
+    float fDY = (fY2 - fY1) / nDivY;
+    for (int j = 0; j < nDivY; j++)
+    {
+        for (int i = 0; i < nDivX; i++)
+        {
+            m_fVX.push_back (fX1 + (i + 0.5f)*fDX);
+            m_fVY.push_back (fY1 + (j + 0.5f)*fDY);
+            m_fVA.push_back (fDX*fDY);
+            m_fVDX.push_back (fDX);
+            m_fVDY.push_back (fDY);
+            m_nVMat.push_back (static_cast<int>(MATID::CONCRETE));
+        }
+    }
+}
+
+void CFiberSection::AddCircle (float fR, int nSectors, int nRings)
+// ---------------------------------------------------------------------------
+// Function: adds a solid circle of concrete fibers made of annular sectors
+// Input:    radius, # of sectors and rings
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    double dDT = 2.0*PI/nSectors;
+    double dDR = static_cast<double>(fR)/nRings;
+    for (int j = 0; j < nRings; j++)
+    {
+        double dR1 = j*dDR, dR2 = (j+1)*dDR;
+        double dA = 0.5*dDT*(dR2*dR2 - dR1*dR1);
+        // radius to the centroid of an annular sector
+        double dRc = (2.0/3.0)*(dR2*dR2*dR2 - dR1*dR1*dR1)/(dR2*dR2 - dR1*dR1)
+                     * sin(0.5*dDT)/(0.5*dDT);
+        for (int i = 0; i < nSectors; i++)
+        {
+            double dT = (i + 0.5)*dDT;
+            m_fVX.push_back (static_cast<float>(dRc*cos(dT)));
+            m_fVY.push_back (static_cast<float>(dRc*sin(dT)));
+            m_fVA.push_back (static_cast<float>(dA));
+            // sectors are treated as squares of equal area for the block edge
+            m_fVDX.push_back (static_cast<float>(sqrt(dA)));
+            m_fVDY.push_back (static_cast<float>(sqrt(dA)));
+            m_nVMat.push_back (static_cast<int>(MATID::CONCRETE));
+        }
+    }
+}
+
+void CFiberSection::PadFibers ()
+// ---------------------------------------------------------------------------
+// Function: pads the last fiber group with zero-area fibers so that its
+//           length is a multiple of NUMLANES
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    int nMat = m_nVMat.empty() ? static_cast<int>(MATID::CONCRETE)
+                               : m_nVMat.back();
+    while (m_fVA.size() % NUMLANES != 0)
+    {
+        m_fVX.push_back (m_fXc);
+        m_fVY.push_back (m_fYc);
+        m_fVA.push_back (0.0f);
+        m_fVDX.push_back (0.0f);
+        m_fVDY.push_back (0.0f);
+        m_nVMat.push_back (nMat);
+    }
+}
+
+void CFiberSection::Integrate (const float fE0, const float fGX,
+                               const float fGY, float& fN, float& fMx,
+                               float& fMy) const
+// ---------------------------------------------------------------------------
+// Function: computes the axial force and the moments about the centroidal
+//           axes for a strain plane at the ultimate state. Concrete uses
+//           the equivalent rectangular stress block; a fiber cut by the
+//           edge of the block contributes the fraction of its extent
+//           inside the block so that the force varies continuously
+//           with the strain plane. Steel is elastic-perfectly plastic
+//           with the displaced concrete removed.
+//           The loops are branch free and accumulate into NUMLANES
+//           independent partial sums so that they vectorize.
+// Input:    strain plane e0, gx, gy
+// Output:   axial force, moment about x (Mx) and about y (My)
+// ---------------------------------------------------------------------------
+{
+    const float fCB = 0.85f * m_fFc;                    // block stress
+    const float fEpsB = m_fEpsCU * (1.0f - m_fBeta1);   // strain at block edge
+    const float* pX = m_fVX.data();
+    const float* pY = m_fVY.data();
+    const float* pA = m_fVA.data();
+    const float* pDX = m_fVDX.data();
+    const float* pDY = m_fVDY.data();
+    const float fAGX = std::fabs(fGX), fAGY = std::fabs(fGY);
+    const float fXc = m_fXc, fYc = m_fYc;
+    const float fFy = m_fFy, fEs = m_fEs;
+
+    float fSN[NUMLANES], fSMx[NUMLANES], fSMy[NUMLANES];
+    for (int k = 0; k < NUMLANES; k++)
+        fSN[k] = fSMx[k] = fSMy[k] = 0.0f;
+
+    // concrete fibers
+    for (int i = 0; i < m_nConcrete; i += NUMLANES)
+    {
+        for (int k = 0; k < NUMLANES; k++)
+        {
+            float fEps = fE0 + fGX*pX[i+k] + fGY*pY[i+k];
+            // strain range across the fiber
+            float fDE = std::max(fAGX*pDX[i+k] + fAGY*pDY[i+k], 1.0e-12f);
+            float fFrac = std::min(std::max((fEps - fEpsB)/fDE + 0.5f, 0.0f), 1.0f);
+            float fF = fCB * fFrac * pA[i+k];
+            fSN[k]  += fF;
+            fSMx[k] += fF * (pY[i+k] - fYc);
+            fSMy[k] += fF * (pX[i+k] - fXc);
+        }
+    }
+
+    // steel fibers
+    for (int i = m_nConcrete; i < m_nFibers; i += NUMLANES)
+    {
+        for (int k = 0; k < NUMLANES; k++)
+        {
+            float fEps = fE0 + fGX*pX[i+k] + fGY*pY[i+k];
+            float fS = std::min(std::max(fEs*fEps, -fFy), fFy);
+            fS -= (fEps >= fEpsB ? fCB : 0.0f);
+            float fF = fS * pA[i+k];
+            fSN[k]  += fF;
+            fSMx[k] += fF * (pY[i+k] - fYc);
+            fSMy[k] += fF * (pX[i+k] - fXc);
+        }
+    }
+
+    fN = fMx = fMy = 0.0f;
+    for (int k = 0; k < NUMLANES; k++)
+    {
+        fN  += fSN[k];
+        fMx += fSMx[k];
+        fMy += fSMy[k];
+    }
+}
+
+void CFiberSection::IntegrateTangent (const float fE0, const float fGX,
+                                      const float fGY, float& fN,
+                                      float& fMx, float& fMy,
+                                      float& fDN) const
+// ---------------------------------------------------------------------------
+// Function: computes the axial force, the moments about the centroidal
+//           axes and the axial tangent stiffness dN/de0 for a strain
+//           plane in the service to ultimate range. Concrete follows the
+//           Hognestad parabola up to eps0 and a linear descent of
+//           0.15 f'c at ecu; in tension it is linear up to the modulus
+//           of rupture and carries nothing after cracking. Steel is
+//           elastic-perfectly plastic with the displaced concrete
+//           removed. Same lane layout as Integrate.
+// Input:    strain plane e0, gx, gy
+// Output:   axial force, Mx, My and dN/de0
+// ---------------------------------------------------------------------------
+{
+    const float* pX = m_fVX.data();
+    const float* pY = m_fVY.data();
+    const float* pA = m_fVA.data();
+    const float fXc = m_fXc, fYc = m_fYc;
+    const float fFc = m_fFc, fEc = m_fEc, fEps0 = m_fEps0;
+    const float fEpsR = m_fFr / m_fEc;
+    const float fSlopeD = -0.15f * fFc / std::max(m_fEpsCU - fEps0, 0.0005f);
+    const float fFy = m_fFy, fEs = m_fEs, fEpsY = m_fFy / m_fEs;
+
+    float fSN[NUMLANES], fSMx[NUMLANES], fSMy[NUMLANES], fSD[NUMLANES];
+    for (int k = 0; k < NUMLANES; k++)
+        fSN[k] = fSMx[k] = fSMy[k] = fSD[k] = 0.0f;
+
+    // concrete stress and tangent, written as selects so the loops vectorize
+    auto Concrete = [=] (float fEps, float& fS, float& fET)
+    {
+        float fR = fEps / fEps0;
+        float fSA = fFc * (2.0f*fR - fR*fR);                  // ascending
+        float fEA = fFc * (2.0f - 2.0f*fR) / fEps0;
+        float fSD = std::max(fFc + fSlopeD*(fEps - fEps0), 0.0f); // descending
+        float fED = fSD > 0.0f ? fSlopeD : 0.0f;
+        bool  bUncracked = fEps >= -fEpsR;
+        float fST = bUncracked ? fEc*fEps : 0.0f;             // tension
+        float fETT = bUncracked ? fEc : 0.0f;
+        fS  = fEps < 0.0f ? fST  : (fEps < fEps0 ? fSA : fSD);
+        fET = fEps < 0.0f ? fETT : (fEps < fEps0 ? fEA : fED);
+    };
+
+    // concrete fibers
+    for (int i = 0; i < m_nConcrete; i += NUMLANES)
+    {
+        for (int k = 0; k < NUMLANES; k++)
+        {
+            float fEps = fE0 + fGX*pX[i+k] + fGY*pY[i+k];
+            float fS, fET;
+            Concrete (fEps, fS, fET);
+            float fF = fS * pA[i+k];
+            fSN[k]  += fF;
+            fSMx[k] += fF * (pY[i+k] - fYc);
+            fSMy[k] += fF * (pX[i+k] - fXc);
+            fSD[k]  += fET * pA[i+k];
+        }
+    }
+
+    // steel fibers
+    for (int i = m_nConcrete; i < m_nFibers; i += NUMLANES)
+    {
+        for (int k = 0; k < NUMLANES; k++)
+        {
+            float fEps = fE0 + fGX*pX[i+k] + fGY*pY[i+k];
+            float fSC, fETC;
+            Concrete (fEps, fSC, fETC);
+            float fS = std::min(std::max(fEs*fEps, -fFy), fFy) - fSC;
+            float fET = (std::fabs(fEps) < fEpsY ? fEs : 0.0f) - fETC;
+            float fF = fS * pA[i+k];
+            fSN[k]  += fF;
+            fSMx[k] += fF * (pY[i+k] - fYc);
+            fSMy[k] += fF * (pX[i+k] - fXc);
+            fSD[k]  += fET * pA[i+k];
+        }
+    }
+
+    fN = fMx = fMy = fDN = 0.0f;
+    for (int k = 0; k < NUMLANES; k++)
+    {
+        fN  += fSN[k];
+        fMx += fSMx[k];
+        fMy += fSMy[k];
+        fDN += fSD[k];
+    }
+}
+
+void CFiberSection::FindMomentCapacity (const float fP, float& fMn,
+                                        float& fPhiMn, float& fC,
+                                        float& fEpsT, float& fPhi) const
+// ---------------------------------------------------------------------------
+// Function: finds the nominal and design moment capacities about the
+//           x-axis (compression on the +y face) by strain compatibility
+//           at the point of the design curve where phi*Pn equals the
+//           factored axial load. The capacity is zero if the axial load
+//           is outside the range the section can carry.
+// Input:    factored axial load (compression positive)
+// Output:   Mn, phi*Mn, neutral axis depth, net tensile strain, phi
+// ---------------------------------------------------------------------------
+{
+    if (m_nConcrete == 0)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    fMn = fPhiMn = fEpsT = 0.0f;
+    fPhi = GetPhi (0.0f);
+    fC = NeutralAxisDepth (fP, true);
+    if (fC <= 0.0f)
+        return;
+
+    float fDt;
+    ExtremeDepth (0.0f, 1.0f, fDt);
+    float fE0, fGX, fGY, fN, fMx, fMy;
+    StrainPlane (0.0f, 1.0f, fC, fE0, fGX, fGY);
+    Integrate (fE0, fGX, fGY, fN, fMx, fMy);
+
+    fMn = fMx;
+    fEpsT = m_fEpsCU * (fDt - fC) / fC;
+    fPhi = GetPhi (fEpsT);
+    fPhiMn = fPhi * fMn;
+}
+
+float CFiberSection::NeutralAxisDepth (const float fP,
+                                       const bool bFactored) const
+// ---------------------------------------------------------------------------
+// Function: neutral axis depth at the ultimate state for bending about
+//           the x-axis at which the axial force (or phi times the axial
+//           force) equals the given load. bisection on log(c); both Pn
+//           and phi*Pn increase with c
+// Input:    axial load (compression positive), true to match phi*Pn
+// Output:   returns c (zero if the load is outside the range the section
+//           can carry)
+// ---------------------------------------------------------------------------
+{
+    const int MAXITERATIONS = 100;
+    const float fNX = 0.0f, fNY = 1.0f;
+    float fDt;
+    float fH = ExtremeDepth (fNX, fNY, fDt);
+
+    // axial force (times phi) at a depth c
+    auto Force = [this, fNX, fNY, fDt, bFactored] (const double dC)
+    {
+        float fE0, fGX, fGY, fN, fMx, fMy;
+        float fC = static_cast<float>(dC);
+        StrainPlane (fNX, fNY, fC, fE0, fGX, fGY);
+        Integrate (fE0, fGX, fGY, fN, fMx, fMy);
+        if (bFactored)
+            fN *= GetPhi (m_fEpsCU * (fDt - fC) / fC);
+        return fN;
+    };
+
+    // axial load within the range of the section?
+    double dCLo = 1.0e-4*fH, dCHi = 1.0e3*fH;
+    if (fP < Force (dCLo) || fP > Force (dCHi))
+        return 0.0f;
+
+    for (int i = 0; i < MAXITERATIONS && dCHi/dCLo > 1.0 + 1.0e-6; i++)
+    {
+        double dC = sqrt(dCLo*dCHi);
+        if (Force (dC) < fP)
+            dCLo = dC;
+        else
+            dCHi = dC;
+    }
+    return static_cast<float>(sqrt(dCLo*dCHi));
+}
+
+void CFiberSection::ComputeInteraction (CInteractionDiagram& Diagram,
+                                        const int nPoints,
+                                        CThreadPool& Pool) const
+// ---------------------------------------------------------------------------
+// Function: axial load - moment interaction diagram for bending about the
+//           x-axis (compression on the +y face). The points are
+//           independent and are computed concurrently on the pool.
+// Input:    diagram to fill, # of points (at least 3), thread pool
+// Output:   diagram from pure compression to pure tension
+// ---------------------------------------------------------------------------
+{
+    if (m_nConcrete == 0 || nPoints < 3)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    Diagram.SetSize (nPoints);
+    Diagram.SetPhiPnMax (GetPhiPnMax ());
+
+    Pool.ParallelFor (1, nPoints, [this, &Diagram, nPoints] (int i)
+    {
+        float fPn, fMx, fMy, fC, fEpsT;
+        InteractionPoint (0.0f, 1.0f, i, nPoints, fPn, fMx, fMy, fC, fEpsT);
+        Diagram.SetPoint (i, fPn, fMx, GetPhi (fEpsT), fC, fEpsT);
+    });
+}
+
+void CFiberSection::ComputeSurface (CInteractionSurface& Surface,
+                                    const std::vector<float>& fVAngles,
+                                    const int nDepths,
+                                    CThreadPool& Pool) const
+// ---------------------------------------------------------------------------
+// Function: biaxial P-Mx-My interaction surface. The neutral axis is
+//           rotated through the given angles and the depth sweep for each
+//           angle runs as one task on the pool.
+// Input:    surface to fill, directions of the compression side measured
+//           from the +x axis (radians), # of points per sweep (at
+//           least 3), thread pool
+// Output:   surface as an angle x depth mesh
+// ---------------------------------------------------------------------------
+{
+    int nAngles = static_cast<int>(fVAngles.size());
+    if (m_nConcrete == 0 || nAngles == 0 || nDepths < 3)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    Surface.SetSize (nAngles, nDepths);
+    Surface.SetPhiPnMax (GetPhiPnMax ());
+
+    Pool.ParallelFor (1, nAngles, [this, &Surface, &fVAngles, nDepths] (int i)
+    {
+        float fTheta = fVAngles[static_cast<size_t>(i - 1)];
+        float fNX = static_cast<float>(cos(fTheta));
+        float fNY = static_cast<float>(sin(fTheta));
+        Surface.SetAngle (i, fTheta);
+        for (int j = 1; j <= nDepths; j++)
+        {
+            float fPn, fMx, fMy, fC, fEpsT;
+            InteractionPoint (fNX, fNY, j, nDepths, fPn, fMx, fMy, fC, fEpsT);
+            Surface.SetPoint (i, j, fPn, fMx, fMy, GetPhi (fEpsT));
+        }
+    });
+}
+
+void CFiberSection::InteractionPoint (const float fNX, const float fNY,
+                                      const int i, const int nPoints,
+                                      float& fPn, float& fMx, float& fMy,
+                                      float& fC, float& fEpsT) const
+// ---------------------------------------------------------------------------
+// Function: point i of an nPoints sweep of the neutral axis depth. Point 1
+//           is pure compression (uniform strain ecu) and point nPoints is
+//           pure tension (all steel yielded). In between c is spaced
+//           uniformly from the depth beyond which the section carries P0
+//           (stress block over the full depth and all steel yielded in
+//           compression) down towards zero.
+// Input:    unit vector pointing to the compression side, point number
+//           (1-based) and # of points
+// Output:   Pn, Mx, My, depth c (zero at the ends), net tensile strain
+// ---------------------------------------------------------------------------
+{
+    float fDt;
+    float fH = ExtremeDepth (fNX, fNY, fDt);
+    float fE0, fGX = 0.0f, fGY = 0.0f;
+
+    if (i <= 1)
+    {
+        fC = 0.0f;
+        fE0 = m_fEpsCU;
+        fEpsT = -m_fEpsCU;
+    }
+    else if (i >= nPoints)
+    {
+        fC = 0.0f;
+        fE0 = -2.0f * std::max(0.005f, m_fFy/m_fEs);
+        fEpsT = -fE0;
+    }
+    else
+    {
+        float fEpsTY = m_fFy / m_fEs;
+        float fCMax = fH / m_fBeta1;
+        if (m_fEpsCU > 1.01f*fEpsTY)
+            fCMax = std::max(fCMax, m_fEpsCU*fDt/(m_fEpsCU - fEpsTY));
+        else
+            fCMax = std::max(fCMax, 10.0f*fH);
+        float fT = static_cast<float>(i - 2) / static_cast<float>(nPoints - 2);
+        fC = fCMax * (1.0f - fT);
+        StrainPlane (fNX, fNY, fC, fE0, fGX, fGY);
+        fEpsT = m_fEpsCU * (fDt - fC) / fC;
+    }
+    Integrate (fE0, fGX, fGY, fPn, fMx, fMy);
+}
+
+void CFiberSection::ComputeMomentCurvature (const float fP,
+                                            const int nSteps,
+                                            const bool bWarmStart,
+                                            CMomentCurvature& MC) const
+// ---------------------------------------------------------------------------
+// Function: moment-curvature response for bending about the x-axis
+//           (compression on the +y face) under a constant axial load.
+//           The curvature is increased in equal steps sized from the
+//           stress block estimate of the ultimate curvature; at each step
+//           the strain e0 is found so that N = P. With warm starting the
+//           solver is a safeguarded Newton iteration started from the
+//           solution extrapolated from the previous two steps, otherwise
+//           each step is a cold bisection. A step whose curvature has
+//           no equilibrium state (the load falls on a jump in N where a
+//           fiber cracks) is shortened. The analysis ends when the
+//           extreme compression fiber reaches ecu.
+// Input:    axial load (compression positive), # of steps to the
+//           estimated ultimate curvature, warm start flag
+// Output:   curve and its cracking, first yield and ultimate points
+// ---------------------------------------------------------------------------
+{
+    if (m_nConcrete == 0 || nSteps < 1)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    MC.Reset (fP, bWarmStart);
+
+    // extreme fibers and extreme tension steel
+    float fDt;
+    float fH = ExtremeDepth (0.0f, 1.0f, fDt);
+    float fYMax = m_fVOutlineY[0];
+    for (size_t i = 1; i < m_fVOutlineY.size(); i++)
+        fYMax = std::max(fYMax, m_fVOutlineY[i]);
+    float fYMin = fYMax - fH;
+    float fYs = fYMax - fDt;
+    bool bSteel = m_fAs > 0.0f;
+    float fEpsY = m_fFy / m_fEs;
+    float fEpsR = m_fFr / m_fEc;
+
+    // curvature step from the stress block estimate of the ultimate state
+    float fC = NeutralAxisDepth (fP, false);
+    if (fC <= 0.0f)
+        return;
+    float fDPhi = m_fEpsCU / fC / nSteps;
+    float fTol = 1.0e-5f * GetP0 ();
+    const int MAXREFINE = 4;            // step halvings at a crack jump
+
+    // zero curvature
+    float fE0 = 0.0f, fMx;
+    int nIter = SolveAxialStrain (fP, 0.0f, fTol, bWarmStart, fE0, fMx);
+    if (nIter < 0)
+        return;
+    MC.AddPoint (0.0f, fMx, fE0, nIter);
+
+    float fPhiPrev = 0.0f, fE0Prev = fE0, fE0Prev2 = fE0;
+    for (int k = 1; k <= 4*nSteps; k++)
+    {
+        float fCurv = k * fDPhi;
+        fE0 = (k > 1) ? 2.0f*fE0Prev - fE0Prev2 : fE0Prev;
+        nIter = SolveAxialStrain (fP, fCurv, fTol, bWarmStart, fE0, fMx);
+        for (int j = 0; nIter < 0 && j < MAXREFINE; j++)
+        {
+            // no equilibrium state at this curvature (N jumps over P
+            // where a fiber cracks): shorten the step
+            fCurv = 0.5f*(fPhiPrev + fCurv);
+            fE0 = fE0Prev;
+            nIter = SolveAxialStrain (fP, fCurv, fTol, bWarmStart, fE0, fMx);
+        }
+        if (nIter < 0)
+            break;
+
+        // key points are located within the step by a secant search on
+        // the curvature for the strain that defines them
+        float fKPhi, fKM, fKE0;
+        if (!MC.GetKeyPoint (CMomentCurvature::KEYPOINT::CRACKING, fKPhi, fKM)
+            && fE0 + fCurv*fYMin <= -fEpsR
+            && RefineKeyPoint (fP, fYMin, -fEpsR, fTol, bWarmStart, fPhiPrev,
+                               fE0Prev, fCurv, fE0, fKPhi, fKM, fKE0))
+            MC.SetKeyPoint (CMomentCurvature::KEYPOINT::CRACKING, fKPhi, fKM);
+        if (bSteel
+            && !MC.GetKeyPoint (CMomentCurvature::KEYPOINT::YIELD, fKPhi, fKM)
+            && fE0 + fCurv*fYs <= -fEpsY
+            && RefineKeyPoint (fP, fYs, -fEpsY, fTol, bWarmStart, fPhiPrev,
+                               fE0Prev, fCurv, fE0, fKPhi, fKM, fKE0))
+            MC.SetKeyPoint (CMomentCurvature::KEYPOINT::YIELD, fKPhi, fKM);
+        if (fE0 + fCurv*fYMax >= m_fEpsCU)
+        {
+            // the curve ends where the top fiber reaches ecu
+            if (RefineKeyPoint (fP, fYMax, m_fEpsCU, fTol, bWarmStart, fPhiPrev,
+                                fE0Prev, fCurv, fE0, fKPhi, fKM, fKE0))
+            {
+                MC.AddPoint (fKPhi, fKM, fKE0, nIter);
+                MC.SetKeyPoint (CMomentCurvature::KEYPOINT::ULTIMATE, fKPhi, fKM);
+            }
+            break;
+        }
+
+        MC.AddPoint (fCurv, fMx, fE0, nIter);
+        fE0Prev2 = fE0Prev;
+        fE0Prev = fE0;
+        fPhiPrev = fCurv;
+    }
+}
+
+bool CFiberSection::RefineKeyPoint (const float fP, const float fY,
+                                    const float fEpsKey, const float fTol,
+                                    const bool bWarmStart, float fPhiA,
+                                    float fE0A, float fPhiB, float fE0B,
+                                    float& fPhi, float& fM, float& fE0) const
+// ---------------------------------------------------------------------------
+// Function: finds the curvature within a step at which the strain at
+//           height y reaches a given value (Illinois variant of the
+//           false position method)
+// Input:    axial load, height of the fiber, strain sought, force
+//           tolerance, warm start flag, curvature and e0 at both ends of
+//           the step
+// Output:   curvature, moment and e0 at the point; returns false if the
+//           strain is not bracketed by the step or a solve failed
+// ---------------------------------------------------------------------------
+{
+    const int MAXITERATIONS = 20;
+    float fGA = fE0A + fPhiA*fY - fEpsKey;
+    float fGB = fE0B + fPhiB*fY - fEpsKey;
+    if (fGA*fGB > 0.0f)
+        return false;
+
+    int nSide = 0;
+    for (int i = 0; i < MAXITERATIONS; i++)
+    {
+        float fT = (fGA == fGB) ? 0.5f : fGA / (fGA - fGB);
+        fPhi = fPhiA + fT*(fPhiB - fPhiA);
+        fE0 = fE0A + fT*(fE0B - fE0A);
+        if (SolveAxialStrain (fP, fPhi, fTol, bWarmStart, fE0, fM) < 0)
+            return false;
+        float fG = fE0 + fPhi*fY - fEpsKey;
+        if (std::fabs(fG) <= 1.0e-4f*std::fabs(fEpsKey))
+            break;
+        if (fG*fGA > 0.0f)
+        {
+            fPhiA = fPhi; fE0A = fE0; fGA = fG;
+            if (nSide == -1) fGB *= 0.5f;
+            nSide = -1;
+        }
+        else
+        {
+            fPhiB = fPhi; fE0B = fE0; fGB = fG;
+            if (nSide == 1) fGA *= 0.5f;
+            nSide = 1;
+        }
+    }
+    return true;
+}
+
+int CFiberSection::SolveAxialStrain (const float fP, const float fGY,
+                                     const float fTol, const bool bWarmStart,
+                                     float& fE0, float& fMx) const
+// ---------------------------------------------------------------------------
+// Function: finds the strain e0 at which the section carries the axial
+//           load for a given curvature about the x-axis
+//           warm start: Newton iteration from the given e0 using the
+//                       tangent dN/de0, falling back to bisection once
+//                       the root is bracketed and the Newton step leaves
+//                       the bracket (or the tangent is not positive)
+//           cold start: bisection between a fully yielded tension state
+//                       and a state with the whole section past eps0
+// Input:    axial load, curvature, force tolerance, warm start flag,
+//           e0 (starting value for warm starts)
+// Output:   e0 and Mx at the solution; returns the # of section
+//           evaluations or -1 if the solver failed. N jumps where a
+//           fiber cracks, so the bracket can close on a jump without
+//           any state carrying the load to the tolerance; that is a
+//           failure too
+// ---------------------------------------------------------------------------
+{
+    const int MAXITERATIONS = 100;
+    float fN, fMy, fDN;
+
+    if (bWarmStart)
+    {
+        double dLo = 0.0, dHi = 0.0, dStep = 1.0e-4;
+        bool bLo = false, bHi = false;
+        double dE = fE0;
+        for (int i = 1; i <= MAXITERATIONS; i++)
+        {
+            IntegrateTangent (static_cast<float>(dE), 0.0f, fGY, fN, fMx, fMy, fDN);
+            double dR = static_cast<double>(fN) - fP;
+            if (fabs(dR) <= fTol)
+            {
+                fE0 = static_cast<float>(dE);
+                return i;
+            }
+            if (dR < 0.0) { dLo = dE; bLo = true; }
+            else          { dHi = dE; bHi = true; }
+
+            double dNext = (fDN > 0.0f) ? dE - dR/fDN : dE;
+            if (bLo && bHi)
+            {
+                if (!(dNext > dLo && dNext < dHi) || dNext == dE)
+                    dNext = 0.5*(dLo + dHi);
+                if (dHi - dLo < 1.0e-10)
+                    return -1;      // root sits on the jump in N when a fiber cracks
+            }
+            else if (fDN <= 0.0f)
+            {
+                dNext = dE + (dR < 0.0 ? dStep : -dStep);
+                dStep *= 2.0;
+            }
+            dE = dNext;
+        }
+        return -1;
+    }
+
+    // cold bisection
+    float fYMin = m_fVOutlineY[0], fYMax = m_fVOutlineY[0];
+    for (size_t i = 1; i < m_fVOutlineY.size(); i++)
+    {
+        fYMin = std::min(fYMin, m_fVOutlineY[i]);
+        fYMax = std::max(fYMax, m_fVOutlineY[i]);
+    }
+    double dLo = -fGY*fYMax - 2.0*std::max(m_fFy/m_fEs, m_fFr/m_fEc);
+    double dHi = m_fEps0 - fGY*fYMin;
+    for (int i = 1; i <= MAXITERATIONS; i++)
+    {
+        double dE = 0.5*(dLo + dHi);
+        IntegrateTangent (static_cast<float>(dE), 0.0f, fGY, fN, fMx, fMy, fDN);
+        double dR = static_cast<double>(fN) - fP;
+        if (fabs(dR) <= fTol)
+        {
+            fE0 = static_cast<float>(dE);
+            return i;
+        }
+        if (dHi - dLo < 1.0e-10)
+            return -1;
+        if (dR < 0.0) dLo = dE;
+        else          dHi = dE;
+    }
+    return -1;
+}
+
+float CFiberSection::GetP0 () const
+// ---------------------------------------------------------------------------
+// Function: nominal axial strength under uniform compression,
+//           P0 = 0.85 f'c (Ag - Ast) + fy Ast
+// Input:    none
+// Output:   P0
+// ---------------------------------------------------------------------------
+{
+    float fN, fMx, fMy;
+    Integrate (m_fEpsCU, 0.0f, 0.0f, fN, fMx, fMy);
+    return fN;
+}
+
+float CFiberSection::GetPhiPnMax () const
+// ---------------------------------------------------------------------------
+// Function: maximum design axial strength (ACI 318 Table 22.4.2.1),
+//           0.80 P0 for tied and 0.85 P0 for spiral columns
+// Input:    none
+// Output:   phi*Pn,max
+// ---------------------------------------------------------------------------
+{
+    float fFactor = m_bSpiral ? 0.85f : 0.80f;
+    return GetPhi (-m_fEpsCU) * fFactor * GetP0 ();
+}
+
+float CFiberSection::GetPhi (const float fEpsT) const
+// ---------------------------------------------------------------------------
+// Function: strength reduction factor from the net tensile strain
+//           (ACI 318 Table 21.2.2)
+// Input:    net tensile strain in the extreme tension steel
+// Output:   phi
+// ---------------------------------------------------------------------------
+{
+    float fEpsTY = m_fFy / m_fEs;
+    float fPhiC = m_bSpiral ? 0.75f : 0.65f;
+    float fSlope = m_bSpiral ? 0.15f : 0.25f;
+
+    float fPhi = fPhiC + fSlope * (fEpsT - fEpsTY) / (0.005f - fEpsTY);
+    return std::min(0.90f, std::max(fPhiC, fPhi));
+}
+
+void CFiberSection::StrainPlane (const float fNX, const float fNY,
+                                 const float fC, float& fE0, float& fGX,
+                                 float& fGY) const
+// ---------------------------------------------------------------------------
+// Function: strain plane at the ultimate state for a neutral axis depth
+//           measured from the extreme compression fiber
+// Input:    unit vector pointing to the compression side, depth c
+// Output:   e0, gx, gy
+// ---------------------------------------------------------------------------
+{
+    float fUMax = 0.0f;
+    for (size_t i = 0; i < m_fVOutlineX.size(); i++)
+    {
+        float fU = fNX*m_fVOutlineX[i] + fNY*m_fVOutlineY[i];
+        if (i == 0 || fU > fUMax) fUMax = fU;
+    }
+
+    float fK = m_fEpsCU / fC;  // curvature
+    fE0 = m_fEpsCU - fK*fUMax;
+    fGX = fK*fNX;
+    fGY = fK*fNY;
+}
+
+float CFiberSection::ExtremeDepth (const float fNX, const float fNY,
+                                   float& fDt) const
+// ---------------------------------------------------------------------------
+// Function: depth of the section and of the extreme tension steel,
+//           both measured from the extreme compression fiber
+// Input:    unit vector pointing to the compression side
+// Output:   returns the depth of the section, fDt is the depth of the
+//           extreme tension steel (section depth if there is no steel)
+// ---------------------------------------------------------------------------
+{
+    float fUMax = 0.0f, fUMin = 0.0f;
+    for (size_t i = 0; i < m_fVOutlineX.size(); i++)
+    {
+        float fU = fNX*m_fVOutlineX[i] + fNY*m_fVOutlineY[i];
+        if (i == 0 || fU > fUMax) fUMax = fU;
+        if (i == 0 || fU < fUMin) fUMin = fU;
+    }
+
+    fDt = fUMax - fUMin;
+    bool bFound = false;
+    for (int i = m_nConcrete; i < m_nFibers; i++)
+    {
+        if (m_fVA[i] <= 0.0f) continue;
+        float fD = fUMax - (fNX*m_fVX[i] + fNY*m_fVY[i]);
+        if (!bFound || fD > fDt) fDt = fD;
+        bFound = true;
+    }
+
+    return fUMax - fUMin;
+}
+
+int CFiberSection::GetNumFibers (MATID Mat) const
+// ---------------------------------------------------------------------------
+// Function: gets the number of fibers (including padding) of a material
+// Input:    material id
+// Output:   # of fibers
+// ---------------------------------------------------------------------------
+{
+    if (Mat == MATID::CONCRETE)
+        return m_nConcrete;
+    return m_nFibers - m_nConcrete;
+}
+
+void CFiberSection::GetCentroid (float& fXc, float& fYc) const
+// ---------------------------------------------------------------------------
+// Function: gets the centroid of the gross section
+// Input:    variables to hold the coordinates
+// Output:   centroid coordinates
+// ---------------------------------------------------------------------------
+{
+    fXc = m_fXc;
+    fYc = m_fYc;
+}
+
+float CFiberSection::GetGrossArea () const
+// ---------------------------------------------------------------------------
+// Function: gets the gross concrete area
+// Input:    none
+// Output:   gross area
+// ---------------------------------------------------------------------------
+{
+    return m_fAg;
+}
+
+float CFiberSection::GetSteelArea () const
+// ---------------------------------------------------------------------------
+// Function: gets the total area of the reinforcing bars
+// Input:    none
+// Output:   steel area
+// ---------------------------------------------------------------------------
+{
+    return m_fAs;
+}
+
+void CFiberSection::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
@@ -0,0 +1,136 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Fiber discretization of a reinforced concrete
+cross-section. The fibers are stored as
+structure-of-arrays buffers (x, y, area, material
+id, extents) so that the stress, force and moment sums are
+straight loops over contiguous memory. Concrete
+fibers come first and the reinforcing bars follow
+as point fibers; each group is padded with
+zero-area fibers to a multiple of NUMLANES.
+
+Two kernels share the buffers: Integrate uses the
+ACI rectangular stress block (strength), and
+IntegrateTangent uses a Hognestad parabola with
+linear tension up to the modulus of rupture and
+also returns the axial tangent stiffness (moment-
+curvature).
+
+Sign convention: compression is positive. The
+strain plane is eps(x,y) = e0 + gx*x + gy*y.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <vector>
+#include "..\libraryEXH\arraycontainersEXH.h"
+#include "xstype.h"
+#include "reinforcement.h"
+#include "LocalErrorHandler.h"
+#include "interaction.h"
+#include "threadpool.h"
+#include "momentcurvature.h"
+
+class CFiberSection
+{
+    public:
+        CFiberSection ();   // ctor
+        ~CFiberSection ();  // dtor
+
+        enum class MATID { CONCRETE = 0, STEEL = 1 };
+        static const int NUMLANES = 8;     // independent partial sums in the kernel
+        static const int DEFAULTDIVX = 16; // divisions across the width (sectors/2 for circles)
+        static const int DEFAULTDIVY = 48; // divisions over the depth (rings*2 for circles)
+
+        // helper functions
+        void Mesh (const CXSType& XS, int nDivX = DEFAULTDIVX,
+                   int nDivY = DEFAULTDIVY);
+        void AddBars (const CReinforcement& Re);
+        void Integrate (const float fE0, const float fGX, const float fGY,
+                        float& fN, float& fMx, float& fMy) const;
+        void IntegrateTangent (const float fE0, const float fGX,
+                               const float fGY, float& fN, float& fMx,
+                               float& fMy, float& fDN) const;
+        void FindMomentCapacity (const float fP, float& fMn, float& fPhiMn,
+                                 float& fC, float& fEpsT, float& fPhi) const;
+        void ComputeInteraction (CInteractionDiagram& Diagram,
+                                 const int nPoints,
+                                 CThreadPool& Pool) const;
+        void ComputeSurface (CInteractionSurface& Surface,
+                             const std::vector<float>& fVAngles,
+                             const int nDepths, CThreadPool& Pool) const;
+        void ComputeMomentCurvature (const float fP, const int nSteps,
+                                     const bool bWarmStart,
+                                     CMomentCurvature& MC) const;
+
+        // accessor functions
+        int   GetNumFibers (MATID Mat) const;
+        void  GetCentroid (float& fXc, float& fYc) const;
+        float GetGrossArea () const;
+        float GetSteelArea () const;
+        float GetPhi (const float fEpsT) const;
+        float GetP0 () const;
+        float GetPhiPnMax () const;
+
+        // modifier functions
+        void SetMaterials (const float fFc, const float fFy, const float fEs);
+        void SetSpiral (const bool bSpiral);
+
+    private:
+        // fiber buffers (structure of arrays)
+        std::vector<float> m_fVX;    // x-coordinate of fiber centroid
+        std::vector<float> m_fVY;    // y-coordinate of fiber centroid
+        std::vector<float> m_fVA;    // fiber area
+        std::vector<float> m_fVDX;   // fiber width (zero for bars)
+        std::vector<float> m_fVDY;   // fiber height (zero for bars)
+        std::vector<int>   m_nVMat;  // material id (MATID)
+        int m_nConcrete;             // # of concrete fibers (padded)
+        int m_nFibers;               // total # of fibers (padded)
+
+        // section outline used to locate the extreme compression fiber
+        std::vector<float> m_fVOutlineX, m_fVOutlineY;
+
+        float m_fXc, m_fYc;          // centroid of the gross section
+        float m_fAg;                 // gross area
+        float m_fAs;                 // total steel area
+
+        // material data
+        float m_fFc;                 // concrete compressive strength (ksi)
+        float m_fFy;                 // steel yield strength (ksi)
+        float m_fEs;                 // steel modulus (ksi)
+        float m_fBeta1;              // stress block depth factor
+        float m_fEpsCU;              // limiting concrete strain
+        float m_fEc;                 // concrete modulus (ksi)
+        float m_fEps0;               // strain at peak concrete stress
+        float m_fFr;                 // modulus of rupture (ksi)
+        bool  m_bSpiral;             // spiral (true) or tied (false) transverse steel
+
+        void AddRectangle (float fX1, float fY1, float fX2, float fY2,
+                           int nDivX, int nDivY);
+        void AddCircle (float fR, int nSectors, int nRings);
+        void PadFibers ();
+        void StrainPlane (const float fNX, const float fNY, const float fC,
+                          float& fE0, float& fGX, float& fGY) const;
+        float ExtremeDepth (const float fNX, const float fNY,
+                            float& fDt) const;
+        void InteractionPoint (const float fNX, const float fNY,
+                               const int i, const int nPoints,
+                               float& fPn, float& fMx, float& fMy,
+                               float& fC, float& fEpsT) const;
+        float NeutralAxisDepth (const float fP, const bool bFactored) const;
+        int  SolveAxialStrain (const float fP, const float fGY,
+                               const float fTol, const bool bWarmStart,
+                               float& fE0, float& fMx) const;
+        bool RefineKeyPoint (const float fP, const float fY,
+                             const float fEpsKey, const float fTol,
+                             const bool bWarmStart, float fPhiA, float fE0A,
+                             float fPhiB, float fE0B, float& fPhi,
+                             float& fM, float& fE0) const;
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+};
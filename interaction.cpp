@@ -0,0 +1,550 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CInteractionDiagram and
+CInteractionSurface classes.
+
+TODO:
+
+**********************************************/
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include "interaction.h"
+
+CInteractionDiagram::CInteractionDiagram ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fPhiPnMax = std::numeric_limits<float>::max();
+}
+
+CInteractionDiagram::~CInteractionDiagram ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CInteractionDiagram::SetSize (const int nPoints)
+// ---------------------------------------------------------------------------
+// Function: allocates space for the points of the diagram
+// Input:    # of points
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    size_t n = static_cast<size_t>(std::max(nPoints, 0));
+    m_fVPn.assign (n, 0.0f);
+    m_fVMn.assign (n, 0.0f);
+    m_fVPhiPn.assign (n, 0.0f);
+    m_fVPhiMn.assign (n, 0.0f);
+    m_fVPhi.assign (n, 0.0f);
+    m_fVC.assign (n, 0.0f);
+    m_fVEpsT.assign (n, 0.0f);
+    m_fPhiPnMax = std::numeric_limits<float>::max();
+}
+
+void CInteractionDiagram::SetPoint (const int i, const float fPn,
+                                    const float fMn, const float fPhi,
+                                    const float fC, const float fEpsT)
+// ---------------------------------------------------------------------------
+// Function: stores a point of the diagram. points may be set from
+//           different threads as long as the indices differ
+// Input:    point number (1-based), nominal strengths, phi, depth c and
+//           net tensile strain
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    size_t k = static_cast<size_t>(i - 1);
+    m_fVPn[k] = fPn;
+    m_fVMn[k] = fMn;
+    m_fVPhi[k] = fPhi;
+    m_fVC[k] = fC;
+    m_fVEpsT[k] = fEpsT;
+    m_fVPhiPn[k] = std::min(fPhi*fPn, m_fPhiPnMax);
+    m_fVPhiMn[k] = fPhi*fMn;
+}
+
+void CInteractionDiagram::SetPhiPnMax (const float fPhiPnMax)
+// ---------------------------------------------------------------------------
+// Function: sets the maximum design axial strength and caps the design
+//           curve with it
+// Input:    phi*Pn,max
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fPhiPnMax = fPhiPnMax;
+    for (size_t k = 0; k < m_fVPn.size(); k++)
+        m_fVPhiPn[k] = std::min(m_fVPhi[k]*m_fVPn[k], m_fPhiPnMax);
+}
+
+float CInteractionDiagram::GetDesignMoment (const float fPu) const
+// ---------------------------------------------------------------------------
+// Function: design moment strength at a factored axial load, found by
+//           linear interpolation along the design curve. the axial
+//           strength decreases monotonically from point 1 to the last
+//           point, so the first bracketing segment is used
+// Input:    factored axial load (compression positive)
+// Output:   returns phi*Mn (zero if Pu is outside the diagram)
+// ---------------------------------------------------------------------------
+{
+    size_t n = m_fVPhiPn.size();
+    if (n == 0 || fPu > m_fPhiPnMax)
+        return 0.0f;
+
+    for (size_t k = 1; k < n; k++)
+    {
+        float fP1 = m_fVPhiPn[k-1], fP2 = m_fVPhiPn[k];
+        if ((fPu <= fP1 && fPu >= fP2) || (fPu >= fP1 && fPu <= fP2))
+        {
+            float fDP = fP2 - fP1;
+            if (fDP == 0.0f)
+                return std::max(m_fVPhiMn[k-1], m_fVPhiMn[k]);
+            float fT = (fPu - fP1) / fDP;
+            return m_fVPhiMn[k-1] + fT*(m_fVPhiMn[k] - m_fVPhiMn[k-1]);
+        }
+    }
+    return 0.0f;
+}
+
+void CInteractionDiagram::Pack (std::vector<float>& fV) const
+// ---------------------------------------------------------------------------
+// Function: flattens the diagram for storage: # of points, phi*Pn,max,
+//           then Pn, Mn, phi, c and net tensile strain arrays
+// Input:    none
+// Output:   packed values
+// ---------------------------------------------------------------------------
+{
+    fV.clear ();
+    fV.push_back (static_cast<float>(m_fVPn.size()));
+    fV.push_back (m_fPhiPnMax);
+    for (const std::vector<float>* pV : {&m_fVPn, &m_fVMn, &m_fVPhi, &m_fVC,
+                                         &m_fVEpsT})
+        fV.insert (fV.end(), pV->begin(), pV->end());
+}
+
+bool CInteractionDiagram::Unpack (const std::vector<float>& fV)
+// ---------------------------------------------------------------------------
+// Function: rebuilds the diagram from the values stored by Pack
+// Input:    packed values
+// Output:   returns false (diagram unchanged) if the values do not match
+// ---------------------------------------------------------------------------
+{
+    if (fV.size() < 2)
+        return false;
+    int nPoints = static_cast<int>(fV[0]);
+    size_t n = static_cast<size_t>(std::max(nPoints, 0));
+    if (fV.size() != 2 + 5*n)
+        return false;
+
+    SetSize (nPoints);
+    const float* pV = fV.data() + 2;
+    for (size_t k = 0; k < n; k++)
+        SetPoint (static_cast<int>(k) + 1, pV[k], pV[n+k], pV[2*n+k],
+                  pV[3*n+k], pV[4*n+k]);
+    SetPhiPnMax (fV[1]);
+    return true;
+}
+
+int CInteractionDiagram::GetNumPoints () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of points in the diagram
+// Input:    none
+// Output:   # of points
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_fVPn.size());
+}
+
+void CInteractionDiagram::GetPoint (const int i, float& fPn, float& fMn,
+                                    float& fPhi, float& fC,
+                                    float& fEpsT) const
+// ---------------------------------------------------------------------------
+// Function: gets a point of the nominal diagram
+// Input:    point number (1-based)
+// Output:   Pn, Mn, phi, depth c and net tensile strain
+// ---------------------------------------------------------------------------
+{
+    size_t k = static_cast<size_t>(i - 1);
+    fPn = m_fVPn[k];
+    fMn = m_fVMn[k];
+    fPhi = m_fVPhi[k];
+    fC = m_fVC[k];
+    fEpsT = m_fVEpsT[k];
+}
+
+void CInteractionDiagram::GetDesignPoint (const int i, float& fPhiPn,
+                                          float& fPhiMn) const
+// ---------------------------------------------------------------------------
+// Function: gets a point of the design (phi-factored) diagram
+// Input:    point number (1-based)
+// Output:   phi*Pn (capped at phi*Pn,max), phi*Mn
+// ---------------------------------------------------------------------------
+{
+    size_t k = static_cast<size_t>(i - 1);
+    fPhiPn = m_fVPhiPn[k];
+    fPhiMn = m_fVPhiMn[k];
+}
+
+float CInteractionDiagram::GetPhiPnMax () const
+// ---------------------------------------------------------------------------
+// Function: gets the maximum design axial strength
+// Input:    none
+// Output:   phi*Pn,max
+// ---------------------------------------------------------------------------
+{
+    return m_fPhiPnMax;
+}
+
+const float* CInteractionDiagram::GetPn () const
+// ---------------------------------------------------------------------------
+// Function: gets the nominal axial strengths as a contiguous array
+// Input:    none
+// Output:   pointer to GetNumPoints() values
+// ---------------------------------------------------------------------------
+{
+    return m_fVPn.data();
+}
+
+const float* CInteractionDiagram::GetMn () const
+// ---------------------------------------------------------------------------
+// Function: gets the nominal moment strengths as a contiguous array
+// Input:    none
+// Output:   pointer to GetNumPoints() values
+// ---------------------------------------------------------------------------
+{
+    return m_fVMn.data();
+}
+
+const float* CInteractionDiagram::GetPhiPn () const
+// ---------------------------------------------------------------------------
+// Function: gets the design axial strengths as a contiguous array
+// Input:    none
+// Output:   pointer to GetNumPoints() values
+// ---------------------------------------------------------------------------
+{
+    return m_fVPhiPn.data();
+}
+
+const float* CInteractionDiagram::GetPhiMn () const
+// ---------------------------------------------------------------------------
+// Function: gets the design moment strengths as a contiguous array
+// Input:    none
+// Output:   pointer to GetNumPoints() values
+// ---------------------------------------------------------------------------
+{
+    return m_fVPhiMn.data();
+}
+
+// ============================== CInteractionSurface ======================
+CInteractionSurface::CInteractionSurface ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_nAngles = m_nDepths = 0;
+    m_fPhiPnMax = std::numeric_limits<float>::max();
+}
+
+CInteractionSurface::~CInteractionSurface ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+size_t CInteractionSurface::Index (const int i, const int j) const
+// ---------------------------------------------------------------------------
+// Function: position of a mesh point in the storage arrays
+// Input:    angle number, depth point number (both 1-based)
+// Output:   0-based index
+// ---------------------------------------------------------------------------
+{
+    return static_cast<size_t>(i - 1)*static_cast<size_t>(m_nDepths)
+           + static_cast<size_t>(j - 1);
+}
+
+void CInteractionSurface::SetSize (const int nAngles, const int nDepths)
+// ---------------------------------------------------------------------------
+// Function: allocates space for the mesh
+// Input:    # of angles, # of depth points per angle
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_nAngles = std::max(nAngles, 0);
+    m_nDepths = std::max(nDepths, 0);
+    size_t n = static_cast<size_t>(m_nAngles)*static_cast<size_t>(m_nDepths);
+    m_fVAngle.assign (static_cast<size_t>(m_nAngles), 0.0f);
+    m_fVPn.assign (n, 0.0f);
+    m_fVMx.assign (n, 0.0f);
+    m_fVMy.assign (n, 0.0f);
+    m_fVPhi.assign (n, 0.0f);
+    m_fVPhiPn.assign (n, 0.0f);
+    m_fPhiPnMax = std::numeric_limits<float>::max();
+}
+
+void CInteractionSurface::SetAngle (const int i, const float fTheta)
+// ---------------------------------------------------------------------------
+// Function: sets the orientation of a depth sweep
+// Input:    angle number (1-based), direction of the compression side
+//           measured from the +x axis (radians)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fVAngle[static_cast<size_t>(i - 1)] = fTheta;
+}
+
+void CInteractionSurface::SetPoint (const int i, const int j,
+                                    const float fPn, const float fMx,
+                                    const float fMy, const float fPhi)
+// ---------------------------------------------------------------------------
+// Function: stores a mesh point. points may be set from different
+//           threads as long as the indices differ
+// Input:    angle and depth point numbers (1-based), nominal strengths, phi
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    size_t k = Index (i, j);
+    m_fVPn[k] = fPn;
+    m_fVMx[k] = fMx;
+    m_fVMy[k] = fMy;
+    m_fVPhi[k] = fPhi;
+    m_fVPhiPn[k] = std::min(fPhi*fPn, m_fPhiPnMax);
+}
+
+void CInteractionSurface::SetPhiPnMax (const float fPhiPnMax)
+// ---------------------------------------------------------------------------
+// Function: sets the maximum design axial strength and caps the design
+//           surface with it
+// Input:    phi*Pn,max
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fPhiPnMax = fPhiPnMax;
+    for (size_t k = 0; k < m_fVPn.size(); k++)
+        m_fVPhiPn[k] = std::min(m_fVPhi[k]*m_fVPn[k], m_fPhiPnMax);
+}
+
+void CInteractionSurface::GetMomentContour (const float fPu,
+                                            std::vector<float>& fVMx,
+                                            std::vector<float>& fVMy) const
+// ---------------------------------------------------------------------------
+// Function: design moment contour at a factored axial load. each depth
+//           sweep is interpolated at Pu, giving one (phi*Mx, phi*My)
+//           point per angle
+// Input:    factored axial load (compression positive)
+// Output:   contour points in angle order (empty if Pu is outside the
+//           surface)
+// ---------------------------------------------------------------------------
+{
+    fVMx.clear ();
+    fVMy.clear ();
+    if (m_nAngles == 0 || fPu > m_fPhiPnMax)
+        return;
+
+    for (int i = 1; i <= m_nAngles; i++)
+    {
+        size_t k0 = Index (i, 1);
+        for (int j = 1; j < m_nDepths; j++)
+        {
+            size_t k = k0 + static_cast<size_t>(j);
+            float fP1 = m_fVPhiPn[k-1], fP2 = m_fVPhiPn[k];
+            if ((fPu <= fP1 && fPu >= fP2) || (fPu >= fP1 && fPu <= fP2))
+            {
+                float fDP = fP2 - fP1;
+                float fT = (fDP == 0.0f) ? 1.0f : (fPu - fP1) / fDP;
+                float fMx1 = m_fVPhi[k-1]*m_fVMx[k-1], fMx2 = m_fVPhi[k]*m_fVMx[k];
+                float fMy1 = m_fVPhi[k-1]*m_fVMy[k-1], fMy2 = m_fVPhi[k]*m_fVMy[k];
+                fVMx.push_back (fMx1 + fT*(fMx2 - fMx1));
+                fVMy.push_back (fMy1 + fT*(fMy2 - fMy1));
+                break;
+            }
+        }
+    }
+
+    // every sweep must cross Pu for the contour to be closed
+    if (static_cast<int>(fVMx.size()) != m_nAngles)
+    {
+        fVMx.clear ();
+        fVMy.clear ();
+    }
+}
+
+float CInteractionSurface::GetCapacityRatio (const float fPu,
+                                             const float fMux,
+                                             const float fMuy) const
+// ---------------------------------------------------------------------------
+// Function: demand to capacity ratio for a biaxial load. the design
+//           moment contour at Pu is intersected with the ray through
+//           (Mux, Muy); the ratio is |Mu| over the distance to the
+//           contour along that ray
+// Input:    factored axial load and moments
+// Output:   returns the ratio (<= 1 is adequate); FLT_MAX if Pu is
+//           outside the surface
+// ---------------------------------------------------------------------------
+{
+    std::vector<float> fVMx, fVMy;
+    GetMomentContour (fPu, fVMx, fVMy);
+    if (fVMx.empty())
+        return std::numeric_limits<float>::max();
+
+    double dMu = sqrt(static_cast<double>(fMux)*fMux + static_cast<double>(fMuy)*fMuy);
+    if (dMu == 0.0)
+        return 0.0f;
+    double dUX = fMux/dMu, dUY = fMuy/dMu;
+
+    // farthest crossing of the ray with the closed contour
+    double dSMax = 0.0;
+    size_t n = fVMx.size();
+    for (size_t k = 0; k < n; k++)
+    {
+        size_t k1 = (k + 1) % n;
+        double dAX = fVMx[k], dAY = fVMy[k];
+        double dEX = fVMx[k1] - dAX, dEY = fVMy[k1] - dAY;
+        double dDet = dEX*dUY - dEY*dUX;
+        if (fabs(dDet) < 1.0e-12)
+            continue;
+        double dT = (dAY*dUX - dAX*dUY) / dDet;
+        if (dT < 0.0 || dT > 1.0)
+            continue;
+        double dS = (dAX + dT*dEX)*dUX + (dAY + dT*dEY)*dUY;
+        dSMax = std::max(dSMax, dS);
+    }
+
+    if (dSMax <= 0.0)
+        return std::numeric_limits<float>::max();
+    return static_cast<float>(dMu / dSMax);
+}
+
+void CInteractionSurface::Pack (std::vector<float>& fV) const
+// ---------------------------------------------------------------------------
+// Function: flattens the surface for storage: # of angles, # of depth
+//           points, phi*Pn,max, the angles, then Pn, Mx, My and phi
+//           arrays
+// Input:    none
+// Output:   packed values
+// ---------------------------------------------------------------------------
+{
+    fV.clear ();
+    fV.push_back (static_cast<float>(m_nAngles));
+    fV.push_back (static_cast<float>(m_nDepths));
+    fV.push_back (m_fPhiPnMax);
+    for (const std::vector<float>* pV : {&m_fVAngle, &m_fVPn, &m_fVMx, &m_fVMy,
+                                         &m_fVPhi})
+        fV.insert (fV.end(), pV->begin(), pV->end());
+}
+
+bool CInteractionSurface::Unpack (const std::vector<float>& fV)
+// ---------------------------------------------------------------------------
+// Function: rebuilds the surface from the values stored by Pack
+// Input:    packed values
+// Output:   returns false (surface unchanged) if the values do not match
+// ---------------------------------------------------------------------------
+{
+    if (fV.size() < 3)
+        return false;
+    int nAngles = std::max(static_cast<int>(fV[0]), 0);
+    int nDepths = std::max(static_cast<int>(fV[1]), 0);
+    size_t n = static_cast<size_t>(nAngles)*static_cast<size_t>(nDepths);
+    if (fV.size() != 3 + static_cast<size_t>(nAngles) + 4*n)
+        return false;
+
+    SetSize (nAngles, nDepths);
+    const float* pA = fV.data() + 3;
+    const float* pV = pA + nAngles;
+    for (int i = 1; i <= nAngles; i++)
+    {
+        SetAngle (i, pA[i-1]);
+        for (int j = 1; j <= nDepths; j++)
+        {
+            size_t k = Index (i, j);
+            SetPoint (i, j, pV[k], pV[n+k], pV[2*n+k], pV[3*n+k]);
+        }
+    }
+    SetPhiPnMax (fV[2]);
+    return true;
+}
+
+int CInteractionSurface::GetNumAngles () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of neutral axis orientations
+// Input:    none
+// Output:   # of angles
+// ---------------------------------------------------------------------------
+{
+    return m_nAngles;
+}
+
+int CInteractionSurface::GetNumDepths () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of points in each depth sweep
+// Input:    none
+// Output:   # of depth points
+// ---------------------------------------------------------------------------
+{
+    return m_nDepths;
+}
+
+float CInteractionSurface::GetAngle (const int i) const
+// ---------------------------------------------------------------------------
+// Function: gets the orientation of a depth sweep
+// Input:    angle number (1-based)
+// Output:   direction of the compression side from the +x axis (radians)
+// ---------------------------------------------------------------------------
+{
+    return m_fVAngle[static_cast<size_t>(i - 1)];
+}
+
+void CInteractionSurface::GetPoint (const int i, const int j, float& fPn,
+                                    float& fMx, float& fMy,
+                                    float& fPhi) const
+// ---------------------------------------------------------------------------
+// Function: gets a point of the nominal surface
+// Input:    angle and depth point numbers (1-based)
+// Output:   Pn, Mnx, Mny, phi
+// ---------------------------------------------------------------------------
+{
+    size_t k = Index (i, j);
+    fPn = m_fVPn[k];
+    fMx = m_fVMx[k];
+    fMy = m_fVMy[k];
+    fPhi = m_fVPhi[k];
+}
+
+void CInteractionSurface::GetDesignPoint (const int i, const int j,
+                                          float& fPhiPn, float& fPhiMx,
+                                          float& fPhiMy) const
+// ---------------------------------------------------------------------------
+// Function: gets a point of the design (phi-factored) surface
+// Input:    angle and depth point numbers (1-based)
+// Output:   phi*Pn (capped at phi*Pn,max), phi*Mnx, phi*Mny
+// ---------------------------------------------------------------------------
+{
+    size_t k = Index (i, j);
+    fPhiPn = m_fVPhiPn[k];
+    fPhiMx = m_fVPhi[k]*m_fVMx[k];
+    fPhiMy = m_fVPhi[k]*m_fVMy[k];
+}
+
+float CInteractionSurface::GetPhiPnMax () const
+// ---------------------------------------------------------------------------
+// Function: gets the maximum design axial strength
+// Input:    none
+// Output:   phi*Pn,max
+// ---------------------------------------------------------------------------
+{
+    return m_fPhiPnMax;
+}
@@ -0,0 +1,110 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Axial load - moment interaction diagram. The
+points are kept in contiguous arrays ordered from
+pure compression (point 1) to pure tension (last
+point) so that later checks can scan or
+interpolate them directly.
+
+The biaxial surface is a structured mesh: one
+depth sweep (same ordering as the diagram) for each
+orientation of the neutral axis, stored row by row.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <vector>
+
+class CInteractionDiagram
+{
+    public:
+        CInteractionDiagram ();   // ctor
+        ~CInteractionDiagram ();  // dtor
+
+        static const int DEFAULTPOINTS = 200; // # of points on a diagram
+
+        // helper functions
+        float GetDesignMoment (const float fPu) const;
+        void  Pack (std::vector<float>& fV) const;
+        bool  Unpack (const std::vector<float>& fV);
+
+        // accessor functions
+        int   GetNumPoints () const;
+        void  GetPoint (const int i, float& fPn, float& fMn, float& fPhi,
+                        float& fC, float& fEpsT) const;
+        void  GetDesignPoint (const int i, float& fPhiPn, float& fPhiMn) const;
+        float GetPhiPnMax () const;
+        const float* GetPn () const;
+        const float* GetMn () const;
+        const float* GetPhiPn () const;
+        const float* GetPhiMn () const;
+
+        // modifier functions
+        void SetSize (const int nPoints);
+        void SetPoint (const int i, const float fPn, const float fMn,
+                       const float fPhi, const float fC, const float fEpsT);
+        void SetPhiPnMax (const float fPhiPnMax);
+
+    private:
+        std::vector<float> m_fVPn;     // nominal axial strength
+        std::vector<float> m_fVMn;     // nominal moment strength
+        std::vector<float> m_fVPhiPn;  // design axial strength (capped)
+        std::vector<float> m_fVPhiMn;  // design moment strength
+        std::vector<float> m_fVPhi;    // strength reduction factor
+        std::vector<float> m_fVC;      // neutral axis depth (0 at the ends)
+        std::vector<float> m_fVEpsT;   // net tensile strain
+        float m_fPhiPnMax;             // maximum design axial strength
+};
+
+class CInteractionSurface
+{
+    public:
+        CInteractionSurface ();   // ctor
+        ~CInteractionSurface ();  // dtor
+
+        static const int DEFAULTANGLES = 36;  // # of neutral axis orientations
+
+        // helper functions
+        void  GetMomentContour (const float fPu, std::vector<float>& fVMx,
+                                std::vector<float>& fVMy) const;
+        float GetCapacityRatio (const float fPu, const float fMux,
+                                const float fMuy) const;
+        void  Pack (std::vector<float>& fV) const;
+        bool  Unpack (const std::vector<float>& fV);
+
+        // accessor functions
+        int   GetNumAngles () const;
+        int   GetNumDepths () const;
+        float GetAngle (const int i) const;
+        void  GetPoint (const int i, const int j, float& fPn, float& fMx,
+                        float& fMy, float& fPhi) const;
+        void  GetDesignPoint (const int i, const int j, float& fPhiPn,
+                              float& fPhiMx, float& fPhiMy) const;
+        float GetPhiPnMax () const;
+
+        // modifier functions
+        void SetSize (const int nAngles, const int nDepths);
+        void SetAngle (const int i, const float fTheta);
+        void SetPoint (const int i, const int j, const float fPn,
+                       const float fMx, const float fMy, const float fPhi);
+        void SetPhiPnMax (const float fPhiPnMax);
+
+    private:
+        int m_nAngles;                 // # of neutral axis orientations
+        int m_nDepths;                 // # of points in each depth sweep
+        std::vector<float> m_fVAngle;  // compression direction (radians from +x)
+        std::vector<float> m_fVPn;     // nominal strengths (angle-major)
+        std::vector<float> m_fVMx;
+        std::vector<float> m_fVMy;
+        std::vector<float> m_fVPhi;    // strength reduction factor
+        std::vector<float> m_fVPhiPn;  // design axial strength (capped)
+        float m_fPhiPnMax;             // maximum design axial strength
+
+        size_t Index (const int i, const int j) const;
+};
@@ -21,6 +21,22 @@ TODO:
 #include "tsection.h"
 #include "printtableEXH.h"
 #include "xstype.h"
+#include "binarysection.h"
+
+static bool IsBinaryInput (const std::string& strFileName)
+// ---------------------------------------------------------------------------
+// Function: checks whether an input file is in the binary (.xsb) format
+// Input:    file name
+// Output:   true if the name ends in .xsb (any case)
+// ---------------------------------------------------------------------------
+{
+    const std::string strExtension = ".xsb";
+    if (strFileName.size() < strExtension.size())
+        return false;
+    return CParser::IsEqual (std::string_view(strFileName).substr(
+                             strFileName.size() - strExtension.size()),
+                             strExtension);
+}
 
 void CElement::Banner (std::ostream& OF)
 // ---------------------------------------------------------------------------
@@ -59,6 +75,8 @@ void CElement::PrepareIO (int argc, char *argv[])
         m_FileInput.open (argv[1], std::ios::in);
         if (!m_FileInput)
             ErrorHandler (CGlobalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+        m_strInputName = argv[1];
+        m_bBinaryInput = IsBinaryInput (m_strInputName);
         m_FileOutput.open (argv[2], std::ios::out);
         if (!m_FileOutput)
             ErrorHandler (CGlobalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
@@ -75,154 +93,37 @@ void CElement::PrepareIO (int argc, char *argv[])
     Banner (m_FileOutput);
 }
 
-void CElement::ReadProblemSize ()
+void CElement::PrepareIO (const std::string& strInput,
+                          const std::string& strOutput)
 // ---------------------------------------------------------------------------
-// Function: Reads the number of reinforcement groups (in and out of plane)
-// Input:    None
+// Function: opens the input/output files of a batch job (no console
+//           output so that jobs can run concurrently)
+// Input:    input and output file names
 // Output:   None
-// TODO: Point to where the invalid input is, and what it is.
 // ---------------------------------------------------------------------------
 {
-    bool bEOF = false;
-    try
-    {
-        // Read the Problem Description
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        if (m_strVTokens[0] != "*heading")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-
-        // Unit Mode
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        if (m_strVTokens[0] != "*unit" && m_strVTokens[1] != "mode")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-
-        // Member Type
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        if (m_strVTokens[0] != "*column" && m_strVTokens[1] != "or" && m_strVTokens[2] != "beam")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-
-
-        // Concrete Material Properties
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        if (m_strVTokens[0] != "*concrete" && m_strVTokens[1] != "material" && m_strVTokens[2] != "properties")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-
-        // Reinforcement Material Properties
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        if (m_strVTokens[0] != "*reinforcement" && m_strVTokens[1] != "material" && m_strVTokens[2] != "properties")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-
-        // Element Geometry
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        if (m_strVTokens[0] != "*geometry")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-
-        // Cross-Sectional Reinforcement Data
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        if (m_strVTokens[0] != "*xs" && m_strVTokens[1] != "reinforcements")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-
-        for (;;)
-        {
-            m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-                m_nTokens, m_strDelimiters, m_strComment,
-                bEOF);
-            if (m_strVTokens[0] == "*transverse" && m_strVTokens[1] == "reinforcements")
-                break;
-            ++m_nXSR;
-        }
-
-        // Out of Plane Reinforcement Data
-        for (;;)
-        {
-            m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-                m_nTokens, m_strDelimiters, m_strComment,
-                bEOF);
-            if (m_strVTokens[0] == "*transverse" && m_strVTokens[1] == "spacings")
-                break;
-            ++m_nTR;
-        }
-
-        // Transverse Reinforcement Spacings
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-
-        // Max Values
-        if (m_strVTokens[0] != "*max" && m_strVTokens[1] != "values") {
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        }
-        if (m_strVTokens[0] != "*max" && m_strVTokens[1] != "values")
-            IOErrorHandler(ERRORCODE::INVALIDINPUT);
-
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-    }
-    // Trap all input file errors here
-    catch (CLocalErrorHandler::ERRORCODE &err)
-    {
-        m_LEH.ErrorHandler (err);
-    }
-
-    catch (CGlobalErrorHandler::ERRORCODE &err)
-    {
-        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
-    }
-
-    catch (...)
-    {
-        std::cout << "Sorry, could not catch the error whatever it is.\n";
-    }
+    m_FileInput.open (strInput, std::ios::in);
+    if (!m_FileInput)
+        ErrorHandler (CGlobalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    m_strInputName = strInput;
+    m_bBinaryInput = IsBinaryInput (m_strInputName);
+    m_FileOutput.open (strOutput, std::ios::out);
+    if (!m_FileOutput)
+        ErrorHandler (CGlobalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
 
-    // check data for validity
-    if (m_nDebugLevel < 0 || m_nDebugLevel > 1) 
-        IOErrorHandler (ERRORCODE::DEBUGCODE);
+    // print banner
+    Banner (m_FileOutput);
 }
 
-void CElement::ReadModel ()
+void CElement::ReadModel (std::istream& Input)
 // ---------------------------------------------------------------------------
-// Function: Reads the rest of the frame data from input file
-// Input:    none
+// Function: Reads the model data from the input file in a single pass.
+//           The input is read into the parser's buffer and the tokens are
+//           views into it. The bar and transverse reinforcement lines are
+//           collected as they are read (their number is not known in
+//           advance), so the input is never rewound and may be a
+//           non-seekable stream.
+// Input:    input stream
 // Output:   none
 // ---------------------------------------------------------------------------
 {
@@ -231,31 +132,37 @@ void CElement::ReadModel ()
 
     try
     {
-        // Rewind the file to read the input file again
-        m_FIO.Rewind (m_FileInput);
+        // the whole input is tokenized from one buffer
+        m_Parse.LoadBuffer (Input);
         m_nLineNumber = 0;
 
         // Header line
-        m_Parse.GetTokens (m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
                            m_nTokens, m_strDelimiters, m_strComment,
                            bEOF);
-        m_Parse.GetTokens (m_FileInput, m_nLineNumber, m_strVTokens,
+        if (m_strVTokens[0] != "*heading")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
                            m_nTokens, m_strDelimiters, m_strComment,
                            bEOF);
 
         // Unit Mode
-        m_Parse.GetTokens (m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
                            m_nTokens, m_strDelimiters, m_strComment,
                            bEOF);
-        m_Parse.GetTokens (m_FileInput, m_nLineNumber, m_strVTokens,
+        if (m_strVTokens[0] != "*unit" && m_strVTokens[1] != "mode")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
                            m_nTokens, m_strDelimiters, m_strComment,
                            bEOF);
 
         // Member Type
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        if (m_strVTokens[0] != "*column" && m_strVTokens[1] != "or" && m_strVTokens[2] != "beam")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
         if (m_strVTokens[0] == "column") {
@@ -270,11 +177,13 @@ void CElement::ReadModel ()
 
 
         // Read concrete material data
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
+        if (m_strVTokens[0] != "*concrete" && m_strVTokens[1] != "material" && m_strVTokens[2] != "properties")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
 
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
         if (m_nTokens != 3)
@@ -283,18 +192,20 @@ void CElement::ReadModel ()
         m_Parse.GetFloatValue(m_strVTokens[1], fVC(2));
         m_Parse.GetFloatValue(m_strVTokens[2], fVC(3));
         if (fVC(1) <= 0.0f || fVC(2) <= 0.0f || fVC(3) <= 0.0f)
-            IOErrorHandler(ERRORCODE::MATPROPERTY);
+            InputError(ERRORCODE::MATPROPERTY);
 
         m_ConcMatData(1).SetCompStr(fVC(1));
         m_ConcMatData(1).SetDensity(fVC(2));
         m_ConcMatData(1).SetPoisson(fVC(3));
 
         // Read reinforcement material data
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
+        if (m_strVTokens[0] != "*reinforcement" && m_strVTokens[1] != "material" && m_strVTokens[2] != "properties")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
 
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
         if (m_nTokens != 3)
@@ -303,20 +214,22 @@ void CElement::ReadModel ()
         m_Parse.GetFloatValue(m_strVTokens[1], fVC(2));
         m_Parse.GetFloatValue(m_strVTokens[2], fVC(3));
         if (fVC(1) <= 0.0f || fVC(2) <= 0.0f || fVC(3) <= 0.0f)
-            IOErrorHandler(ERRORCODE::MATPROPERTY);
+            InputError(ERRORCODE::MATPROPERTY);
 
-        m_ConcMatData(1).SetYieldStr(fVC(1));
-        m_ConcMatData(1).SetYM(fVC(2));
-        m_ConcMatData(1).SetDensity(fVC(3));
+        m_ReMatData(1).SetYieldStr(fVC(1));
+        m_ReMatData(1).SetYM(fVC(2));
+        m_ReMatData(1).SetDensity(fVC(3));
 
         // read cross-sectional geometry data
         std::string strTag;
         CVector<float> fVXSDims(MAXEPDIM);
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
+        if (m_strVTokens[0] != "*geometry")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
 
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
 
@@ -327,7 +240,7 @@ void CElement::ReadModel ()
             m_Parse.GetFloatValue(m_strVTokens[1], fVXSDims(1));
             m_Parse.GetFloatValue(m_strVTokens[2], fVXSDims(2));
             if (fVXSDims(1) <= 0.0f || fVXSDims(2) <= 0.0f)
-                IOErrorHandler(ERRORCODE::XSDIMENSION);
+                InputError(ERRORCODE::XSDIMENSION);
             m_EPData(1) = new CRectSolid(fVXSDims);
         }
         else if (m_strVTokens[0] == "t")
@@ -340,7 +253,7 @@ void CElement::ReadModel ()
             m_Parse.GetFloatValue(m_strVTokens[4], fVXSDims(4));
             if (fVXSDims(1) <= 0.0f || fVXSDims(2) <= 0.0f ||
                 fVXSDims(3) <= 0.0f || fVXSDims(4) <= 0.0f)
-                IOErrorHandler(ERRORCODE::XSDIMENSION);
+                InputError(ERRORCODE::XSDIMENSION);
             m_EPData(1) = new CTSection(fVXSDims);
         }
         else if (m_strVTokens[0] == "circular")
@@ -349,188 +262,1028 @@ void CElement::ReadModel ()
                 IOErrorHandler(ERRORCODE::INVALIDINPUT);
             m_Parse.GetFloatValue(m_strVTokens[1], fVXSDims(1));
             if (fVXSDims(1) <= 0.0f)
-                IOErrorHandler(ERRORCODE::XSDIMENSION);
+                InputError(ERRORCODE::XSDIMENSION);
             m_EPData(1) = new CCircSolid(fVXSDims);
         }
         else
             IOErrorHandler(ERRORCODE::XSTYPE);
 
-        // Read XS Reinforcements data
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        // Read XS Reinforcements data (until *transverse reinforcements)
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
-        /*
-        if (m_strVTokens[0] != "*XS REINFORCEMENTS")
-            IOErrorHandler(ERRORCODE::XSREINFO);
-            */
+        if (m_strVTokens[0] != "*xs" && m_strVTokens[1] != "reinforcements")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
 
-        float fBarDia, fX, fY;
-        CVector<float> fVReData(3*m_nXSR);
-        
-        for (int i = 1; i <= m_nXSR; i++) {
-            m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        std::vector<float> fVBars;
+        for (;;) {
+            m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
                 m_nTokens, m_strDelimiters, m_strComment,
                 bEOF);
-            m_Parse.GetFloatValue(m_strVTokens[0], fBarDia);
-            m_Parse.GetFloatValue(m_strVTokens[1], fX);
-            m_Parse.GetFloatValue(m_strVTokens[2], fY);
-            fVReData(3 * i - 2) = fBarDia;
-            fVReData(3 * i - 1) = fX;
-            fVReData(3 * i) = fY;
+            if (m_strVTokens[0] == "*transverse" && m_strVTokens[1] == "reinforcements")
+                break;
+            if (ReadBarPattern(fVXSDims, fVBars))
+                continue;
+            float fBar[3];
+            if (!m_Parse.GetFloatValues(m_strVTokens, 0, 3, fBar)) {
+                InputError(ERRORCODE::INVALIDINPUT);
+                continue;
+            }
+            fVBars.insert(fVBars.end(), fBar, fBar + 3);
+        }
+        m_nXSR = static_cast<int>(fVBars.size()/3);
+        if (m_nXSR > 0) {
+            CVector<float> fVReData(3*m_nXSR);
+            for (int i = 1; i <= 3*m_nXSR; i++)
+                fVReData(i) = fVBars[i-1];
+            m_ReData.SetSize(m_nXSR);
+            m_ReData(1).SetSize(3*m_nXSR);
+            m_ReData(1).SetXSReData(fVReData);
         }
-        m_ReData(1).SetSize(3*m_nXSR);
-        m_ReData(1).SetXSReData(fVReData);
-
-        // Read Transverse Reinforcements data
 
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-            m_nTokens, m_strDelimiters, m_strComment,
-            bEOF);
-        for (int i = 1; i <= m_nTR; i++) {
-            m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        // Read Transverse Reinforcements data (until *transverse spacings)
+        std::vector<std::vector<float>> fVVTrans;
+        for (;;) {
+            m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
                                m_nTokens, m_strDelimiters, m_strComment,
                                bEOF);
-            m_nVTransSegments(i) = (m_nTokens - 1) / 2 - 1;
-            CVector<float> fVTransReData(m_nTokens);
-            fVTransReData.Set(0.0f);
-
-            m_Parse.GetFloatValue(m_strVTokens[0], fBarDia);
-            fVTransReData(1) = fBarDia;
-
-            for (int j = 1; j <= m_nVTransSegments(i); j++) {
-                m_Parse.GetFloatValue(m_strVTokens[2*j-1], fVTransReData(2*j));
-                m_Parse.GetFloatValue(m_strVTokens[2*j], fVTransReData(2*j+1));
+            if (m_strVTokens[0] == "*transverse" && m_strVTokens[1] == "spacings")
+                break;
+            std::vector<float> fVTransReData(static_cast<size_t>(m_nTokens), 0.0f);
+            // [Tie diameter], [x1], [y1], [x2], [y2], ...
+            int nSegments = (m_nTokens - 1) / 2 - 1;
+            if (nSegments < 1 ||
+                !m_Parse.GetFloatValues(m_strVTokens, 0, 2*nSegments + 3,
+                                        fVTransReData.data())) {
+                InputError(ERRORCODE::INVALIDINPUT);
+                continue;
+            }
+            fVVTrans.push_back(fVTransReData);
+        }
+        m_nTR = static_cast<int>(fVVTrans.size());
+        if (m_nTR > 0) {
+            m_TransReData.SetSize(m_nTR);
+            m_nVTransSegments.SetSize(m_nTR);
+            for (int i = 1; i <= m_nTR; i++) {
+                const std::vector<float>& fVT = fVVTrans[i-1];
+                int nValues = static_cast<int>(fVT.size());
+                m_nVTransSegments(i) = (nValues - 1) / 2 - 1;
+                CVector<float> fVTransReData(nValues);
+                for (int j = 1; j <= nValues; j++)
+                    fVTransReData(j) = fVT[j-1];
+                m_TransReData(i).SetSize(nValues);
+                m_TransReData(i).SetXSReData(fVTransReData);
             }
-            m_TransReData(i).SetSize(m_nTokens);
-            m_TransReData(i).SetXSReData(fVTransReData);
         }
 
-        // read transverse spacings (NOT COMPLETE)
-        if (m_strVTokens[0] != "*max" && m_strVTokens[1] != "values") {
-            m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        // read transverse spacings
+        // [Spacing 1 (in)], [Length 1 (in)], [Spacing 2 (in)], [Length 2 (in)], ...
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
+            m_nTokens, m_strDelimiters, m_strComment,
+            bEOF);
+        if (m_strVTokens[0] != "*max") {
+            if (m_nTokens % 2 != 0)
+                InputError(ERRORCODE::INVALIDINPUT);
+            std::vector<float> fVSpacing(m_nTokens/2), fVLength(m_nTokens/2);
+            for (int i = 0; i < m_nTokens/2; i++) {
+                if (!m_Parse.GetFloatValue(m_strVTokens[2*i], fVSpacing[i]) ||
+                    !m_Parse.GetFloatValue(m_strVTokens[2*i+1], fVLength[i]) ||
+                    fVSpacing[i] <= 0.0f || fVLength[i] <= 0.0f)
+                    InputError(ERRORCODE::INVALIDINPUT);
+            }
+            m_Shear.SetProvidedSpacings(fVSpacing, fVLength);
+            m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
                 m_nTokens, m_strDelimiters, m_strComment,
                 bEOF);
         }
 
         // read max values
-        if (m_strVTokens[0] != "*max" && m_strVTokens[1] != "values") {
-            m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
-                m_nTokens, m_strDelimiters, m_strComment,
-                bEOF);
-        }
+        if (m_strVTokens[0] != "*max" || m_strVTokens[1] != "values")
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
 
-        float fMaxAxial, fAxialLoc, fMaxShear, fShearLoc, fMaxMoment, fMomentLoc;
-        m_Parse.GetTokens(m_FileInput, m_nLineNumber, m_strVTokens,
+        // [Axial], [Loc.], [Shear], [Loc.], [Moment], [Loc.]
+        float fMax[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
             m_nTokens, m_strDelimiters, m_strComment,
             bEOF);
-        m_Parse.GetFloatValue(m_strVTokens[0], fMaxAxial);
-        m_Parse.GetFloatValue(m_strVTokens[1], fAxialLoc);
-        m_Parse.GetFloatValue(m_strVTokens[2], fMaxShear);
-        m_Parse.GetFloatValue(m_strVTokens[3], fShearLoc);
-        m_Parse.GetFloatValue(m_strVTokens[4], fMaxMoment);
-        m_Parse.GetFloatValue(m_strVTokens[5], fMomentLoc);
+        if (!m_Parse.GetFloatValues(m_strVTokens, 0, 6, fMax))
+            InputError(ERRORCODE::INVALIDINPUT);
 
-        m_ElementData(1).SetMaxValues(fMaxAxial, fAxialLoc, fMaxShear, fShearLoc, fMaxMoment, fMomentLoc);
+        m_ElementData(1).SetMaxValues(fMax[0], fMax[1], fMax[2], fMax[3], fMax[4], fMax[5]);
 
+        // optional section design data
+        ReadDesign();
     }
-    // trap all input file errors here
+    // trap all input file errors here: the problem is recorded and the
+    // job is abandoned (it is never analyzed with half-read data)
     catch (CLocalErrorHandler::ERRORCODE &err)
     {
-        m_LEH.ErrorHandler (err);
+        if (!m_Diagnostics.HasErrors())
+            m_Diagnostics.Add (CDiagnostics::SEVERITY::SEVERE, m_nLineNumber,
+                               CLocalErrorHandler::Describe (err));
+        throw;
     }
 
-    catch (CGlobalErrorHandler::ERRORCODE &err)
+    catch (CGlobalErrorHandler::ERRORCODE&)
     {
+        InputError (ERRORCODE::INVALIDINPUT);
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    }
+
+    catch (CParser::Error&)
+    {
+        m_Diagnostics.Add (CDiagnostics::SEVERITY::SEVERE, m_nLineNumber,
+                           "Unexpected end of input or unreadable line.");
         ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
     }
 
     catch (...)
     {
-        std::cout << "Sorry, could not catch the error whatever it is.\n";
+        m_Diagnostics.Add (CDiagnostics::SEVERITY::SEVERE, m_nLineNumber,
+                           "Unknown error while reading the input.");
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
     }
+
+    // check data for validity
+    if (m_nDebugLevel < 0 || m_nDebugLevel > 1) 
+        InputError (ERRORCODE::DEBUGCODE);
+    if (m_Diagnostics.HasErrors())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
 }
 
-void CElement::CreateOutput ()
+bool CElement::ReadBarPattern (const CVector<float>& fVXSDims,
+                               std::vector<float>& fVBars)
+// ---------------------------------------------------------------------------
+// Function: Expands a bar pattern directive of *XS REINFORCEMENTS in
+//           place of a list of bar lines. The bars are appended directly
+//           to the (diameter, x, y) bar data as the line is read.
+//             line, n, dia, x1, y1, x2, y2
+//                 n bars evenly spaced from (x1, y1) to (x2, y2)
+//             circle, n, dia, xc, yc, r [, start angle (deg)]
+//                 n bars evenly spaced on a circle of radius r
+//             perimeter, nx, ny, dia, cover   (rectangular section)
+//             perimeter, n, dia, cover        (circular section)
+//                 bars along the section faces, nx on the faces parallel
+//                 to x and ny on the faces parallel to y (the corner bars
+//                 are shared), with the given clear cover to the bars
+// Input:    section dimensions, bar data read so far
+// Output:   returns false if the current line is not a directive. errors in
+//           a directive are recorded and the line is skipped
 // ---------------------------------------------------------------------------
-// Function: creates the output file
+{
+    const std::string_view strvKind = m_strVTokens[0];
+    if (strvKind != "line" && strvKind != "circle" && strvKind != "perimeter")
+        return false;
+
+    // bar counts
+    int nBars[2] = {0, 0};
+    int nCounts = 1;
+    if (strvKind == "perimeter")
+    {
+        CXSType::EPType Type;
+        m_EPData(1)->GetType(Type);
+        if (Type == CXSType::EPType::RECTS)
+            nCounts = 2;
+        else if (Type != CXSType::EPType::CIRCS)
+        {
+            InputError(ERRORCODE::XSTYPE);
+            return true;
+        }
+    }
+    if (!m_Parse.GetIntValues(m_strVTokens, 1, nCounts, nBars))
+    {
+        InputError(ERRORCODE::INVALIDINPUT);
+        return true;
+    }
+
+    // diameter and the pattern data
+    float fV[6];
+    int nValues = m_nTokens - 1 - nCounts;
+    bool bValues = (strvKind == "line") ? (nValues == 5) :
+                   (strvKind == "circle") ? (nValues == 4 || nValues == 5) :
+                   (nValues == 2);
+    if (!bValues ||
+        !m_Parse.GetFloatValues(m_strVTokens, 1 + nCounts, nValues, fV))
+    {
+        InputError(ERRORCODE::INVALIDINPUT);
+        return true;
+    }
+    const float fDia = fV[0];
+    if (fDia <= 0.0f)
+    {
+        InputError(ERRORCODE::INVALIDINPUT);
+        return true;
+    }
+
+    if (strvKind == "line")
+    {
+        // [n], [dia], [x1], [y1], [x2], [y2]
+        const int n = nBars[0];
+        if (n < 2)
+        {
+            InputError(ERRORCODE::INVALIDINPUT);
+            return true;
+        }
+        fVBars.reserve(fVBars.size() + 3*static_cast<size_t>(n));
+        for (int i = 0; i < n; i++)
+        {
+            float fT = static_cast<float>(i)/static_cast<float>(n - 1);
+            fVBars.push_back(fDia);
+            fVBars.push_back(fV[1] + fT*(fV[3] - fV[1]));
+            fVBars.push_back(fV[2] + fT*(fV[4] - fV[2]));
+        }
+    }
+    else if (strvKind == "circle")
+    {
+        // [n], [dia], [xc], [yc], [r], [start angle]
+        const int n = nBars[0];
+        if (n < 1 || fV[3] <= 0.0f)
+        {
+            InputError(ERRORCODE::INVALIDINPUT);
+            return true;
+        }
+        double dStart = (nValues == 5) ? fV[4]*PI/180.0 : 0.0;
+        fVBars.reserve(fVBars.size() + 3*static_cast<size_t>(n));
+        for (int i = 0; i < n; i++)
+        {
+            double dT = dStart + 2.0*PI*i/n;
+            fVBars.push_back(fDia);
+            fVBars.push_back(fV[1] + static_cast<float>(fV[3]*cos(dT)));
+            fVBars.push_back(fV[2] + static_cast<float>(fV[3]*sin(dT)));
+        }
+    }
+    else if (nCounts == 2)
+    {
+        // [nx], [ny], [dia], [cover]: rectangle with its origin at the
+        // centroid, the corner bars at (+-a, +-b)
+        const int nX = nBars[0], nY = nBars[1];
+        float fA = 0.5f*fVXSDims(1) - fV[1] - 0.5f*fDia;
+        float fB = 0.5f*fVXSDims(2) - fV[1] - 0.5f*fDia;
+        if (nX < 2 || nY < 2 || fV[1] < 0.0f || fA <= 0.0f || fB <= 0.0f)
+        {
+            InputError(ERRORCODE::INVALIDINPUT);
+            return true;
+        }
+        fVBars.reserve(fVBars.size() + 3*static_cast<size_t>(2*(nX + nY) - 4));
+        for (int i = 0; i < nX; i++)
+        {
+            float fX = -fA + 2.0f*fA*i/(nX - 1);
+            fVBars.insert(fVBars.end(), {fDia, fX, -fB});
+        }
+        for (int i = 1; i < nY - 1; i++)
+        {
+            float fY = -fB + 2.0f*fB*i/(nY - 1);
+            fVBars.insert(fVBars.end(), {fDia, -fA, fY});
+            fVBars.insert(fVBars.end(), {fDia,  fA, fY});
+        }
+        for (int i = 0; i < nX; i++)
+        {
+            float fX = -fA + 2.0f*fA*i/(nX - 1);
+            fVBars.insert(fVBars.end(), {fDia, fX, fB});
+        }
+    }
+    else
+    {
+        // [n], [dia], [cover]: circle with its origin at the center
+        const int n = nBars[0];
+        float fR = fVXSDims(1) - fV[1] - 0.5f*fDia;
+        if (n < 1 || fV[1] < 0.0f || fR <= 0.0f)
+        {
+            InputError(ERRORCODE::INVALIDINPUT);
+            return true;
+        }
+        fVBars.reserve(fVBars.size() + 3*static_cast<size_t>(n));
+        for (int i = 0; i < n; i++)
+        {
+            double dT = 2.0*PI*i/n;
+            fVBars.push_back(fDia);
+            fVBars.push_back(static_cast<float>(fR*cos(dT)));
+            fVBars.push_back(static_cast<float>(fR*sin(dT)));
+        }
+    }
+
+    return true;
+}
+
+void CElement::ReadDesign ()
+// ---------------------------------------------------------------------------
+// Function: reads the optional *DESIGN block after *max values
+//           [Dim. 1 min], [Dim. 1 max], ... (one pair per dimension)
+//           [Increment], [Cover to bar center], [Min. # bars], [Max. # bars]
+//           [Bar diameter 1], [Bar diameter 2], ...
+//           [Concrete cost ($/ft^3)], [Steel cost ($/lb)]
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    bool bEOF = false;
+    try
+    {
+        m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
+            m_nTokens, m_strDelimiters, m_strComment,
+            bEOF);
+    }
+    catch (CParser::Error&)
+    {
+        return; // end of file without *end
+    }
+    if (m_strVTokens[0] != "*design")
+        return;
+
+    CXSType::EPType XSType;
+    m_EPData(1)->GetType(XSType);
+    m_Designer.SetSection(XSType, m_Type == ElementType::COLUMN);
+    int nDims = CSectionDesigner::NumDimensions(XSType);
+
+    // dimension ranges
+    m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
+        m_nTokens, m_strDelimiters, m_strComment,
+        bEOF);
+    if (m_nTokens != 2*nDims)
+        IOErrorHandler(ERRORCODE::INVALIDINPUT);
+    for (int i = 1; i <= nDims; i++)
+    {
+        float fMin, fMax;
+        if (!m_Parse.GetFloatValue(m_strVTokens[2*i-2], fMin) ||
+            !m_Parse.GetFloatValue(m_strVTokens[2*i-1], fMax) ||
+            fMin <= 0.0f || fMax < fMin)
+            InputError(ERRORCODE::XSDIMENSION);
+        m_Designer.SetDimensionRange(i, fMin, fMax);
+    }
+
+    // search parameters
+    float fIncrement, fCover;
+    int nMinBars, nMaxBars;
+    m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
+        m_nTokens, m_strDelimiters, m_strComment,
+        bEOF);
+    if (m_nTokens != 4 ||
+        !m_Parse.GetFloatValue(m_strVTokens[0], fIncrement) ||
+        !m_Parse.GetFloatValue(m_strVTokens[1], fCover) ||
+        !m_Parse.GetIntValue(m_strVTokens[2], nMinBars) ||
+        !m_Parse.GetIntValue(m_strVTokens[3], nMaxBars) ||
+        fIncrement <= 0.0f || fCover <= 0.0f || nMinBars < 1 ||
+        nMaxBars < nMinBars)
+        IOErrorHandler(ERRORCODE::INVALIDINPUT);
+    m_Designer.SetSearch(fIncrement, fCover, nMinBars, nMaxBars);
+
+    // candidate bar diameters
+    m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
+        m_nTokens, m_strDelimiters, m_strComment,
+        bEOF);
+    std::vector<float> fVDia(static_cast<size_t>(m_nTokens));
+    if (!m_Parse.GetFloatValues(m_strVTokens, 0, m_nTokens, fVDia.data()))
+        IOErrorHandler(ERRORCODE::INVALIDINPUT);
+    for (int i = 0; i < m_nTokens; i++)
+        if (fVDia[i] <= 0.0f)
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
+    m_Designer.SetBarDiameters(fVDia);
+
+    // unit costs
+    float fConcrete, fSteel;
+    m_Parse.GetTokens(m_nLineNumber, m_strVTokens,
+        m_nTokens, m_strDelimiters, m_strComment,
+        bEOF);
+    if (m_nTokens != 2 ||
+        !m_Parse.GetFloatValue(m_strVTokens[0], fConcrete) ||
+        !m_Parse.GetFloatValue(m_strVTokens[1], fSteel) ||
+        fConcrete < 0.0f || fSteel < 0.0f)
+        IOErrorHandler(ERRORCODE::INVALIDINPUT);
+    m_Designer.SetCosts(fConcrete, fSteel);
+}
+
+void CElement::ReadBinary ()
+// ---------------------------------------------------------------------------
+// Function: reads the model from a binary (.xsb) input file. The file is
+//           mapped and its arrays are used as stored, so no text is
+//           parsed.
 // Input:    none
 // Output:   none
 // ---------------------------------------------------------------------------
+{
+    try
+    {
+        CBinarySection::CModel Model;
+        CBinarySection::Load (m_strInputName, Model);
+        SetModel (Model);
+    }
+    // trap all input file errors here
+    catch (CLocalErrorHandler::ERRORCODE &err)
+    {
+        if (!m_Diagnostics.HasErrors())
+            m_Diagnostics.Add (CDiagnostics::SEVERITY::SEVERE, 0,
+                               CLocalErrorHandler::Describe (err));
+        throw;
+    }
+}
+
+void CElement::GetModel (CBinarySection::CModel& Model) const
+// ---------------------------------------------------------------------------
+// Function: gathers the model data that was read from the input
+// Input:    none
+// Output:   model
+// ---------------------------------------------------------------------------
+{
+    Model.nMemberType = (m_Type == ElementType::COLUMN) ? 0 : 1;
+
+    Model.fConcrete[0] = m_ConcMatData(1).GetCompStr();
+    Model.fConcrete[1] = m_ConcMatData(1).GetDensity();
+    Model.fConcrete[2] = m_ConcMatData(1).GetPoisson();
+    Model.fSteel[0] = m_ReMatData(1).GetYieldStr();
+    Model.fSteel[1] = m_ReMatData(1).GetYM();
+    Model.fSteel[2] = m_ReMatData(1).GetDensity();
+
+    // section type and dimensions
+    CXSType::EPType XSType;
+    m_EPData(1)->GetType(XSType);
+    Model.nSectionType = static_cast<int>(XSType);
+    CVectorN<float,MAXEPDIM> fVXSDims;
+    m_EPData(1)->GetDimensions(fVXSDims);
+    for (int i = 0; i < MAXEPDIM; i++)
+        Model.fDims[i] = fVXSDims(i+1);
+
+    // bars
+    float fDia, fX, fY;
+    Model.fVBarDia.clear();
+    Model.fVBarX.clear();
+    Model.fVBarY.clear();
+    for (int i = 1; m_nXSR > 0 && i <= m_ReData(1).GetNumBars(); i++)
+    {
+        m_ReData(1).GetBar(i, fDia, fX, fY);
+        Model.fVBarDia.push_back(fDia);
+        Model.fVBarX.push_back(fX);
+        Model.fVBarY.push_back(fY);
+    }
+
+    // transverse reinforcement polylines
+    Model.fVTieDia.clear();
+    Model.nVPolyPoints.clear();
+    Model.fVPolyX.clear();
+    Model.fVPolyY.clear();
+    for (int i = 1; i <= m_nTR; i++)
+    {
+        const CReinforcement& Tr = m_TransReData(i);
+        Model.fVTieDia.push_back(Tr.GetTieDiameter());
+        Model.nVPolyPoints.push_back(Tr.GetNumPoints());
+        for (int j = 1; j <= Tr.GetNumPoints(); j++)
+        {
+            Tr.GetPoint(j, fX, fY);
+            Model.fVPolyX.push_back(fX);
+            Model.fVPolyY.push_back(fY);
+        }
+    }
+    m_Shear.GetProvidedSpacings(Model.fVSpacing, Model.fVLength);
+
+    m_ElementData(1).GetMaxValues(Model.fMax[0], Model.fMax[1], Model.fMax[2],
+                                  Model.fMax[3], Model.fMax[4], Model.fMax[5]);
+
+    // section design data
+    Model.bDesign = m_Designer.IsDefined();
+    for (int i = 0; i < MAXEPDIM; i++)
+        Model.fDimMin[i] = Model.fDimMax[i] = 0.0f;
+    Model.fIncrement = Model.fCover = 0.0f;
+    Model.nMinBars = Model.nMaxBars = 0;
+    Model.fVDesignDia.clear();
+    Model.fConcreteCost = Model.fSteelCost = 0.0f;
+    if (Model.bDesign)
+    {
+        for (int i = 1; i <= CSectionDesigner::NumDimensions(XSType); i++)
+            m_Designer.GetDimensionRange(i, Model.fDimMin[i-1],
+                                         Model.fDimMax[i-1]);
+        m_Designer.GetSearch(Model.fIncrement, Model.fCover,
+                             Model.nMinBars, Model.nMaxBars);
+        m_Designer.GetBarDiameters(Model.fVDesignDia);
+        m_Designer.GetCosts(Model.fConcreteCost, Model.fSteelCost);
+    }
+}
+
+void CElement::SetModel (const CBinarySection::CModel& Model)
+// ---------------------------------------------------------------------------
+// Function: sets the model data as ReadModel and ReadDesign do, with the
+//           same checks on the values
+// Input:    model
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (Model.nMemberType == 0)
+        SetType(ElementType::COLUMN);
+    else if (Model.nMemberType == 1)
+        SetType(ElementType::BEAM);
+    else
+        IOErrorHandler(ERRORCODE::INVALIDINPUT);
+
+    // materials
+    for (int i = 0; i < 3; i++)
+        if (Model.fConcrete[i] <= 0.0f || Model.fSteel[i] <= 0.0f)
+            IOErrorHandler(ERRORCODE::MATPROPERTY);
+    m_ConcMatData(1).SetCompStr(Model.fConcrete[0]);
+    m_ConcMatData(1).SetDensity(Model.fConcrete[1]);
+    m_ConcMatData(1).SetPoisson(Model.fConcrete[2]);
+    m_ReMatData(1).SetYieldStr(Model.fSteel[0]);
+    m_ReMatData(1).SetYM(Model.fSteel[1]);
+    m_ReMatData(1).SetDensity(Model.fSteel[2]);
+
+    // section
+    CXSType::EPType XSType = static_cast<CXSType::EPType>(Model.nSectionType);
+    if (XSType != CXSType::EPType::RECTS && XSType != CXSType::EPType::TSECTION &&
+        XSType != CXSType::EPType::CIRCS)
+        IOErrorHandler(ERRORCODE::XSTYPE);
+    int nDims = CSectionDesigner::NumDimensions(XSType);
+    CVector<float> fVXSDims(MAXEPDIM);
+    fVXSDims.Set(0.0f);
+    for (int i = 1; i <= nDims; i++)
+    {
+        if (Model.fDims[i-1] <= 0.0f)
+            IOErrorHandler(ERRORCODE::XSDIMENSION);
+        fVXSDims(i) = Model.fDims[i-1];
+    }
+    if (XSType == CXSType::EPType::RECTS)
+        m_EPData(1) = new CRectSolid(fVXSDims);
+    else if (XSType == CXSType::EPType::TSECTION)
+        m_EPData(1) = new CTSection(fVXSDims);
+    else
+        m_EPData(1) = new CCircSolid(fVXSDims);
+
+    // bars
+    m_nXSR = static_cast<int>(Model.fVBarDia.size());
+    if (m_nXSR > 0) {
+        CVector<float> fVReData(3*m_nXSR);
+        for (int i = 1; i <= m_nXSR; i++)
+        {
+            fVReData(3*i-2) = Model.fVBarDia[i-1];
+            fVReData(3*i-1) = Model.fVBarX[i-1];
+            fVReData(3*i) = Model.fVBarY[i-1];
+        }
+        m_ReData.SetSize(m_nXSR);
+        m_ReData(1).SetSize(3*m_nXSR);
+        m_ReData(1).SetXSReData(fVReData);
+    }
+
+    // transverse reinforcement polylines
+    m_nTR = static_cast<int>(Model.fVTieDia.size());
+    if (m_nTR > 0) {
+        m_TransReData.SetSize(m_nTR);
+        m_nVTransSegments.SetSize(m_nTR);
+        int nPoint = 0;
+        for (int i = 1; i <= m_nTR; i++) {
+            int nPoints = Model.nVPolyPoints[i-1];
+            if (nPoints < 2)
+                IOErrorHandler(ERRORCODE::INVALIDINPUT);
+            m_nVTransSegments(i) = nPoints - 1;
+            CVector<float> fVTransReData(2*nPoints + 1);
+            fVTransReData(1) = Model.fVTieDia[i-1];
+            for (int j = 1; j <= nPoints; j++, nPoint++)
+            {
+                fVTransReData(2*j) = Model.fVPolyX[nPoint];
+                fVTransReData(2*j+1) = Model.fVPolyY[nPoint];
+            }
+            m_TransReData(i).SetSize(2*nPoints + 1);
+            m_TransReData(i).SetXSReData(fVTransReData);
+        }
+    }
+
+    // provided stirrup spacings
+    for (size_t i = 0; i < Model.fVSpacing.size(); i++)
+        if (Model.fVSpacing[i] <= 0.0f || Model.fVLength[i] <= 0.0f)
+            IOErrorHandler(ERRORCODE::INVALIDINPUT);
+    if (!Model.fVSpacing.empty())
+        m_Shear.SetProvidedSpacings(Model.fVSpacing, Model.fVLength);
+
+    m_ElementData(1).SetMaxValues(Model.fMax[0], Model.fMax[1], Model.fMax[2],
+                                  Model.fMax[3], Model.fMax[4], Model.fMax[5]);
+
+    // section design data
+    if (Model.bDesign)
+    {
+        m_Designer.SetSection(XSType, m_Type == ElementType::COLUMN);
+        for (int i = 1; i <= nDims; i++)
+        {
+            if (Model.fDimMin[i-1] <= 0.0f ||
+                Model.fDimMax[i-1] < Model.fDimMin[i-1])
+                IOErrorHandler(ERRORCODE::XSDIMENSION);
+            m_Designer.SetDimensionRange(i, Model.fDimMin[i-1],
+                                         Model.fDimMax[i-1]);
+        }
+        m_Designer.SetSearch(Model.fIncrement, Model.fCover,
+                             Model.nMinBars, Model.nMaxBars);
+        m_Designer.SetBarDiameters(Model.fVDesignDia);
+        m_Designer.SetCosts(Model.fConcreteCost, Model.fSteelCost);
+    }
+}
+
+bool CElement::CompileInput (const std::string& strInput,
+                             const std::string& strBinary)
+// ---------------------------------------------------------------------------
+// Function: converts a text input file to the binary (.xsb) format and
+//           checks the round trip: the file is loaded back, a second
+//           element is built from it and its model must be identical,
+//           byte for byte, to the model read by the text reader
+// Input:    text input file name, binary file name
+// Output:   true if the round trip reproduces the text input
+// ---------------------------------------------------------------------------
+{
+    m_FileInput.open (strInput, std::ios::in);
+    if (!m_FileInput)
+        ErrorHandler (CGlobalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    m_strInputName = strInput;
+    SetSize();
+    ReadModel(m_FileInput);
+
+    // text -> binary file
+    CBinarySection::CModel Model;
+    std::vector<unsigned char> cVImage;
+    GetModel(Model);
+    CBinarySection::Write(Model, cVImage);
+    CBinarySection::Save(strBinary, cVImage);
+
+    // binary file -> model -> element -> model
+    CBinarySection::CModel Loaded, Rebuilt;
+    std::vector<unsigned char> cVLoaded, cVRebuilt;
+    CBinarySection::Load(strBinary, Loaded);
+    CBinarySection::Write(Loaded, cVLoaded);
+    CElement Check;
+    Check.SetSize();
+    Check.SetModel(Loaded);
+    Check.GetModel(Rebuilt);
+    CBinarySection::Write(Rebuilt, cVRebuilt);
+
+    return cVLoaded == cVImage && cVRebuilt == cVImage;
+}
+
+void CElement::CreateOutput (std::ostream& OF)
+// ---------------------------------------------------------------------------
+// Function: writes the results
+// Input:    output stream
+// Output:   none
+// ---------------------------------------------------------------------------
 {
     // print analysis date and time
-    m_FileOutput << '\n';
-    m_FileOutput << "Starting out at : " << m_strDateTime << '\n';
+    OF << '\n';
+    if (m_bTimestamps)
+        OF << "Starting out at : " << m_strDateTime << '\n';
 
     // problem description
-    m_FileOutput << "-------------------" << '\n';
-    m_FileOutput << "MATERIAL PROPERTIES" << '\n';
-    m_FileOutput << "-------------------" << '\n';
-    m_FileOutput << "Group    Young's Modulus                CTE" << '\n';
-    m_FileOutput << "-----    ---------------    ---------------" << '\n';
+    OF << "-------------------" << '\n';
+    OF << "MATERIAL PROPERTIES" << '\n';
+    OF << "-------------------" << '\n';
+    OF << "Group    Young's Modulus                CTE" << '\n';
+    OF << "-----    ---------------    ---------------" << '\n';
     
-    m_FileOutput << '\n';
-    m_FileOutput << "=================" << '\n';
-    m_FileOutput << "== FEA RESULTS ==" << '\n';
-    m_FileOutput << "=================" << '\n';
+    OF << '\n';
+    OF << "=================" << '\n';
+    OF << "== FEA RESULTS ==" << '\n';
+    OF << "=================" << '\n';
+    if (m_pCache != nullptr)
+        OF << "Section results reused from earlier analyses: "
+                     << m_nReused << '\n';
+    if (m_pDiskCache != nullptr)
+        OF << "Section results read from " << m_pDiskCache->GetFileName()
+                     << ": " << m_nDiskHits << '\n';
+
+    // section capacity
+    OF << '\n';
+    OF << "----------------" << '\n';
+    OF << "MOMENT CAPACITY" << '\n';
+    OF << "----------------" << '\n';
+    OF << std::fixed << std::setprecision(2);
+    OF << "Nominal moment capacity, Mn (kip-in)   : " << std::setw(12) << m_fMn << '\n';
+    OF << "Design moment capacity, phi*Mn (kip-in): " << std::setw(12) << m_fPhiMn << '\n';
+    OF << std::setprecision(4);
+    OF << "Strength reduction factor, phi         : " << std::setw(12) << m_fPhi << '\n';
+    OF << "Neutral axis depth, c (in)             : " << std::setw(12) << m_fNADepth << '\n';
+    OF << std::setprecision(5);
+    OF << "Net tensile strain, et                 : " << std::setw(12) << m_fEpsT << '\n';
+    OF.unsetf(std::ios::fixed);
+    OF << std::setprecision(6);
+
+    // moment-curvature response
+    if (m_MomentCurvature.GetNumPoints() > 0)
+    {
+        const char* szKey[] = {"Cracking", "First yield", "Ultimate"};
+        OF << '\n';
+        OF << "------------------------" << '\n';
+        OF << "MOMENT-CURVATURE" << '\n';
+        OF << "------------------------" << '\n';
+        OF << "Axial load (kips)                : " << std::fixed
+                     << std::setprecision(2) << std::setw(12)
+                     << m_MomentCurvature.GetAxialLoad() << '\n';
+        OF << "Steps, section evaluations       : " << std::setw(12)
+                     << m_MomentCurvature.GetNumPoints() << std::setw(12)
+                     << m_MomentCurvature.GetTotalIterations() << '\n';
+        OF << '\n';
+        OF << "Point              Curvature (1/in)   Moment (kip-in)" << '\n';
+        OF << "-----------        ----------------   ---------------" << '\n';
+        for (int k = 0; k < 3; k++)
+        {
+            float fCurv, fM;
+            OF << std::setw(19) << std::left << szKey[k] << std::right;
+            if (m_MomentCurvature.GetKeyPoint(static_cast<CMomentCurvature::KEYPOINT>(k),
+                                              fCurv, fM))
+                OF << std::scientific << std::setprecision(5)
+                             << std::setw(16) << fCurv << std::fixed
+                             << std::setprecision(2) << std::setw(18) << fM << '\n';
+            else
+                OF << std::setw(16) << "not reached" << '\n';
+        }
+        OF << '\n';
+        OF << " Step   Curvature (1/in)   Moment (kip-in)   Iterations" << '\n';
+        OF << "-----   ----------------   ---------------   ----------" << '\n';
+        for (int i = 1; i <= m_MomentCurvature.GetNumPoints(); i++)
+        {
+            float fCurv, fM, fE0;
+            int nIter;
+            m_MomentCurvature.GetPoint(i, fCurv, fM, fE0, nIter);
+            OF << std::setw(5) << i << std::scientific
+                         << std::setprecision(5) << std::setw(19) << fCurv
+                         << std::fixed << std::setprecision(2)
+                         << std::setw(18) << fM << std::setw(13) << nIter << '\n';
+        }
+        OF.unsetf(std::ios::fixed | std::ios::scientific);
+        OF << std::setprecision(6);
+    }
+
+    // shear design
+    {
+        const char* szZone[] = {"Stirrups not required", "", "No stirrups given",
+                                "Section too small"};
+        float fBw, fD, fAv, fVc, fVsMax;
+        m_Shear.GetSectionProperties(fBw, fD, fAv);
+        m_Shear.GetStrengths(fVc, fVsMax);
+
+        OF << '\n';
+        OF << "------------" << '\n';
+        OF << "SHEAR DESIGN" << '\n';
+        OF << "------------" << '\n';
+        OF << std::fixed << std::setprecision(2);
+        OF << "Web width, bw (in)                  : " << std::setw(12) << fBw << '\n';
+        OF << "Effective depth, d (in)             : " << std::setw(12) << fD << '\n';
+        OF << std::setprecision(4);
+        OF << "Stirrup area per set, Av (in^2)     : " << std::setw(12) << fAv << '\n';
+        OF << std::setprecision(2);
+        OF << "Concrete shear strength, Vc (kips)  : " << std::setw(12) << fVc << '\n';
+        OF << "Design strength, phi*Vc (kips)      : " << std::setw(12) << CShearDesign::PHI*fVc << '\n';
+        OF << "Limit on Vs, 8 sqrt(f'c) bw d (kips): " << std::setw(12) << fVsMax << '\n';
+        OF << '\n';
+        OF << "Required stirrup spacing" << '\n';
+        OF << "  From (in)     To (in)  Spacing (in)" << '\n';
+        OF << "-----------  ----------  ------------" << '\n';
+        for (int i = 1; i <= m_Shear.GetNumZones(); i++)
+        {
+            float fStart, fEnd, fS;
+            CShearDesign::ZONE Type;
+            m_Shear.GetZone(i, fStart, fEnd, fS, Type);
+            OF << std::setw(11) << fStart << std::setw(12) << fEnd;
+            if (Type == CShearDesign::ZONE::SPACING)
+                OF << std::setw(14) << fS << '\n';
+            else
+                OF << "  " << szZone[static_cast<int>(Type)] << '\n';
+        }
+        if (m_Shear.GetNumProvided() > 0)
+        {
+            OF << '\n';
+            OF << "Provided stirrup spacing" << '\n';
+            OF << "  From (in)     To (in)  Spacing (in)   Vu/phi*Vn" << '\n';
+            OF << "-----------  ----------  ------------  ----------" << '\n';
+            for (int i = 1; i <= m_Shear.GetNumProvided(); i++)
+            {
+                float fStart, fEnd, fS, fRatio;
+                m_Shear.GetProvided(i, fStart, fEnd, fS, fRatio);
+                OF << std::setw(11) << fStart << std::setw(12) << fEnd
+                             << std::setw(14) << fS << std::setprecision(4)
+                             << std::setw(12) << fRatio << std::setprecision(2)
+                             << ((fRatio > 1.0f) ? "  NG" : "") << '\n';
+            }
+        }
+        OF.unsetf(std::ios::fixed);
+        OF << std::setprecision(6);
+    }
+
+    // interaction diagram
+    int nPoints = m_Interaction.GetNumPoints();
+    if (nPoints > 0)
+    {
+        float fPu, fAxialLoc, fMaxShear, fShearLoc, fMaxMoment, fMomentLoc;
+        m_ElementData(1).GetMaxValues(fPu, fAxialLoc, fMaxShear, fShearLoc,
+                                      fMaxMoment, fMomentLoc);
+
+        OF << '\n';
+        OF << "-------------------------" << '\n';
+        OF << "P-M INTERACTION DIAGRAM" << '\n';
+        OF << "-------------------------" << '\n';
+        OF << std::fixed << std::setprecision(2);
+        OF << "Maximum design axial strength, phi*Pn,max (kips): "
+                     << std::setw(12) << m_Interaction.GetPhiPnMax() << '\n';
+        OF << "Design moment strength at Pu (kip-in)          : "
+                     << std::setw(12) << m_Interaction.GetDesignMoment(fPu) << '\n';
+        OF << '\n';
+        OF << "Point          Pn          Mn      phi      phi*Pn      phi*Mn           c          et" << '\n';
+        OF << "-----  ----------  ----------  -------  ----------  ----------  ----------  ----------" << '\n';
+        // the rows are formatted into the table's buffer and written a
+        // page at a time
+        const int nWidth[] = {5, 12, 12, 9, 12, 12, 12, 12};
+        const int nDigits[] = {0, 2, 2, 4, 2, 2, 2, 5};
+        CPrintTable Table(8, &OF);
+        Table.PCopy (nWidth);
+        for (int j = 1; j <= 8; j++)
+            Table.SetColumnFormat (j, CPrintTable::RIGHTJUSTIFY, nDigits[j-1]);
+        for (int i = 1; i <= nPoints; i++)
+        {
+            float fPn, fMn, fPhi, fC, fEpsT, fPhiPn, fPhiMn;
+            m_Interaction.GetPoint(i, fPn, fMn, fPhi, fC, fEpsT);
+            m_Interaction.GetDesignPoint(i, fPhiPn, fPhiMn);
+            Table.PrintNext (i);
+            Table.PrintNext (fPn);
+            Table.PrintNext (fMn);
+            Table.PrintNext (fPhi);
+            Table.PrintNext (fPhiPn);
+            Table.PrintNext (fPhiMn);
+            Table.PrintNext (fC);
+            Table.PrintNext (fEpsT);
+        }
+        Table.AllDone ();
+        OF.unsetf(std::ios::fixed);
+        OF << std::setprecision(6);
+    }
+
+    // biaxial interaction surface
+    if (m_Surface.GetNumAngles() > 0)
+    {
+        float fPu, fAxialLoc, fMaxShear, fShearLoc, fMu, fMomentLoc;
+        m_ElementData(1).GetMaxValues(fPu, fAxialLoc, fMaxShear, fShearLoc,
+                                      fMu, fMomentLoc);
+        std::vector<float> fVMx, fVMy;
+        m_Surface.GetMomentContour(fPu, fVMx, fVMy);
+
+        OF << '\n';
+        OF << "-------------------------------" << '\n';
+        OF << "BIAXIAL INTERACTION SURFACE" << '\n';
+        OF << "-------------------------------" << '\n';
+        OF << "Mesh (angles x depths)                         : "
+                     << m_Surface.GetNumAngles() << " x "
+                     << m_Surface.GetNumDepths() << '\n';
+        OF << std::fixed << std::setprecision(4);
+        OF << "Demand/capacity ratio at (Pu, Mu about x)      : "
+                     << std::setw(12) << m_Surface.GetCapacityRatio(fPu, fMu, 0.0f) << '\n';
+        OF << '\n';
+        OF << "Design moment contour at Pu" << '\n';
+        OF << "Angle (deg)      phi*Mnx      phi*Mny" << '\n';
+        OF << "-----------  -----------  -----------" << '\n';
+        for (size_t k = 0; k < fVMx.size(); k++)
+        {
+            float fDeg = static_cast<float>(m_Surface.GetAngle(static_cast<int>(k) + 1)*180.0/PI);
+            OF << std::setprecision(1) << std::setw(11) << fDeg
+                         << std::setprecision(2)
+                         << std::setw(13) << fVMx[k] << std::setw(13) << fVMy[k] << '\n';
+        }
+        OF.unsetf(std::ios::fixed);
+        OF << std::setprecision(6);
+    }
+
+    // section design
+    if (m_Designer.IsDefined())
+    {
+        const char* szDim[3][MAXEPDIM] = {
+            {"Radius", "", "", ""},
+            {"Width", "Depth", "", ""},
+            {"Total depth", "Flange width", "Web width", "Flange thickness"}};
+        int nType = static_cast<int>(m_Designer.GetSectionType());
+        int nDims = CSectionDesigner::NumDimensions(m_Designer.GetSectionType());
+
+        OF << '\n';
+        OF << "--------------" << '\n';
+        OF << "SECTION DESIGN" << '\n';
+        OF << "--------------" << '\n';
+        OF << "Candidates, evaluated, from cache : " << std::setw(8)
+                     << m_Designer.GetNumCandidates() << std::setw(8)
+                     << m_Designer.GetNumEvaluated() << std::setw(8)
+                     << m_Designer.GetNumCacheHits() << '\n';
+        if (!m_Designer.IsFound())
+            OF << "No candidate section satisfies the demands." << '\n';
+        else
+        {
+            float fDims[MAXEPDIM], fDia, fCost;
+            int nBars;
+            CCapacityCache::CCapacity Cap;
+            m_Designer.GetDesign(fDims, fDia, nBars, fCost, Cap);
+            OF << std::fixed << std::setprecision(2);
+            OF << '\n';
+            OF << "Dimension              Min (in)    Max (in)  Chosen (in)" << '\n';
+            OF << "-----------------    ----------  ----------  -----------" << '\n';
+            for (int i = 1; i <= nDims; i++)
+            {
+                float fMin, fMax;
+                m_Designer.GetDimensionRange(i, fMin, fMax);
+                OF << std::setw(17) << std::left << szDim[nType][i-1]
+                             << std::right << std::setw(14) << fMin
+                             << std::setw(12) << fMax << std::setw(13)
+                             << fDims[i-1] << '\n';
+            }
+            OF << '\n';
+            OF << "Bars                                    : " << nBars
+                         << " x " << std::setprecision(3) << fDia << " in" << '\n';
+            OF << std::setprecision(2);
+            OF << "Cost per foot of member ($/ft)          : " << std::setw(12) << fCost << '\n';
+            OF << "Nominal moment capacity, Mn (kip-in)    : " << std::setw(12) << Cap.fMn << '\n';
+            OF << "Design moment capacity, phi*Mn (kip-in) : " << std::setw(12) << Cap.fPhiMn << '\n';
+            OF << "Max. design axial strength (kips)       : " << std::setw(12) << Cap.fPhiPnMax << '\n';
+            OF << std::setprecision(4);
+            OF << "Strength reduction factor, phi          : " << std::setw(12) << Cap.fPhi << '\n';
+            OF << std::setprecision(5);
+            OF << "Net tensile strain, et                  : " << std::setw(12) << Cap.fEpsT << '\n';
+
+            std::vector<float> fVX, fVY;
+            m_Designer.GetBarLayout(fVX, fVY);
+            OF << '\n';
+            OF << "  Bar      X (in)      Y (in)" << '\n';
+            OF << "-----  ----------  ----------" << '\n';
+            OF << std::setprecision(3);
+            for (size_t i = 0; i < fVX.size(); i++)
+                OF << std::setw(5) << i+1 << std::setw(12) << fVX[i]
+                             << std::setw(12) << fVY[i] << '\n';
+            OF.unsetf(std::ios::fixed);
+            OF << std::setprecision(6);
+        }
+    }
 
     // Print elapsed clock time
-    m_FileOutput << '\n';
-    m_FileOutput << "      Ending at : " << m_strEndDateTime;
-    m_FileOutput << "      Elapsed clock time : " << Timer.DiffTime() << " s\n";
+    if (m_bTimestamps)
+    {
+        OF << '\n';
+        OF << "      Ending at : " << m_strEndDateTime;
+        OF << "      Elapsed clock time : " << Timer.DiffTime() << " s\n";
+    }
 }
 
-void CElement::IOErrorHandler (ERRORCODE ECode) const
+const char* CElement::IOErrorMessage (const ERRORCODE ECode)
 // ---------------------------------------------------------------------------
-// Function: displays error messages related to input data
+// Function: gets the message for an input data error
 // Input:    error code
-// Output:   none
+// Output:   message text
 // ---------------------------------------------------------------------------
 {
-    std::cerr << '\n';
-
     if (ECode == ERRORCODE::NUMNODES) // invalid number of nodes
-        std::cerr << "Number of nodes must be >= 2.";
+        return "Number of nodes must be >= 2.";
     else if (ECode == ERRORCODE::NUMELEMENTS) // invalid number of elements
-        std::cerr << "Number of elements must be >= 1.";
+        return "Number of elements must be >= 1.";
     else if (ECode == ERRORCODE::DEBUGCODE) // invalid debug level
-        std::cerr << "Debug level must be 0 or 1.";
+        return "Debug level must be 0 or 1.";
     else if (ECode == ERRORCODE::NODENUMBER) // invalid node number
-        std::cerr << "Invalid node number.";
+        return "Invalid node number.";
     else if (ECode == ERRORCODE::ELEMENTNUMBER) // invalid element number
-        std::cerr << "Invalid element number.";
+        return "Invalid element number.";
     else if (ECode == ERRORCODE::XSAREA) // invalid x/s area
-        std::cerr << "Area must be positive.";
+        return "Area must be positive.";
     else if (ECode == ERRORCODE::YOUNGSMODULUS) // invalid E
-        std::cerr << "Modulus of elasticity must be positive.";
+        return "Modulus of elasticity must be positive.";
     else if (ECode == ERRORCODE::INVALIDINPUT) // invalid input
-        std::cerr << "Invalid input.";
+        return "Invalid input.";
     else if (ECode == ERRORCODE::INVALIDLASTLINE) // invalid input
-        std::cerr << "Input file needs *end as last line.";
+        return "Input file needs *end as last line.";
     else if (ECode == ERRORCODE::NODALFIXITY) // invalid fixity code
-        std::cerr << "Nodal fixity code must be 'free' or 'specified'.";
+        return "Nodal fixity code must be 'free' or 'specified'.";
     else if (ECode == ERRORCODE::NUMMATGROUPS) // invalid number of material groups
-        std::cerr << "Number of material groups must be >= 1.";
+        return "Number of material groups must be >= 1.";
     else if (ECode == ERRORCODE::NUMEPROPGROUPS) // invalid number of property groups
-        std::cerr << "Number of element property groups must be >= 1.";
+        return "Number of element property groups must be >= 1.";
     else if (ECode == ERRORCODE::EPROPNUMBER) // invalid element property group
-        std::cerr << "Invalid element property group number.";
+        return "Invalid element property group number.";
     else if (ECode == ERRORCODE::XSDIMENSION) // invalid x/s dimension
-        std::cerr << "Invalid cross-section dimension.";
+        return "Invalid cross-section dimension.";
     else if (ECode == ERRORCODE::MATGROUPNUMBER) // invalid material group
-        std::cerr << "Invalid material property group number.";
+        return "Invalid material property group number.";
     else if (ECode == ERRORCODE::MATPROPERTY) // invalid material property
-        std::cerr << "Invalid material property.";
+        return "Invalid material property.";
     else if (ECode == ERRORCODE::ELOADTYPE) // invalid element load type
-        std::cerr << "Invalid element load type.";
+        return "Invalid element load type.";
     else if (ECode == ERRORCODE::XSTYPE) // invalid x/s type
-        std::cerr << "Invalid cross-section type.";
+        return "Invalid cross-section type.";
     else
-        std::cerr << "Unknown error ...?";
+        return "Unknown error ...?";
+}
 
-    std::cerr << '\n' << "Error in input file line : " << m_nLineNumber;
-    std::cerr << std::endl;
+void CElement::InputError (const ERRORCODE ECode)
+// ---------------------------------------------------------------------------
+// Function: records an error in the input data at the current line. The
+//           reader carries on so that later errors are found in the same
+//           run; the job is abandoned once the input has been read.
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_Diagnostics.Add (CDiagnostics::SEVERITY::SEVERE, m_nLineNumber,
+                       IOErrorMessage (ECode));
+}
 
-    exit (1);
+void CElement::IOErrorHandler (const ERRORCODE ECode)
+// ---------------------------------------------------------------------------
+// Function: records an error in the input data at the current line and
+//           abandons the job (the rest of the input cannot be read)
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    InputError (ECode);
+    throw CLocalErrorHandler::ERRORCODE::INVALIDINPUT;
 }
 
 void CElement::TerminateProgram ()
@@ -544,5 +1297,8 @@ void CElement::TerminateProgram ()
     m_FileInput.close ();
     m_FileOutput.close ();
 
-    std::cout << "\nExecution completed successfully." << std::endl;
+    if (m_Diagnostics.HasErrors())
+        std::cout << "\nExecution stopped: errors in the input file." << std::endl;
+    else
+        std::cout << "\nExecution completed successfully." << std::endl;
 }
@@ -10,14 +10,225 @@ TODO:
 - Moment capacity, rect.solid
 **********************************************/
 
+#include <cstring>
+#include <chrono>
 #include "element.h"
+#include "batch.h"
+#include "stream.h"
 #include "clockEXH.h"
 
+static void RunIncremental (const std::string& strInput,
+                            const std::string& strOutput,
+                            CDiskCache* pDiskCache)
+// ---------------------------------------------------------------------------
+// Function: interactive design loop. The input file is analyzed, then
+//           re-analyzed each time the user presses Enter. Section results
+//           are kept in the analysis cache, so when only the demands have
+//           changed the re-check does not repeat any section solve.
+// Input:    input and output file names, cache file (nullptr = none)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CAnalysisCache& Cache = CAnalysisCache::GetDefault();
+    for (;;)
+    {
+        auto Start = std::chrono::steady_clock::now();
+        int nReused = 0;
+        {
+            CElement TheElement;
+            try
+            {
+                TheElement.SetAnalysisCache (&Cache);
+                TheElement.SetDiskCache (pDiskCache);
+                TheElement.PrepareIO (strInput, strOutput);
+                TheElement.Analyze ();
+                nReused = TheElement.GetNumReused ();
+            }
+            catch (CLocalErrorHandler::ERRORCODE &err)
+            {
+                TheElement.DisplayErrorMessage (err);
+            }
+            catch (CGlobalErrorHandler::ERRORCODE &err)
+            {
+                CGlobalErrorHandler::ErrorHandler (err);
+            }
+            catch (CArrayBase::CError &err)
+            {
+                CGlobalErrorHandler::ErrorHandler (err);
+            }
+            catch (std::exception &err)
+            {
+                CGlobalErrorHandler::ErrorHandler (err);
+            }
+        }
+        auto Time = std::chrono::duration_cast<std::chrono::microseconds>
+                    (std::chrono::steady_clock::now() - Start);
+        std::cout << "\nAnalysis written to " << strOutput << " in "
+                  << Time.count() << " microseconds (" << nReused
+                  << " section results reused).\n";
+
+        std::string strLine;
+        std::cout << "Edit the input file and press Enter to re-check, q to quit: ";
+        if (!std::getline (std::cin, strLine) || strLine == "q")
+            break;
+    }
+}
+
 int main (int argc, char *argv[])
 {
-    // CArrayBase class is used to track memory allocation, deallocation
-    // and route the error messages from the CVector and CMatrix classes
-    CArrayBase AB;
+    // persistent cache and machine-readable results:
+    // XSDesigner [-cache file] [-results file.csv|file.jsonl] <usual arguments>
+    CDiskCache* pDiskCache = nullptr;
+    CResultWriter* pResults = nullptr;
+    while (argc > 2 && (strcmp(argv[1], "-cache") == 0 ||
+                        strcmp(argv[1], "-results") == 0))
+    {
+        if (strcmp(argv[1], "-cache") == 0)
+        {
+            try
+            {
+                CDiskCache::GetDefault().Open (argv[2]);
+                pDiskCache = &CDiskCache::GetDefault();
+            }
+            catch (CLocalErrorHandler::ERRORCODE&)
+            {
+                std::cerr << "Cannot use " << argv[2]
+                          << " as a cache file. Continuing without it.\n";
+            }
+        }
+        else
+        {
+            try
+            {
+                CResultWriter::GetDefault().Open (argv[2]);
+                pResults = &CResultWriter::GetDefault();
+            }
+            catch (CLocalErrorHandler::ERRORCODE&)
+            {
+                std::cerr << "Cannot open " << argv[2]
+                          << " as a results file. Continuing without it.\n";
+            }
+        }
+        argv[2] = argv[0];
+        argv += 2;
+        argc -= 2;
+    }
+
+    // batch mode: many input files analyzed concurrently
+    if (argc > 1 && strcmp(argv[1], "-batch") == 0)
+    {
+        try
+        {
+            CElement().Banner (std::cout);
+            CBatchDriver TheBatch;
+            TheBatch.SetDiskCache (pDiskCache);
+            TheBatch.SetResultWriter (pResults);
+            TheBatch.Run (argc, argv);
+        }
+        catch (CLocalErrorHandler::ERRORCODE &err)
+        {
+            if (err == CLocalErrorHandler::ERRORCODE::INVALIDCOMMANDLINE)
+                std::cout << "Usage: XSDesigner [-cache file] [-results file] "
+                             "-batch [-o outdir] "
+                             "[-j threads] [-s summary] "
+                             "file|directory|pattern|@manifest ...\n";
+            else
+                std::cout << "Cannot open a batch manifest or summary file.\n";
+        }
+        catch (std::exception &err)
+        {
+            CGlobalErrorHandler::ErrorHandler (err);
+        }
+        return 0;
+    }
+
+    // stream mode: many sections in one input file, analyzed as a pipeline
+    if (argc > 1 && strcmp(argv[1], "-stream") == 0)
+    {
+        try
+        {
+            CElement().Banner (std::cout);
+            CStreamDriver TheStream;
+            TheStream.SetDiskCache (pDiskCache);
+            TheStream.SetResultWriter (pResults);
+            TheStream.Run (argc, argv);
+        }
+        catch (CLocalErrorHandler::ERRORCODE &err)
+        {
+            if (err == CLocalErrorHandler::ERRORCODE::INVALIDCOMMANDLINE)
+                std::cout << "Usage: XSDesigner [-cache file] [-results file] -stream "
+                             "[-j threads] input_file output_file\n";
+            else
+                std::cout << "Cannot open the input or output file.\n";
+        }
+        catch (std::exception &err)
+        {
+            CGlobalErrorHandler::ErrorHandler (err);
+        }
+        return 0;
+    }
+
+    // pipe mode: stdin -> stdout, results only
+    if (argc > 1 && strcmp(argv[1], "-pipe") == 0)
+    {
+        try
+        {
+            CStreamDriver TheStream;
+            TheStream.SetDiskCache (pDiskCache);
+            TheStream.SetResultWriter (pResults);
+            TheStream.RunPipe (argc, argv);
+        }
+        catch (CLocalErrorHandler::ERRORCODE&)
+        {
+            std::cerr << "Usage: XSDesigner [-cache file] [-results file] -pipe "
+                         "[-j threads] < input > output\n";
+            return 1;
+        }
+        catch (std::exception &err)
+        {
+            std::cerr << err.what() << '\n';
+            return 1;
+        }
+        return 0;
+    }
+
+    // compile mode: text input -> binary (.xsb) input, round trip checked
+    if (argc == 4 && strcmp(argv[1], "-compile") == 0)
+    {
+        CElement TheElement;
+        try
+        {
+            if (!TheElement.CompileInput (argv[2], argv[3]))
+            {
+                std::cout << argv[3] << " does not reproduce " << argv[2]
+                          << ". Round trip check failed.\n";
+                return 1;
+            }
+            std::cout << argv[2] << " compiled to " << argv[3]
+                      << ". Round trip check passed.\n";
+        }
+        catch (CLocalErrorHandler::ERRORCODE &err)
+        {
+            TheElement.DisplayErrorMessage (err);
+            return 1;
+        }
+        catch (CGlobalErrorHandler::ERRORCODE &err)
+        {
+            CGlobalErrorHandler::ErrorHandler (err);
+            return 1;
+        }
+        return 0;
+    }
+
+    // incremental mode: re-check the same input as its demands change
+    if (argc == 4 && strcmp(argv[1], "-incremental") == 0)
+    {
+        CElement().Banner (std::cout);
+        RunIncremental (argv[2], argv[3], pDiskCache);
+        return 0;
+    }
+
+    int nReturn = 0;
     {
         CElement TheElement; // the one and only element!
         try
@@ -27,6 +238,7 @@ int main (int argc, char *argv[])
 
 	        // Prepare for I/O
 	        TheElement.PrepareIO (argc, argv);
+            TheElement.SetDiskCache (pDiskCache);
 	
             // start the timer --------------------------------------------------------
             CClock Timer;
@@ -37,6 +249,12 @@ int main (int argc, char *argv[])
 
             // read the data and analyze
             TheElement.Analyze ();
+            if (pResults != nullptr)
+            {
+                CResultWriter::CRecord Record;
+                TheElement.GetRecord (Record);
+                pResults->Write (Record);
+            }
 
             // end the timer --------------------------------------------------------
             // get the current date and time
@@ -53,37 +271,44 @@ int main (int argc, char *argv[])
         catch (CLocalErrorHandler::ERRORCODE &err)
         {
             TheElement.DisplayErrorMessage (err);
+            nReturn = 1;
         }
 
         // errors trapped by the library functions
         catch (CGlobalErrorHandler::ERRORCODE &err)
         {
             CGlobalErrorHandler::ErrorHandler (err);
+            nReturn = 1;
         }
 
         // errors trapped in the CVector/CMatrix classes
-        catch (CArrayBase::ERRORVM &err)
+        catch (CArrayBase::CError &err)
         {
             CGlobalErrorHandler::ErrorHandler (err);
+            nReturn = 1;
         }
 
         // errors trapped by C++ 
         catch (std::exception &err)
         {
             CGlobalErrorHandler::ErrorHandler (err);
+            nReturn = 1;
         }
 
         // forgotten to handle a trapped error?
         catch (...)
         {
             std::cout << "Sorry, could not catch the error whatever it is.\n";
+            nReturn = 1;
         }
 
         // Close input and output files
         TheElement.TerminateProgram ();
     }
 
-    AB.ShowStatistics (std::cout);
+    if (pResults != nullptr)
+        pResults->Close ();
+    CArrayBase::ShowTotalStatistics (std::cout);
 
-	return 0;
+	return nReturn;
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CMappedFile class.
+
+TODO:
+
+**********************************************/
+#include "mappedfile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+CMappedFile::CMappedFile ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    m_hFile = nullptr;
+    m_hMapping = nullptr;
+#else
+    m_nFile = -1;
+#endif
+    m_pView = nullptr;
+    m_nSize = 0;
+}
+
+CMappedFile::~CMappedFile ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Close ();
+}
+
+void CMappedFile::Open (const std::string& strFileName)
+// ---------------------------------------------------------------------------
+// Function: maps a file read-only
+// Input:    file name
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Close ();
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA (strFileName.c_str(), GENERIC_READ,
+                                FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    m_hFile = hFile;
+    LARGE_INTEGER nSize;
+    if (!GetFileSizeEx (hFile, &nSize))
+    {
+        Close ();
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    }
+    m_nSize = static_cast<size_t>(nSize.QuadPart);
+    if (m_nSize == 0)
+        return;
+    m_hMapping = CreateFileMappingA (hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    void* pView = (m_hMapping == NULL) ? NULL :
+                  MapViewOfFile (static_cast<HANDLE>(m_hMapping),
+                                 FILE_MAP_READ, 0, 0, 0);
+    if (pView == NULL)
+    {
+        Close ();
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    }
+#else
+    m_nFile = open (strFileName.c_str(), O_RDONLY);
+    if (m_nFile < 0)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    struct stat Stat;
+    if (fstat (m_nFile, &Stat) != 0)
+    {
+        Close ();
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    }
+    m_nSize = static_cast<size_t>(Stat.st_size);
+    if (m_nSize == 0)
+        return;
+    void* pView = mmap (nullptr, m_nSize, PROT_READ, MAP_PRIVATE, m_nFile, 0);
+    if (pView == MAP_FAILED)
+    {
+        Close ();
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    }
+#endif
+    m_pView = static_cast<const unsigned char*>(pView);
+}
+
+void CMappedFile::Close ()
+// ---------------------------------------------------------------------------
+// Function: unmaps and closes the file
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    if (m_pView != nullptr)
+        UnmapViewOfFile (m_pView);
+    if (m_hMapping != nullptr)
+        CloseHandle (static_cast<HANDLE>(m_hMapping));
+    if (m_hFile != nullptr)
+        CloseHandle (static_cast<HANDLE>(m_hFile));
+    m_hMapping = nullptr;
+    m_hFile = nullptr;
+#else
+    if (m_pView != nullptr)
+        munmap (const_cast<unsigned char*>(m_pView), m_nSize);
+    if (m_nFile >= 0)
+        close (m_nFile);
+    m_nFile = -1;
+#endif
+    m_pView = nullptr;
+    m_nSize = 0;
+}
+
+bool CMappedFile::IsOpen () const
+// ---------------------------------------------------------------------------
+// Function: checks whether a file is open
+// Input:    none
+// Output:   true if open
+// ---------------------------------------------------------------------------
+{
+#ifdef _WIN32
+    return m_hFile != nullptr;
+#else
+    return m_nFile >= 0;
+#endif
+}
+
+const unsigned char* CMappedFile::GetData () const
+// ---------------------------------------------------------------------------
+// Function: gets the view of the file
+// Input:    none
+// Output:   first byte (nullptr if the file is empty)
+// ---------------------------------------------------------------------------
+{
+    return m_pView;
+}
+
+size_t CMappedFile::GetSize () const
+// ---------------------------------------------------------------------------
+// Function: gets the size of the view
+// Input:    none
+// Output:   # of bytes
+// ---------------------------------------------------------------------------
+{
+    return m_nSize;
+}
+
+void CMappedFile::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
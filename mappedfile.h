@@ -0,0 +1,50 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Read-only view of a whole file. On Windows the
+file is mapped with CreateFileMapping and
+MapViewOfFile, elsewhere with mmap. An empty file
+opens with a null view of size zero.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <string>
+#include "LocalErrorHandler.h"
+
+class CMappedFile
+{
+    public:
+        CMappedFile ();   // ctor
+        ~CMappedFile ();  // dtor
+
+        // helper functions
+        void Open (const std::string& strFileName);
+        void Close ();
+
+        // accessor functions
+        bool IsOpen () const;
+        const unsigned char* GetData () const;
+        size_t GetSize () const;
+
+    private:
+#ifdef _WIN32
+        void* m_hFile;                  // file handle
+        void* m_hMapping;               // file mapping handle
+#else
+        int   m_nFile;                  // file descriptor
+#endif
+        const unsigned char* m_pView;   // view of the file
+        size_t m_nSize;                 // bytes mapped
+
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+
+        // no copies
+        CMappedFile (const CMappedFile&) = delete;
+        CMappedFile& operator= (const CMappedFile&) = delete;
+};
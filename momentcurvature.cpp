@@ -0,0 +1,225 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CMomentCurvature class.
+
+TODO:
+
+**********************************************/
+#include "momentcurvature.h"
+
+CMomentCurvature::CMomentCurvature ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Reset (0.0f, true);
+}
+
+CMomentCurvature::~CMomentCurvature ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CMomentCurvature::Reset (const float fP, const bool bWarmStart)
+// ---------------------------------------------------------------------------
+// Function: clears the curve before a new analysis
+// Input:    axial load, warm start flag
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fVPhi.clear ();
+    m_fVM.clear ();
+    m_fVE0.clear ();
+    m_nVIter.clear ();
+    for (int i = 0; i < 3; i++)
+    {
+        m_fKeyPhi[i] = m_fKeyM[i] = 0.0f;
+        m_bKey[i] = false;
+    }
+    m_fP = fP;
+    m_nTotalIter = 0;
+    m_bWarmStart = bWarmStart;
+}
+
+void CMomentCurvature::AddPoint (const float fPhi, const float fM,
+                                 const float fE0, const int nIterations)
+// ---------------------------------------------------------------------------
+// Function: appends a converged step to the curve
+// Input:    curvature, moment, strain at the origin, # of iterations
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fVPhi.push_back (fPhi);
+    m_fVM.push_back (fM);
+    m_fVE0.push_back (fE0);
+    m_nVIter.push_back (nIterations);
+    m_nTotalIter += nIterations;
+}
+
+void CMomentCurvature::SetKeyPoint (KEYPOINT Key, const float fPhi,
+                                    const float fM)
+// ---------------------------------------------------------------------------
+// Function: stores the cracking, yield or ultimate point
+// Input:    key point, curvature and moment
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    int k = static_cast<int>(Key);
+    m_fKeyPhi[k] = fPhi;
+    m_fKeyM[k] = fM;
+    m_bKey[k] = true;
+}
+
+void CMomentCurvature::Pack (std::vector<float>& fV) const
+// ---------------------------------------------------------------------------
+// Function: flattens the curve for storage: axial load, warm start flag,
+//           # of points, (curvature, moment, strain, iterations) for each
+//           point, then (found, curvature, moment) for each key point
+// Input:    none
+// Output:   packed values
+// ---------------------------------------------------------------------------
+{
+    fV.clear ();
+    fV.push_back (m_fP);
+    fV.push_back (m_bWarmStart ? 1.0f : 0.0f);
+    fV.push_back (static_cast<float>(m_fVPhi.size()));
+    for (size_t k = 0; k < m_fVPhi.size(); k++)
+    {
+        fV.push_back (m_fVPhi[k]);
+        fV.push_back (m_fVM[k]);
+        fV.push_back (m_fVE0[k]);
+        fV.push_back (static_cast<float>(m_nVIter[k]));
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        fV.push_back (m_bKey[i] ? 1.0f : 0.0f);
+        fV.push_back (m_fKeyPhi[i]);
+        fV.push_back (m_fKeyM[i]);
+    }
+}
+
+bool CMomentCurvature::Unpack (const std::vector<float>& fV)
+// ---------------------------------------------------------------------------
+// Function: rebuilds the curve from the values stored by Pack
+// Input:    packed values
+// Output:   returns false (curve unchanged) if the values do not match
+// ---------------------------------------------------------------------------
+{
+    if (fV.size() < 3)
+        return false;
+    int nPoints = static_cast<int>(fV[2]);
+    if (nPoints < 0 || fV.size() != 3 + 4*static_cast<size_t>(nPoints) + 9)
+        return false;
+
+    Reset (fV[0], fV[1] != 0.0f);
+    const float* pV = fV.data() + 3;
+    for (int k = 0; k < nPoints; k++, pV += 4)
+        AddPoint (pV[0], pV[1], pV[2], static_cast<int>(pV[3]));
+    for (int i = 0; i < 3; i++, pV += 3)
+    {
+        if (pV[0] != 0.0f)
+            SetKeyPoint (static_cast<KEYPOINT>(i), pV[1], pV[2]);
+    }
+    return true;
+}
+
+int CMomentCurvature::GetNumPoints () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of points on the curve
+// Input:    none
+// Output:   # of points
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_fVPhi.size());
+}
+
+void CMomentCurvature::GetPoint (const int i, float& fPhi, float& fM,
+                                 float& fE0, int& nIterations) const
+// ---------------------------------------------------------------------------
+// Function: gets a point of the curve
+// Input:    point number (1-based)
+// Output:   curvature, moment, strain at the origin, # of iterations
+// ---------------------------------------------------------------------------
+{
+    size_t k = static_cast<size_t>(i - 1);
+    fPhi = m_fVPhi[k];
+    fM = m_fVM[k];
+    fE0 = m_fVE0[k];
+    nIterations = m_nVIter[k];
+}
+
+bool CMomentCurvature::GetKeyPoint (KEYPOINT Key, float& fPhi,
+                                    float& fM) const
+// ---------------------------------------------------------------------------
+// Function: gets the cracking, yield or ultimate point
+// Input:    key point
+// Output:   curvature and moment; returns false if the point was not
+//           reached (e.g. no steel or the section never cracks)
+// ---------------------------------------------------------------------------
+{
+    int k = static_cast<int>(Key);
+    fPhi = m_fKeyPhi[k];
+    fM = m_fKeyM[k];
+    return m_bKey[k];
+}
+
+float CMomentCurvature::GetAxialLoad () const
+// ---------------------------------------------------------------------------
+// Function: gets the axial load the curve was computed for
+// Input:    none
+// Output:   axial load
+// ---------------------------------------------------------------------------
+{
+    return m_fP;
+}
+
+int CMomentCurvature::GetTotalIterations () const
+// ---------------------------------------------------------------------------
+// Function: gets the total # of solver iterations over all steps
+// Input:    none
+// Output:   # of iterations
+// ---------------------------------------------------------------------------
+{
+    return m_nTotalIter;
+}
+
+bool CMomentCurvature::IsWarmStarted () const
+// ---------------------------------------------------------------------------
+// Function: were the steps warm started from the previous solution?
+// Input:    none
+// Output:   true if warm started, false for cold bisection
+// ---------------------------------------------------------------------------
+{
+    return m_bWarmStart;
+}
+
+const float* CMomentCurvature::GetCurvature () const
+// ---------------------------------------------------------------------------
+// Function: gets the curvatures as a contiguous array
+// Input:    none
+// Output:   pointer to GetNumPoints() values
+// ---------------------------------------------------------------------------
+{
+    return m_fVPhi.data();
+}
+
+const float* CMomentCurvature::GetMoment () const
+// ---------------------------------------------------------------------------
+// Function: gets the moments as a contiguous array
+// Input:    none
+// Output:   pointer to GetNumPoints() values
+// ---------------------------------------------------------------------------
+{
+    return m_fVM.data();
+}
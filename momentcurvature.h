@@ -0,0 +1,63 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Moment-curvature response of a section under a
+constant axial load. The curve is kept in
+contiguous arrays (curvature, moment, strain at
+the centroid and solver iterations per step)
+together with the cracking, first yield and
+ultimate points extracted from it.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <vector>
+
+class CMomentCurvature
+{
+    public:
+        CMomentCurvature ();   // ctor
+        ~CMomentCurvature ();  // dtor
+
+        static const int DEFAULTSTEPS = 100;  // curvature steps up to ultimate
+
+        enum class KEYPOINT { CRACKING = 0, YIELD = 1, ULTIMATE = 2 };
+
+        // helper functions
+        void  Pack (std::vector<float>& fV) const;
+        bool  Unpack (const std::vector<float>& fV);
+
+        // accessor functions
+        int   GetNumPoints () const;
+        void  GetPoint (const int i, float& fPhi, float& fM, float& fE0,
+                        int& nIterations) const;
+        bool  GetKeyPoint (KEYPOINT Key, float& fPhi, float& fM) const;
+        float GetAxialLoad () const;
+        int   GetTotalIterations () const;
+        bool  IsWarmStarted () const;
+        const float* GetCurvature () const;
+        const float* GetMoment () const;
+
+        // modifier functions
+        void Reset (const float fP, const bool bWarmStart);
+        void AddPoint (const float fPhi, const float fM, const float fE0,
+                       const int nIterations);
+        void SetKeyPoint (KEYPOINT Key, const float fPhi, const float fM);
+
+    private:
+        std::vector<float> m_fVPhi;      // curvature (1/in)
+        std::vector<float> m_fVM;        // moment (kip-in)
+        std::vector<float> m_fVE0;       // strain at the section origin
+        std::vector<int>   m_nVIter;     // solver iterations for the step
+        float m_fKeyPhi[3];              // key point curvatures
+        float m_fKeyM[3];                // key point moments
+        bool  m_bKey[3];                 // key point found
+        float m_fP;                      // axial load
+        int   m_nTotalIter;              // total solver iterations
+        bool  m_bWarmStart;              // steps were warm started
+};
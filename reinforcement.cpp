@@ -10,6 +10,7 @@ TODO:
 **********************************************/
 #include "reinforcement.h"
 #include <sstream>
+#include "constants.h"
 
 CReinforcement::CReinforcement ()
 // ---------------------------------------------------------------------------
@@ -59,6 +60,67 @@ float CReinforcement::GetArea()
 // Output:   Total area of reinforcement
 // ---------------------------------------------------------------------------
 {
+    float fDia, fX, fY;
+
     m_fArea = 0.0f;
+    for (int i = 1; i <= GetNumBars(); i++)
+    {
+        GetBar(i, fDia, fX, fY);
+        m_fArea += static_cast<float>(PI) * fDia * fDia / 4.0f;
+    }
     return m_fArea;
 }
+
+int CReinforcement::GetNumBars() const
+// ---------------------------------------------------------------------------
+// Function: Gets the number of bars stored (three values per bar)
+// Input:    None
+// Output:   Number of bars
+// ---------------------------------------------------------------------------
+{
+    return m_fVReData.GetSize() / 3;
+}
+
+void CReinforcement::GetBar(const int i, float& fDia, float& fX, float& fY) const
+// ---------------------------------------------------------------------------
+// Function: Gets the diameter and location of a bar
+// Input:    bar number, variables to hold diameter and coordinates
+// Output:   bar diameter, x- and y-coordinates
+// ---------------------------------------------------------------------------
+{
+    fDia = m_fVReData(3 * i - 2);
+    fX = m_fVReData(3 * i - 1);
+    fY = m_fVReData(3 * i);
+}
+
+int CReinforcement::GetNumPoints() const
+// ---------------------------------------------------------------------------
+// Function: Gets the number of points of a transverse reinforcement
+//           polyline (diameter followed by x, y pairs)
+// Input:    None
+// Output:   Number of points
+// ---------------------------------------------------------------------------
+{
+    return (m_fVReData.GetSize() - 1) / 2;
+}
+
+void CReinforcement::GetPoint(const int i, float& fX, float& fY) const
+// ---------------------------------------------------------------------------
+// Function: Gets a point of a transverse reinforcement polyline
+// Input:    point number, variables to hold the coordinates
+// Output:   x- and y-coordinates
+// ---------------------------------------------------------------------------
+{
+    fX = m_fVReData(2 * i);
+    fY = m_fVReData(2 * i + 1);
+}
+
+float CReinforcement::GetTieDiameter() const
+// ---------------------------------------------------------------------------
+// Function: Gets the bar diameter of a transverse reinforcement polyline
+// Input:    None
+// Output:   bar diameter
+// ---------------------------------------------------------------------------
+{
+    return m_fVReData(1);
+}
@@ -27,6 +27,11 @@ public:
     // Parse and set Transverse reinforcement data
 
     // Accessor functions
+    int  GetNumBars() const;
+    void GetBar(const int i, float& fDia, float& fX, float& fY) const;
+    int  GetNumPoints() const;
+    void GetPoint(const int i, float& fX, float& fY) const;
+    float GetTieDiameter() const;
 
 
 private:
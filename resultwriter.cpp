@@ -0,0 +1,386 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CResultWriter class.
+
+TODO:
+
+**********************************************/
+#include <cstring>
+#include <cmath>
+#include <charconv>
+#include <limits>
+#include "resultwriter.h"
+#include "parserEXH.h"
+
+// field names in record order (also the CSV header)
+static const char* szFields[] = {
+    "source", "section", "member", "type", "pu", "vu", "mu", "mn", "phi",
+    "phimn", "c", "et", "phivc", "dc_flexure", "dc_shear", "dc_pm",
+    "governing", "status", "message"};
+
+CResultWriter::CResultWriter ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_Format = FORMAT::CSV;
+    m_nUsed = 0;
+    m_nRecords = 0;
+    m_bFirstField = true;
+}
+
+CResultWriter::~CResultWriter ()
+// ---------------------------------------------------------------------------
+// Function: destructor. writes the records still in the buffer
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    try
+    {
+        Close ();
+    }
+    catch (CLocalErrorHandler::ERRORCODE&)
+    {
+    }
+}
+
+void CResultWriter::Open (const std::string& strFileName)
+// ---------------------------------------------------------------------------
+// Function: opens the results file. Names ending in .jsonl, .ndjson or
+//           .json get JSON Lines, all others CSV.
+// Input:    file name
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Close ();
+    m_Format = FORMAT::CSV;
+    for (const char* szExtension : {".jsonl", ".ndjson", ".json"})
+    {
+        size_t nLength = strlen(szExtension);
+        if (strFileName.size() >= nLength &&
+            CParser::IsEqual (std::string_view(strFileName).substr(
+                              strFileName.size() - nLength), szExtension))
+            m_Format = FORMAT::JSONL;
+    }
+
+    m_FileOutput.open (strFileName, std::ios::out | std::ios::binary);
+    if (!m_FileOutput)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+    m_strFileName = strFileName;
+    m_cVBuffer.resize (BUFFERSIZE);
+    m_nUsed = 0;
+    m_nRecords = 0;
+
+    if (m_Format == FORMAT::CSV)
+    {
+        for (size_t i = 0; i < sizeof(szFields)/sizeof(szFields[0]); i++)
+        {
+            if (i > 0)
+                Put (",");
+            Put (szFields[i]);
+        }
+        Put ("\n");
+    }
+}
+
+void CResultWriter::Close ()
+// ---------------------------------------------------------------------------
+// Function: writes the buffered records and closes the file
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (!m_FileOutput.is_open())
+        return;
+    Flush ();
+    m_FileOutput.close ();
+    m_strFileName.clear ();
+}
+
+void CResultWriter::Write (const CRecord& Record)
+// ---------------------------------------------------------------------------
+// Function: formats one record into the buffer, writing the buffer to the
+//           file when it is full
+// Input:    record
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    if (!m_FileOutput.is_open())
+        return;
+
+    int n = 0;
+    m_bFirstField = true;
+    if (m_Format == FORMAT::JSONL)
+        Put ("{");
+    PutField (szFields[n++], Record.strSource);
+    PutField (szFields[n++], Record.nSection);
+    PutField (szFields[n++], Record.strMember);
+    PutField (szFields[n++], Record.strType);
+    PutField (szFields[n++], Record.fPu);
+    PutField (szFields[n++], Record.fVu);
+    PutField (szFields[n++], Record.fMu);
+    PutField (szFields[n++], Record.fMn);
+    PutField (szFields[n++], Record.fPhi);
+    PutField (szFields[n++], Record.fPhiMn);
+    PutField (szFields[n++], Record.fC);
+    PutField (szFields[n++], Record.fEpsT);
+    PutField (szFields[n++], Record.fPhiVc);
+    PutField (szFields[n++], Record.fFlexureDC);
+    PutField (szFields[n++], Record.fShearDC);
+    PutField (szFields[n++], Record.fPMDC);
+    PutField (szFields[n++], Record.strGoverning);
+    PutField (szFields[n++], Record.bError ? "ERROR" : Record.bOK ? "OK" : "NG");
+    PutField (szFields[n++], Record.strMessage);
+    Put ((m_Format == FORMAT::JSONL) ? "}\n" : "\n");
+    m_nRecords++;
+}
+
+CResultWriter::CRecord CResultWriter::ErrorRecord (const std::string& strSource,
+                                                   const int nSection,
+                                                   const std::string& strMessage)
+// ---------------------------------------------------------------------------
+// Function: builds the record of a section that could not be analyzed.
+//           its results are left empty (CSV) or null (JSON)
+// Input:    input file, # of the section in it, diagnostic text
+// Output:   returns the record
+// ---------------------------------------------------------------------------
+{
+    const float fNone = std::numeric_limits<float>::quiet_NaN();
+    CRecord Record;
+    Record.strSource = strSource;
+    Record.nSection = nSection;
+    Record.fPu = Record.fVu = Record.fMu = fNone;
+    Record.fMn = Record.fPhi = Record.fPhiMn = fNone;
+    Record.fC = Record.fEpsT = Record.fPhiVc = fNone;
+    Record.fFlexureDC = Record.fShearDC = Record.fPMDC = fNone;
+    Record.bOK = false;
+    Record.bError = true;
+    Record.strMessage = strMessage;
+    while (!Record.strMessage.empty() && Record.strMessage.back() == '\n')
+        Record.strMessage.pop_back();
+    return Record;
+}
+
+void CResultWriter::Flush ()
+// ---------------------------------------------------------------------------
+// Function: writes the buffered records to the file
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    WriteBuffer ();
+    m_FileOutput.flush ();
+}
+
+void CResultWriter::WriteBuffer ()
+// ---------------------------------------------------------------------------
+// Function: writes the buffer to the file in one block
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_nUsed > 0 && m_FileOutput.is_open())
+        m_FileOutput.write (m_cVBuffer.data(),
+                            static_cast<std::streamsize>(m_nUsed));
+    m_nUsed = 0;
+    if (m_FileOutput.is_open() && !m_FileOutput)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+}
+
+void CResultWriter::Put (std::string_view strvText)
+// ---------------------------------------------------------------------------
+// Function: appends text to the buffer
+// Input:    text
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_nUsed + strvText.size() > m_cVBuffer.size())
+    {
+        WriteBuffer ();
+        if (strvText.size() > m_cVBuffer.size())
+        {
+            m_FileOutput.write (strvText.data(),
+                                static_cast<std::streamsize>(strvText.size()));
+            return;
+        }
+    }
+    memcpy (m_cVBuffer.data() + m_nUsed, strvText.data(), strvText.size());
+    m_nUsed += strvText.size();
+}
+
+void CResultWriter::PutName (const char* szName)
+// ---------------------------------------------------------------------------
+// Function: appends the separator (and, for JSON, the name) of a field
+// Input:    field name
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (!m_bFirstField)
+        Put (",");
+    m_bFirstField = false;
+    if (m_Format == FORMAT::JSONL)
+    {
+        Put ("\"");
+        Put (szName);
+        Put ("\":");
+    }
+}
+
+void CResultWriter::PutField (const char* szName, std::string_view strvValue)
+// ---------------------------------------------------------------------------
+// Function: appends a text field, quoted as the format requires (CSV
+//           fields are quoted only if they hold a comma, quote or line
+//           break)
+// Input:    field name, value
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    PutName (szName);
+    if (m_Format == FORMAT::JSONL)
+    {
+        Put ("\"");
+        size_t nStart = 0;
+        for (size_t i = 0; i < strvValue.size(); i++)
+        {
+            unsigned char c = static_cast<unsigned char>(strvValue[i]);
+            if (c != '"' && c != '\\' && c >= 0x20)
+                continue;
+            Put (strvValue.substr(nStart, i - nStart));
+            char szEscape[8] = {'\\', static_cast<char>(c), 0};
+            if (c < 0x20)
+            {
+                const char* szHex = "0123456789abcdef";
+                memcpy (szEscape, "\\u00", 4);
+                szEscape[4] = szHex[c >> 4];
+                szEscape[5] = szHex[c & 0xF];
+                szEscape[6] = 0;
+            }
+            Put (szEscape);
+            nStart = i + 1;
+        }
+        Put (strvValue.substr(nStart));
+        Put ("\"");
+    }
+    else if (strvValue.find_first_of (",\"\r\n") == std::string_view::npos)
+        Put (strvValue);
+    else
+    {
+        Put ("\"");
+        size_t nStart = 0, nQuote;
+        while ((nQuote = strvValue.find ('"', nStart)) != std::string_view::npos)
+        {
+            Put (strvValue.substr(nStart, nQuote - nStart + 1));
+            Put ("\"");
+            nStart = nQuote + 1;
+        }
+        Put (strvValue.substr(nStart));
+        Put ("\"");
+    }
+}
+
+void CResultWriter::PutField (const char* szName, const int nValue)
+// ---------------------------------------------------------------------------
+// Function: appends an integer field
+// Input:    field name, value
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    PutName (szName);
+    char szValue[16];
+    std::to_chars_result Result = std::to_chars (szValue, szValue + sizeof(szValue),
+                                                 nValue);
+    Put (std::string_view(szValue, static_cast<size_t>(Result.ptr - szValue)));
+}
+
+void CResultWriter::PutField (const char* szName, const float fValue)
+// ---------------------------------------------------------------------------
+// Function: appends a float field in its shortest exact form. a value
+//           that is not finite marks a check that was not made and is
+//           written as an empty field (CSV) or null (JSON)
+// Input:    field name, value
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    PutName (szName);
+    if (!std::isfinite (fValue))
+    {
+        if (m_Format == FORMAT::JSONL)
+            Put ("null");
+        return;
+    }
+    char szValue[32];
+    std::to_chars_result Result = std::to_chars (szValue, szValue + sizeof(szValue),
+                                                 fValue);
+    Put (std::string_view(szValue, static_cast<size_t>(Result.ptr - szValue)));
+}
+
+bool CResultWriter::IsOpen () const
+// ---------------------------------------------------------------------------
+// Function: checks whether a results file is open
+// Input:    none
+// Output:   true if open
+// ---------------------------------------------------------------------------
+{
+    return m_FileOutput.is_open();
+}
+
+CResultWriter::FORMAT CResultWriter::GetFormat () const
+// ---------------------------------------------------------------------------
+// Function: gets the file format
+// Input:    none
+// Output:   CSV or JSON Lines
+// ---------------------------------------------------------------------------
+{
+    return m_Format;
+}
+
+long CResultWriter::GetNumRecords () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of records written
+// Input:    none
+// Output:   # of records
+// ---------------------------------------------------------------------------
+{
+    return m_nRecords;
+}
+
+const std::string& CResultWriter::GetFileName () const
+// ---------------------------------------------------------------------------
+// Function: gets the name of the results file
+// Input:    none
+// Output:   file name (empty if none is open)
+// ---------------------------------------------------------------------------
+{
+    return m_strFileName;
+}
+
+CResultWriter& CResultWriter::GetDefault ()
+// ---------------------------------------------------------------------------
+// Function: gets the results writer shared by the program
+// Input:    none
+// Output:   results writer
+// ---------------------------------------------------------------------------
+{
+    static CResultWriter Writer;
+    return Writer;
+}
+
+void CResultWriter::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
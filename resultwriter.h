@@ -0,0 +1,114 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Machine-readable results, one record per section,
+as CSV (with a header row) or JSON Lines. The
+numbers are formatted with std::to_chars (shortest
+form that reads back to the same float) into a
+preallocated buffer that is written to the file
+in large blocks, so no iostream formatting is
+involved. Records may be written from several
+threads.
+
+Record fields:
+  source, section    input file, # of the section in it
+  member, type       column/beam, circular/rectangular/t
+  pu, vu, mu         demands (kips, kip-in)
+  mn, phi, phimn     flexural capacity at Pu
+  c, et              neutral axis depth, net tensile strain
+  phivc              concrete shear strength (kips)
+  dc_flexure         Mu/phi*Mn
+  dc_shear           Vu/phi*Vn (provided stirrups; concrete
+                     alone if no spacing is given)
+  dc_pm              biaxial P-M ratio (columns)
+  governing, status  largest ratio and OK/NG
+                     (ERROR if the section failed)
+  message            diagnostic text of a failed
+                     section
+A ratio that was not checked is left empty (CSV)
+or null (JSON); FLT_MAX means the section cannot
+carry the axial load. A failed section has only
+its source, section #, status and message.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <mutex>
+#include "LocalErrorHandler.h"
+
+class CResultWriter
+{
+    public:
+        CResultWriter ();   // ctor
+        ~CResultWriter ();  // dtor
+
+        enum class FORMAT { CSV, JSONL };
+        static const size_t BUFFERSIZE = 1 << 20;  // bytes held before a write
+
+        // one section's results
+        struct CRecord
+        {
+            std::string strSource;        // input file
+            int   nSection;               // # of the section in the file (1-based)
+            std::string strMember;        // column or beam
+            std::string strType;          // section type
+            float fPu, fVu, fMu;          // demands
+            float fMn, fPhi, fPhiMn;      // flexural capacity at Pu
+            float fC, fEpsT;              // neutral axis depth, net tensile strain
+            float fPhiVc;                 // concrete shear strength
+            float fFlexureDC;             // Mu/phi*Mn
+            float fShearDC;               // Vu/phi*Vn
+            float fPMDC;                  // biaxial P-M ratio (NaN if not checked)
+            std::string strGoverning;     // check with the largest ratio
+            bool  bOK;                    // all ratios <= 1
+            bool  bError;                 // section could not be analyzed
+            std::string strMessage;       // diagnostic text (failed section)
+        };
+
+        // helper functions
+        void Open (const std::string& strFileName);
+        void Close ();
+        void Write (const CRecord& Record);
+        void Flush ();
+        static CRecord ErrorRecord (const std::string& strSource,
+                                    const int nSection,
+                                    const std::string& strMessage);
+
+        // accessor functions
+        bool IsOpen () const;
+        FORMAT GetFormat () const;
+        long GetNumRecords () const;
+        const std::string& GetFileName () const;
+        static CResultWriter& GetDefault ();
+
+    private:
+        std::string m_strFileName;     // results file
+        std::ofstream m_FileOutput;    // results file
+        FORMAT m_Format;               // CSV or JSON Lines
+        std::vector<char> m_cVBuffer;  // formatted records not yet written
+        size_t m_nUsed;                // bytes used in the buffer
+        long m_nRecords;               // # of records written
+        bool m_bFirstField;            // next field starts the record
+        std::mutex m_Mutex;            // one record at a time
+
+        void WriteBuffer ();
+        void Put (std::string_view strvText);
+        void PutName (const char* szName);
+        void PutField (const char* szName, std::string_view strvValue);
+        void PutField (const char* szName, const int nValue);
+        void PutField (const char* szName, const float fValue);
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+
+        // no copies
+        CResultWriter (const CResultWriter&) = delete;
+        CResultWriter& operator= (const CResultWriter&) = delete;
+};
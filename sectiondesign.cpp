@@ -0,0 +1,679 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CSectionDesigner class.
+
+TODO:
+
+**********************************************/
+#include <cmath>
+#include <algorithm>
+#include "sectiondesign.h"
+#include "reinforcement.h"
+#include "rectsolid.h"
+#include "tsection.h"
+#include "circsolid.h"
+#include "whitneysection.h"
+
+CSectionDesigner::CSectionDesigner ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_Type = CXSType::EPType::RECTS;
+    m_bColumn = false;
+    m_bDefined = false;
+    m_fFc = m_fFy = m_fEs = 0.0f;
+    m_fSteelDensity = 490.0f;
+    m_fPu = m_fMu = 0.0f;
+    for (int i = 0; i < MAXEPDIM; i++)
+        m_fDimMin[i] = m_fDimMax[i] = 0.0f;
+    m_fIncrement = 1.0f;
+    m_fCover = 2.5f;
+    m_nMinBars = 2;
+    m_nMaxBars = 8;
+    m_fConcreteCost = m_fSteelCost = 1.0f;
+    m_nBest = -1;
+    m_BestCap = CCapacityCache::CCapacity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    m_nEvaluated = m_nCacheHits = 0;
+}
+
+CSectionDesigner::~CSectionDesigner ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CSectionDesigner::Design (CThreadPool& Pool, CCapacityCache& Cache)
+// ---------------------------------------------------------------------------
+// Function: finds the cheapest candidate that meets the demands. The
+//           candidates are evaluated in cost order in blocks of a few
+//           per thread; the search stops at the first block with a
+//           section that meets the demands.
+// Input:    thread pool, capacity memo table
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (!m_bDefined)
+        return;
+
+    m_Phi.SetMaterials (m_fFc, m_fFy, m_fEs);
+    m_Phi.SetSpiral (m_Type == CXSType::EPType::CIRCS);
+    Enumerate ();
+
+    m_nBest = -1;
+    m_nEvaluated = m_nCacheHits = 0;
+    const int nCandidates = GetNumCandidates();
+    const int nBlock = std::max(8, 4*Pool.GetNumThreads());
+    std::vector<CCapacityCache::CCapacity> VCap(static_cast<size_t>(nBlock));
+    std::vector<char> bVHit(static_cast<size_t>(nBlock));
+    std::vector<char> bVOK(static_cast<size_t>(nBlock));
+
+    for (int nFirst = 0; nFirst < nCandidates && m_nBest < 0; nFirst += nBlock)
+    {
+        int nLast = std::min(nCandidates, nFirst + nBlock) - 1;
+        Pool.ParallelFor (nFirst, nLast, [&] (int i)
+        {
+            size_t k = static_cast<size_t>(i - nFirst);
+            const CCandidate& Cand = m_Candidates[static_cast<size_t>(i)];
+            bVHit[k] = Evaluate (Cand, Cache, VCap[k]);
+            bVOK[k] = Satisfies (Cand, VCap[k]);
+        });
+        for (int i = nFirst; i <= nLast; i++)
+        {
+            size_t k = static_cast<size_t>(i - nFirst);
+            m_nEvaluated++;
+            if (bVHit[k])
+                m_nCacheHits++;
+            if (bVOK[k] && m_nBest < 0)
+            {
+                m_nBest = i;
+                m_BestCap = VCap[k];
+            }
+        }
+    }
+}
+
+int CSectionDesigner::NumDimensions (const CXSType::EPType Type)
+// ---------------------------------------------------------------------------
+// Function: number of dimensions of a section type
+// Input:    section type
+// Output:   # of dimensions
+// ---------------------------------------------------------------------------
+{
+    if (Type == CXSType::EPType::RECTS)
+        return 2;
+    else if (Type == CXSType::EPType::TSECTION)
+        return 4;
+    return 1;
+}
+
+void CSectionDesigner::Enumerate ()
+// ---------------------------------------------------------------------------
+// Function: lists every combination of dimensions, bar diameter and bar
+//           count whose layout fits and sorts the list by cost (ties keep
+//           the order in which they were generated)
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    const int nDims = NumDimensions (m_Type);
+    if (m_fIncrement <= 0.0f || m_fVDia.empty() || m_nMinBars < 1 ||
+        m_nMaxBars < m_nMinBars)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+
+    // values of each dimension (the upper limit is always included)
+    std::vector<std::vector<float>> fVSteps(static_cast<size_t>(nDims));
+    for (int d = 0; d < nDims; d++)
+    {
+        if (m_fDimMin[d] <= 0.0f || m_fDimMax[d] < m_fDimMin[d])
+            ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+        for (int k = 0; ; k++)
+        {
+            float fV = m_fDimMin[d] + static_cast<float>(k)*m_fIncrement;
+            if (fV > m_fDimMax[d] - 1.0e-3f*m_fIncrement)
+            {
+                fVSteps[d].push_back (m_fDimMax[d]);
+                break;
+            }
+            fVSteps[d].push_back (fV);
+        }
+    }
+
+    m_Candidates.clear ();
+    std::vector<size_t> nVIndex(static_cast<size_t>(nDims), 0);
+    std::vector<float> fVX, fVY;
+    for (;;)
+    {
+        CCandidate Cand;
+        for (int d = 0; d < MAXEPDIM; d++)
+            Cand.fDims[d] = (d < nDims) ? fVSteps[d][nVIndex[d]] : 0.0f;
+
+        // T-section: web no wider than the flange, flange thinner than
+        // the total depth
+        bool bValid = true;
+        if (m_Type == CXSType::EPType::TSECTION)
+            bValid = Cand.fDims[2] <= Cand.fDims[1] &&
+                     Cand.fDims[3] < Cand.fDims[0];
+
+        float fAg = GrossArea (Cand.fDims);
+        for (size_t j = 0; bValid && j < m_fVDia.size(); j++)
+        {
+            Cand.fDia = m_fVDia[j];
+            float fAb = static_cast<float>(PI) * Cand.fDia * Cand.fDia / 4.0f;
+            for (int n = m_nMinBars; n <= m_nMaxBars; n++)
+            {
+                Cand.nBars = n;
+                if (!Layout (Cand, fVX, fVY))
+                    continue;
+                Cand.fCost = (fAg*m_fConcreteCost +
+                              n*fAb*m_fSteelDensity*m_fSteelCost) / 144.0f;
+                m_Candidates.push_back (Cand);
+            }
+        }
+
+        // next set of dimensions
+        int d = 0;
+        for (; d < nDims; d++)
+        {
+            if (++nVIndex[d] < fVSteps[d].size())
+                break;
+            nVIndex[d] = 0;
+        }
+        if (d == nDims)
+            break;
+    }
+
+    std::stable_sort (m_Candidates.begin(), m_Candidates.end(),
+                      [] (const CCandidate& a, const CCandidate& b)
+                      { return a.fCost < b.fCost; });
+}
+
+bool CSectionDesigner::Layout (const CCandidate& Cand,
+                               std::vector<float>& fVX,
+                               std::vector<float>& fVY) const
+// ---------------------------------------------------------------------------
+// Function: places the bars of a candidate. The clear spacing must be at
+//           least max(1 in, db) in beams and max(1.5 in, 1.5 db) in
+//           columns (ACI 318 25.2).
+// Input:    candidate
+// Output:   bar coordinates, returns false if the bars do not fit
+// ---------------------------------------------------------------------------
+{
+    fVX.clear ();
+    fVY.clear ();
+    const int n = Cand.nBars;
+    const float fDb = Cand.fDia;
+    const float fC = m_fCover;
+    const float fMinClear = m_bColumn ? std::max(1.5f, 1.5f*fDb)
+                                      : std::max(1.0f, fDb);
+    if (fC <= 0.5f*fDb)
+        return false;
+
+    if (m_Type == CXSType::EPType::CIRCS)
+    {
+        // ring of bars starting at the top
+        float fR = Cand.fDims[0] - fC;
+        if (fR <= 0.0f || n < (m_bColumn ? 6 : 3))
+            return false;
+        if (2.0f*fR*static_cast<float>(sin(PI/n)) - fDb < fMinClear)
+            return false;
+        for (int i = 0; i < n; i++)
+        {
+            double dAngle = 0.5*PI + 2.0*PI*i/n;
+            fVX.push_back (static_cast<float>(fR*cos(dAngle)));
+            fVY.push_back (static_cast<float>(fR*sin(dAngle)));
+        }
+    }
+    else if (m_Type == CXSType::EPType::RECTS && m_bColumn)
+    {
+        // n/4 + 1 bars on each face, corners shared
+        if (n < 4 || n % 4 != 0)
+            return false;
+        int nFace = n/4 + 1;
+        float fXe = 0.5f*Cand.fDims[0] - fC;
+        float fYe = 0.5f*Cand.fDims[1] - fC;
+        if (fXe <= 0.0f || fYe <= 0.0f)
+            return false;
+        float fSX = 2.0f*fXe/(nFace - 1), fSY = 2.0f*fYe/(nFace - 1);
+        if (fSX - fDb < fMinClear || fSY - fDb < fMinClear)
+            return false;
+        for (int k = 0; k < nFace; k++)
+        {
+            fVX.push_back (-fXe + k*fSX); fVY.push_back (fYe);
+            fVX.push_back (-fXe + k*fSX); fVY.push_back (-fYe);
+        }
+        for (int k = 1; k < nFace - 1; k++)
+        {
+            fVX.push_back (-fXe); fVY.push_back (-fYe + k*fSY);
+            fVX.push_back (fXe);  fVY.push_back (-fYe + k*fSY);
+        }
+    }
+    else
+    {
+        // one layer at the bottom of the (web of the) section
+        bool bRect = (m_Type == CXSType::EPType::RECTS);
+        float fW = bRect ? Cand.fDims[0] : Cand.fDims[2];
+        float fH = bRect ? Cand.fDims[1] : Cand.fDims[0];
+        float fY = bRect ? fC - 0.5f*fH : Cand.fDims[3] - fH + fC;
+        float fXe = 0.5f*fW - fC;
+        if (fH <= 2.0f*fC || fXe < 0.0f)
+            return false;
+        if (n == 1)
+        {
+            fVX.push_back (0.0f); fVY.push_back (fY);
+            return true;
+        }
+        float fS = 2.0f*fXe/(n - 1);
+        if (fS - fDb < fMinClear)
+            return false;
+        for (int k = 0; k < n; k++)
+        {
+            fVX.push_back (-fXe + k*fS); fVY.push_back (fY);
+        }
+    }
+    return true;
+}
+
+float CSectionDesigner::GrossArea (const float fDims[]) const
+// ---------------------------------------------------------------------------
+// Function: gross area of the section
+// Input:    dimensions
+// Output:   Ag
+// ---------------------------------------------------------------------------
+{
+    if (m_Type == CXSType::EPType::RECTS)
+        return fDims[0]*fDims[1];
+    else if (m_Type == CXSType::EPType::TSECTION)
+        return fDims[1]*fDims[3] + fDims[2]*(fDims[0] - fDims[3]);
+    return static_cast<float>(PI)*fDims[0]*fDims[0];
+}
+
+bool CSectionDesigner::Evaluate (const CCandidate& Cand,
+                                 CCapacityCache& Cache,
+                                 CCapacityCache::CCapacity& Cap) const
+// ---------------------------------------------------------------------------
+// Function: capacity of a candidate, from the memo table if the same
+//           section has been solved before
+// Input:    candidate, memo table
+// Output:   capacity, returns true if it came from the table
+// ---------------------------------------------------------------------------
+{
+    std::vector<float> fVX, fVY;
+    Layout (Cand, fVX, fVY);
+    std::vector<float> fVDia(fVX.size(), Cand.fDia);
+    std::vector<long long> nVKey;
+    float fP = m_bColumn ? m_fPu : 0.0f;
+    CCapacityCache::CanonicalKey (m_Type, Cand.fDims, m_fFc, m_fFy, m_fEs,
+                                  fP, fVDia, fVX, fVY, nVKey);
+    if (Cache.Find (nVKey, Cap))
+        return true;
+
+    if (m_Type == CXSType::EPType::RECTS)
+        Capacity<CXSType::EPType::RECTS> (Cand, fVX, fVY, Cap);
+    else if (m_Type == CXSType::EPType::TSECTION)
+        Capacity<CXSType::EPType::TSECTION> (Cand, fVX, fVY, Cap);
+    else
+        Capacity<CXSType::EPType::CIRCS> (Cand, fVX, fVY, Cap);
+    Cache.Insert (nVKey, Cap);
+    return false;
+}
+
+template <CXSType::EPType TYPE>
+void CSectionDesigner::Capacity (const CCandidate& Cand,
+                                 const std::vector<float>& fVX,
+                                 const std::vector<float>& fVY,
+                                 CCapacityCache::CCapacity& Cap) const
+// ---------------------------------------------------------------------------
+// Function: moment capacity (closed-form stress block) on the design
+//           interaction curve where phi*Pn equals the design axial load,
+//           and maximum design axial strength of a candidate
+// Input:    candidate, bar coordinates
+// Output:   capacity
+// ---------------------------------------------------------------------------
+{
+    CVector<float> fVDims(MAXEPDIM);
+    for (int i = 0; i < MAXEPDIM; i++)
+        fVDims(i+1) = Cand.fDims[i];
+
+    int nBars = static_cast<int>(fVX.size());
+    CVector<float> fVReData(3*nBars);
+    for (int i = 1; i <= nBars; i++)
+    {
+        fVReData(3*i-2) = Cand.fDia;
+        fVReData(3*i-1) = fVX[static_cast<size_t>(i-1)];
+        fVReData(3*i)   = fVY[static_cast<size_t>(i-1)];
+    }
+    CReinforcement Re;
+    Re.SetSize (static_cast<float>(3*nBars));
+    Re.SetXSReData (fVReData);
+
+    float fP = m_bColumn ? m_fPu : 0.0f;
+    auto Solve = [&] (const CXSType& XS)
+    {
+        CWhitneySection<TYPE> Section(XS, m_fFc, m_fFy, m_fEs);
+        Section.AddBars (Re);
+        float fC;
+        Section.FindMomentCapacity (fP, m_Phi, Cap.fMn, Cap.fPhiMn, fC,
+                                    Cap.fEpsT, Cap.fPhi);
+    };
+    if constexpr (TYPE == CXSType::EPType::RECTS)
+        Solve (CRectSolid(fVDims));
+    else if constexpr (TYPE == CXSType::EPType::TSECTION)
+        Solve (CTSection(fVDims));
+    else
+        Solve (CCircSolid(fVDims));
+
+    // phi*Pn,max = phi (0.80 or 0.85) [0.85 f'c (Ag - Ast) + fy Ast]
+    float fAs = nBars * static_cast<float>(PI) * Cand.fDia * Cand.fDia / 4.0f;
+    float fP0 = 0.85f*m_fFc*(GrossArea (Cand.fDims) - fAs) + m_fFy*fAs;
+    float fFactor = (TYPE == CXSType::EPType::CIRCS) ? 0.85f : 0.80f;
+    Cap.fPhiPnMax = m_Phi.GetPhi (-0.003f) * fFactor * fP0;
+}
+
+bool CSectionDesigner::Satisfies (const CCandidate& Cand,
+                                  const CCapacityCache::CCapacity& Cap) const
+// ---------------------------------------------------------------------------
+// Function: checks a candidate against the demands and the ACI 318 limits
+//           beams:   phi*Mn >= Mu, et >= 0.004 (9.3.3.1) and
+//                    As >= As,min (9.6.1.2; rect. and T only)
+//           columns: phi*Mn >= Mu at phi*Pn = Pu, phi*Pn,max >= Pu and
+//                    0.01 Ag <= Ast <= 0.08 Ag (10.6.1.1)
+// Input:    candidate, its capacity
+// Output:   returns true if the candidate is adequate
+// ---------------------------------------------------------------------------
+{
+    if (Cap.fPhiMn < m_fMu)
+        return false;
+
+    float fAs = Cand.nBars * static_cast<float>(PI) * Cand.fDia * Cand.fDia / 4.0f;
+    float fAg = GrossArea (Cand.fDims);
+    if (m_bColumn)
+        return Cap.fPhiPnMax >= m_fPu && fAs >= 0.01f*fAg && fAs <= 0.08f*fAg;
+
+    if (Cap.fEpsT < 0.004f)
+        return false;
+    if (m_Type != CXSType::EPType::CIRCS)
+    {
+        bool bRect = (m_Type == CXSType::EPType::RECTS);
+        float fBw = bRect ? Cand.fDims[0] : Cand.fDims[2];
+        float fD = (bRect ? Cand.fDims[1] : Cand.fDims[0]) - m_fCover;
+        float fFcPsi = 1000.0f*m_fFc;
+        float fAsMin = std::max(3.0f*sqrtf(fFcPsi), 200.0f) / (1000.0f*m_fFy)
+                       * fBw * fD;
+        if (fAs < fAsMin)
+            return false;
+    }
+    return true;
+}
+
+bool CSectionDesigner::IsDefined () const
+// ---------------------------------------------------------------------------
+// Function: checks whether a design search was requested
+// Input:    none
+// Output:   true if a *DESIGN block was read
+// ---------------------------------------------------------------------------
+{
+    return m_bDefined;
+}
+
+bool CSectionDesigner::IsFound () const
+// ---------------------------------------------------------------------------
+// Function: checks whether the search found an adequate section
+// Input:    none
+// Output:   true if a section was found
+// ---------------------------------------------------------------------------
+{
+    return m_nBest >= 0;
+}
+
+CXSType::EPType CSectionDesigner::GetSectionType () const
+// ---------------------------------------------------------------------------
+// Function: gets the section type being designed
+// Input:    none
+// Output:   section type
+// ---------------------------------------------------------------------------
+{
+    return m_Type;
+}
+
+int CSectionDesigner::GetNumCandidates () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of candidates whose bars fit
+// Input:    none
+// Output:   # of candidates
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_Candidates.size());
+}
+
+int CSectionDesigner::GetNumEvaluated () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of candidates evaluated by the last search
+// Input:    none
+// Output:   # of candidates evaluated
+// ---------------------------------------------------------------------------
+{
+    return m_nEvaluated;
+}
+
+int CSectionDesigner::GetNumCacheHits () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of evaluations taken from the memo table
+// Input:    none
+// Output:   # of cache hits
+// ---------------------------------------------------------------------------
+{
+    return m_nCacheHits;
+}
+
+void CSectionDesigner::GetDimensionRange (const int nDim, float& fMin,
+                                          float& fMax) const
+// ---------------------------------------------------------------------------
+// Function: gets the search range of a dimension
+// Input:    dimension # (1-based)
+// Output:   lower and upper limits
+// ---------------------------------------------------------------------------
+{
+    if (nDim < 1 || nDim > MAXEPDIM)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    fMin = m_fDimMin[nDim-1];
+    fMax = m_fDimMax[nDim-1];
+}
+
+void CSectionDesigner::GetSearch (float& fIncrement, float& fCover,
+                                  int& nMinBars, int& nMaxBars) const
+// ---------------------------------------------------------------------------
+// Function: gets the dimension step, the cover and the bar count limits
+// Input:    none
+// Output:   dimension increment, cover to the bar centers, min. and max.
+//           # of bars
+// ---------------------------------------------------------------------------
+{
+    fIncrement = m_fIncrement;
+    fCover = m_fCover;
+    nMinBars = m_nMinBars;
+    nMaxBars = m_nMaxBars;
+}
+
+void CSectionDesigner::GetBarDiameters (std::vector<float>& fVDia) const
+// ---------------------------------------------------------------------------
+// Function: gets the candidate bar diameters
+// Input:    none
+// Output:   bar diameters
+// ---------------------------------------------------------------------------
+{
+    fVDia = m_fVDia;
+}
+
+void CSectionDesigner::GetCosts (float& fConcrete, float& fSteel) const
+// ---------------------------------------------------------------------------
+// Function: gets the unit costs
+// Input:    none
+// Output:   concrete ($/ft^3), reinforcing steel ($/lb)
+// ---------------------------------------------------------------------------
+{
+    fConcrete = m_fConcreteCost;
+    fSteel = m_fSteelCost;
+}
+
+void CSectionDesigner::GetDesign (float fDims[], float& fDia, int& nBars,
+                                  float& fCost,
+                                  CCapacityCache::CCapacity& Cap) const
+// ---------------------------------------------------------------------------
+// Function: gets the section chosen by Design
+// Input:    array of MAXEPDIM values for the dimensions
+// Output:   dimensions, bar diameter, # of bars, cost per foot, capacity
+//           (all zero if no section was found)
+// ---------------------------------------------------------------------------
+{
+    if (m_nBest < 0)
+    {
+        for (int i = 0; i < MAXEPDIM; i++)
+            fDims[i] = 0.0f;
+        fDia = fCost = 0.0f;
+        nBars = 0;
+        Cap = CCapacityCache::CCapacity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        return;
+    }
+    const CCandidate& Best = m_Candidates[static_cast<size_t>(m_nBest)];
+    for (int i = 0; i < MAXEPDIM; i++)
+        fDims[i] = Best.fDims[i];
+    fDia = Best.fDia;
+    nBars = Best.nBars;
+    fCost = Best.fCost;
+    Cap = m_BestCap;
+}
+
+void CSectionDesigner::GetBarLayout (std::vector<float>& fVX,
+                                     std::vector<float>& fVY) const
+// ---------------------------------------------------------------------------
+// Function: gets the bar coordinates of the chosen section
+// Input:    vectors to hold the coordinates
+// Output:   bar coordinates (empty if no section was found)
+// ---------------------------------------------------------------------------
+{
+    fVX.clear ();
+    fVY.clear ();
+    if (m_nBest >= 0)
+        Layout (m_Candidates[static_cast<size_t>(m_nBest)], fVX, fVY);
+}
+
+void CSectionDesigner::SetSection (const CXSType::EPType Type,
+                                   const bool bColumn)
+// ---------------------------------------------------------------------------
+// Function: sets the section type and member type and marks the search
+//           as requested
+// Input:    section type, column (true) or beam (false)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_Type = Type;
+    m_bColumn = bColumn;
+    m_bDefined = true;
+}
+
+void CSectionDesigner::SetMaterials (const float fFc, const float fFy,
+                                     const float fEs,
+                                     const float fSteelDensity)
+// ---------------------------------------------------------------------------
+// Function: sets the material data
+// Input:    f'c, fy, Es (ksi), steel density (pcf)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (fFc <= 0.0f || fFy <= 0.0f || fEs <= 0.0f || fSteelDensity <= 0.0f)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    m_fFc = fFc;
+    m_fFy = fFy;
+    m_fEs = fEs;
+    m_fSteelDensity = fSteelDensity;
+}
+
+void CSectionDesigner::SetDemands (const float fPu, const float fMu)
+// ---------------------------------------------------------------------------
+// Function: sets the demands (Pu is used for columns only)
+// Input:    factored axial load, factored moment
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fPu = fPu;
+    m_fMu = fMu;
+}
+
+void CSectionDesigner::SetDimensionRange (const int nDim, const float fMin,
+                                          const float fMax)
+// ---------------------------------------------------------------------------
+// Function: sets the search range of a dimension (fMin = fMax fixes it)
+// Input:    dimension # (1-based), lower and upper limits
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (nDim < 1 || nDim > MAXEPDIM || fMin <= 0.0f || fMax < fMin)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    m_fDimMin[nDim-1] = fMin;
+    m_fDimMax[nDim-1] = fMax;
+}
+
+void CSectionDesigner::SetSearch (const float fIncrement, const float fCover,
+                                  const int nMinBars, const int nMaxBars)
+// ---------------------------------------------------------------------------
+// Function: sets the dimension step, the cover and the bar count limits
+// Input:    dimension increment, cover to the bar centers, min. and max.
+//           # of bars
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (fIncrement <= 0.0f || fCover <= 0.0f || nMinBars < 1 ||
+        nMaxBars < nMinBars)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    m_fIncrement = fIncrement;
+    m_fCover = fCover;
+    m_nMinBars = nMinBars;
+    m_nMaxBars = nMaxBars;
+}
+
+void CSectionDesigner::SetBarDiameters (const std::vector<float>& fVDia)
+// ---------------------------------------------------------------------------
+// Function: sets the candidate bar diameters
+// Input:    bar diameters
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    for (size_t i = 0; i < fVDia.size(); i++)
+        if (fVDia[i] <= 0.0f)
+            ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    m_fVDia = fVDia;
+}
+
+void CSectionDesigner::SetCosts (const float fConcrete, const float fSteel)
+// ---------------------------------------------------------------------------
+// Function: sets the unit costs
+// Input:    concrete ($/ft^3), reinforcing steel ($/lb)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (fConcrete < 0.0f || fSteel < 0.0f)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    m_fConcreteCost = fConcrete;
+    m_fSteelCost = fSteel;
+}
+
+void CSectionDesigner::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
@@ -0,0 +1,125 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Section design search. The section dimensions
+are stepped over the ranges given in the *DESIGN
+block and, for each set of dimensions, every bar
+diameter and bar count that fits the standard
+layout of the section type is a candidate:
+  beams (rect., T)  one layer of bars at the bottom
+  columns (rect.)   bars on all four faces
+                    (# of bars a multiple of 4)
+  circles           bars on a ring
+Candidates are ordered by cost per foot of member
+and evaluated in cost order, one block at a time
+on the thread pool, until a block contains a
+section that meets the *max values demands; the
+first such section is the cheapest. Capacities
+come from the closed-form stress block, taken on
+the design curve at phi*Pn = Pu for columns, and
+are memoized in a CCapacityCache.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <vector>
+#include "..\libraryEXH\arraycontainersEXH.h"
+#include "constants.h"
+#include "xstype.h"
+#include "fibersection.h"
+#include "capacitycache.h"
+#include "threadpool.h"
+#include "LocalErrorHandler.h"
+
+class CSectionDesigner
+{
+    public:
+        CSectionDesigner ();   // ctor
+        ~CSectionDesigner ();  // dtor
+
+        // helper functions
+        void Design (CThreadPool& Pool, CCapacityCache& Cache);
+        static int NumDimensions (const CXSType::EPType Type);
+
+        // accessor functions
+        bool IsDefined () const;
+        bool IsFound () const;
+        CXSType::EPType GetSectionType () const;
+        int  GetNumCandidates () const;
+        int  GetNumEvaluated () const;
+        int  GetNumCacheHits () const;
+        void GetDimensionRange (const int nDim, float& fMin,
+                                float& fMax) const;
+        void GetSearch (float& fIncrement, float& fCover, int& nMinBars,
+                        int& nMaxBars) const;
+        void GetBarDiameters (std::vector<float>& fVDia) const;
+        void GetCosts (float& fConcrete, float& fSteel) const;
+        void GetDesign (float fDims[], float& fDia, int& nBars,
+                        float& fCost,
+                        CCapacityCache::CCapacity& Cap) const;
+        void GetBarLayout (std::vector<float>& fVX,
+                           std::vector<float>& fVY) const;
+
+        // modifier functions
+        void SetSection (const CXSType::EPType Type, const bool bColumn);
+        void SetMaterials (const float fFc, const float fFy,
+                           const float fEs, const float fSteelDensity);
+        void SetDemands (const float fPu, const float fMu);
+        void SetDimensionRange (const int nDim, const float fMin,
+                                const float fMax);
+        void SetSearch (const float fIncrement, const float fCover,
+                        const int nMinBars, const int nMaxBars);
+        void SetBarDiameters (const std::vector<float>& fVDia);
+        void SetCosts (const float fConcrete, const float fSteel);
+
+    private:
+        struct CCandidate
+        {
+            float fDims[MAXEPDIM];   // section dimensions
+            float fDia;              // bar diameter
+            int   nBars;             // # of bars
+            float fCost;             // cost per foot of member
+        };
+        std::vector<CCandidate> m_Candidates; // candidates in cost order
+
+        CXSType::EPType m_Type;      // section type
+        bool  m_bColumn;             // column (true) or beam (false)
+        bool  m_bDefined;            // a *DESIGN block was read
+        float m_fFc, m_fFy, m_fEs;   // material data (ksi)
+        float m_fSteelDensity;       // steel density (pcf)
+        float m_fPu, m_fMu;          // demands
+        float m_fDimMin[MAXEPDIM];   // lower limits of the dimensions
+        float m_fDimMax[MAXEPDIM];   // upper limits of the dimensions
+        float m_fIncrement;          // dimension step
+        float m_fCover;              // cover to the bar centers
+        int   m_nMinBars, m_nMaxBars;// limits on the # of bars
+        std::vector<float> m_fVDia;  // candidate bar diameters
+        float m_fConcreteCost;       // concrete cost ($/ft^3)
+        float m_fSteelCost;          // steel cost ($/lb)
+        CFiberSection m_Phi;         // materials for phi (not meshed)
+
+        // results
+        int m_nBest;                 // index of the chosen candidate (-1 if none)
+        CCapacityCache::CCapacity m_BestCap; // its capacity
+        int m_nEvaluated;            // # of candidates evaluated
+        int m_nCacheHits;            // # of evaluations found in the cache
+
+        void Enumerate ();
+        bool Layout (const CCandidate& Cand, std::vector<float>& fVX,
+                     std::vector<float>& fVY) const;
+        float GrossArea (const float fDims[]) const;
+        bool Evaluate (const CCandidate& Cand, CCapacityCache& Cache,
+                       CCapacityCache::CCapacity& Cap) const;
+        template <CXSType::EPType TYPE>
+        void Capacity (const CCandidate& Cand, const std::vector<float>& fVX,
+                       const std::vector<float>& fVY,
+                       CCapacityCache::CCapacity& Cap) const;
+        bool Satisfies (const CCandidate& Cand,
+                        const CCapacityCache::CCapacity& Cap) const;
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+};
@@ -0,0 +1,428 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CShearDesign class.
+
+TODO:
+
+**********************************************/
+#include <cmath>
+#include <algorithm>
+#include "shear.h"
+#include "constants.h"
+
+CShearDesign::CShearDesign ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fBw = m_fH = m_fYTop = m_fYMid = m_fAg = m_fD = m_fAv = 0.0f;
+    m_fFc = m_fFyt = 0.0f;
+    m_bCircle = m_bColumn = false;
+    m_fPu = m_fVu = m_fShearLoc = m_fMomentLoc = 0.0f;
+    m_fVc = m_fVsMax = 0.0f;
+}
+
+CShearDesign::~CShearDesign ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CShearDesign::Compute ()
+// ---------------------------------------------------------------------------
+// Function: computes Vc, the required stirrup spacing at the stations,
+//           the spacing zones and the strength with the provided spacings
+//           (ACI 318 22.5, 9.6.3, 9.7.6.2.2; spacings and stresses in psi
+//           units where the code equations need them)
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_fBw <= 0.0f || m_fD <= 0.0f || m_fFc <= 0.0f || m_fFyt <= 0.0f)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDSECTION);
+
+    // concrete strength with the axial load (sqrt(f'c) <= 100 psi)
+    const float fSqrtFc = sqrtf(std::min(1000.0f*m_fFc, 10000.0f));
+    const float fNuAg = 1000.0f*m_fPu/m_fAg;
+    const float fAxial = (m_fPu >= 0.0f) ? 1.0f + fNuAg/2000.0f
+                                         : std::max(0.0f, 1.0f + fNuAg/500.0f);
+    m_fVc = fAxial*2.0f*fSqrtFc*m_fBw*m_fD/1000.0f;
+    m_fVsMax = 8.0f*fSqrtFc*m_fBw*m_fD/1000.0f;
+    const float fVsLimit = 4.0f*fSqrtFc*m_fBw*m_fD/1000.0f;
+
+    // spacing limits (fyt <= 60 ksi)
+    const float fFyt = std::min(m_fFyt, 60.0f);
+    const float fAvFyD = m_fAv*fFyt*m_fD;
+    const float fSMaxLow = std::min(0.5f*m_fD, 24.0f);
+    const float fSMaxHigh = std::min(0.25f*m_fD, 12.0f);
+    const float fSMinSteel = 1000.0f*m_fAv*fFyt /
+                             (std::max(0.75f*fSqrtFc, 50.0f)*m_fBw);
+    const float fVcHalf = 0.5f*PHI*m_fVc;
+    const float fNoStirrups = (m_fAv > 0.0f) ? 0.0f : 1.0f;
+
+    // stations from the start of the member to the farthest location
+    float fL = std::max(m_fShearLoc, m_fMomentLoc);
+    float fProvided = 0.0f;
+    for (size_t j = 0; j < m_fVProvLength.size(); j++)
+        fProvided += m_fVProvLength[j];
+    fL = std::max(fL, fProvided);
+    const int n = (fL > 0.0f) ? NUMSTATIONS : 1;
+    const size_t nS = static_cast<size_t>(n);
+    m_fVX.resize (nS);
+    m_fVVu.resize (nS);
+    m_fVS.resize (nS);
+    m_fVPhiVn.resize (nS);
+    for (int k = 0; k < n; k++)
+        m_fVX[k] = (n > 1) ? fL*k/(n - 1) : 0.0f;
+
+    // shear envelope Vu(x) = Vu clamp(a + b x, 0, 1)
+    float fA = 1.0f, fB = 0.0f;
+    if (!m_bColumn && m_fMomentLoc != m_fShearLoc)
+    {
+        float fDen = m_fMomentLoc - m_fShearLoc;
+        fA = m_fMomentLoc/fDen;
+        fB = -1.0f/fDen;
+    }
+
+    // provided spacing at each station (zones laid end to end from x = 0)
+    std::vector<float> fVSProv(nS, 0.0f);
+    {
+        size_t j = 0;
+        float fEnd = m_fVProvLength.empty() ? 0.0f : m_fVProvLength[0];
+        for (size_t k = 0; k < nS && j < m_fVProvS.size(); k++)
+        {
+            while (j < m_fVProvS.size() && m_fVX[k] > fEnd + 1.0e-4f)
+            {
+                if (++j < m_fVProvS.size())
+                    fEnd += m_fVProvLength[j];
+            }
+            if (j < m_fVProvS.size())
+                fVSProv[k] = m_fVProvS[j];
+        }
+    }
+
+    // all stations in one pass (no branches; the selects compile to blends)
+    const float* pX = m_fVX.data();
+    const float* pSProv = fVSProv.data();
+    float* pVu = m_fVVu.data();
+    float* pS = m_fVS.data();
+    float* pPhiVn = m_fVPhiVn.data();
+    for (int k = 0; k < n; k++)
+    {
+        float fVu = m_fVu*std::min(std::max(fA + fB*pX[k], 0.0f), 1.0f);
+        float fVsReq = std::max(fVu/PHI - m_fVc, 0.0f);
+        float fSStr = fAvFyD/std::max(fVsReq, 1.0e-6f);
+        float fSMax = (fVsReq > fVsLimit) ? fSMaxHigh : fSMaxLow;
+        float fS = std::min(std::min(fSStr, fSMax), fSMinSteel);
+        fS = floorf(fS/SPACINGSTEP)*SPACINGSTEP;
+        fS = (fS < SPACINGSTEP || fVsReq > m_fVsMax) ? -2.0f : fS;
+        fS = (fNoStirrups > 0.0f) ? -1.0f : fS;
+        pS[k] = (fVu <= fVcHalf) ? 0.0f : fS;
+        pVu[k] = fVu;
+
+        float fVsProv = (pSProv[k] > 0.0f) ? fAvFyD/std::max(pSProv[k], 1.0e-6f)
+                                           : 0.0f;
+        pPhiVn[k] = PHI*(m_fVc + std::min(fVsProv, m_fVsMax));
+    }
+
+    // zones: runs of stations with the same spacing
+    m_fVZoneStart.clear ();
+    m_fVZoneEnd.clear ();
+    m_fVZoneS.clear ();
+    m_VZoneType.clear ();
+    for (int k = 0; k < n; k++)
+    {
+        if (k == 0 || m_fVS[k] != m_fVS[k-1])
+        {
+            float fS = m_fVS[k];
+            ZONE Type = ZONE::SPACING;
+            if (fS == 0.0f)
+                Type = ZONE::NOTREQUIRED;
+            else if (fS == -1.0f)
+                Type = ZONE::NOSTIRRUPS;
+            else if (fS < 0.0f)
+                Type = ZONE::SECTION;
+            m_fVZoneStart.push_back (m_fVX[k]);
+            m_fVZoneEnd.push_back (m_fVX[k]);
+            m_fVZoneS.push_back (std::max(fS, 0.0f));
+            m_VZoneType.push_back (Type);
+        }
+        else
+            m_fVZoneEnd.back() = m_fVX[k];
+    }
+
+    // demand/capacity of the provided zones
+    m_fVProvRatio.assign (m_fVProvS.size(), 0.0f);
+    float fStart = 0.0f;
+    for (size_t j = 0; j < m_fVProvS.size(); j++)
+    {
+        float fEnd = fStart + m_fVProvLength[j];
+        for (int k = 0; k < n; k++)
+            if (m_fVX[k] >= fStart - 1.0e-4f && m_fVX[k] <= fEnd + 1.0e-4f)
+                m_fVProvRatio[j] = std::max(m_fVProvRatio[j],
+                                            m_fVVu[k]/m_fVPhiVn[k]);
+        fStart = fEnd;
+    }
+}
+
+int CShearDesign::GetNumStations () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of stations
+// Input:    none
+// Output:   # of stations
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_fVX.size());
+}
+
+void CShearDesign::GetStation (const int i, float& fX, float& fVu,
+                               float& fS) const
+// ---------------------------------------------------------------------------
+// Function: gets the results at a station
+// Input:    station # (1-based)
+// Output:   location, shear demand, required spacing (0 if stirrups are
+//           not required, -1 if there are none, -2 if the section is
+//           too small)
+// ---------------------------------------------------------------------------
+{
+    if (i < 1 || i > GetNumStations())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    fX = m_fVX[i-1];
+    fVu = m_fVVu[i-1];
+    fS = m_fVS[i-1];
+}
+
+int CShearDesign::GetNumZones () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of spacing zones
+// Input:    none
+// Output:   # of zones
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_fVZoneS.size());
+}
+
+void CShearDesign::GetZone (const int i, float& fXStart, float& fXEnd,
+                            float& fS, ZONE& Type) const
+// ---------------------------------------------------------------------------
+// Function: gets a spacing zone
+// Input:    zone # (1-based)
+// Output:   first and last station of the zone, spacing (ZONE::SPACING
+//           only), zone type
+// ---------------------------------------------------------------------------
+{
+    if (i < 1 || i > GetNumZones())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    fXStart = m_fVZoneStart[i-1];
+    fXEnd = m_fVZoneEnd[i-1];
+    fS = m_fVZoneS[i-1];
+    Type = m_VZoneType[i-1];
+}
+
+int CShearDesign::GetNumProvided () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of provided spacing zones
+// Input:    none
+// Output:   # of zones
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_fVProvS.size());
+}
+
+void CShearDesign::GetProvided (const int i, float& fXStart, float& fXEnd,
+                                float& fS, float& fRatio) const
+// ---------------------------------------------------------------------------
+// Function: gets a provided spacing zone and its largest Vu/phi*Vn
+// Input:    zone # (1-based)
+// Output:   start and end, spacing, demand/capacity ratio
+// ---------------------------------------------------------------------------
+{
+    if (i < 1 || i > GetNumProvided())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    fXStart = 0.0f;
+    for (int j = 0; j < i-1; j++)
+        fXStart += m_fVProvLength[j];
+    fXEnd = fXStart + m_fVProvLength[i-1];
+    fS = m_fVProvS[i-1];
+    fRatio = m_fVProvRatio.empty() ? 0.0f : m_fVProvRatio[i-1];
+}
+
+void CShearDesign::GetProvidedSpacings (std::vector<float>& fVSpacing,
+                                        std::vector<float>& fVLength) const
+// ---------------------------------------------------------------------------
+// Function: gets the stirrup spacings given in the input
+// Input:    none
+// Output:   spacing and length of each zone
+// ---------------------------------------------------------------------------
+{
+    fVSpacing = m_fVProvS;
+    fVLength = m_fVProvLength;
+}
+
+void CShearDesign::GetSectionProperties (float& fBw, float& fD,
+                                         float& fAv) const
+// ---------------------------------------------------------------------------
+// Function: gets the section properties used for shear
+// Input:    none
+// Output:   web width, effective depth, stirrup area per set
+// ---------------------------------------------------------------------------
+{
+    fBw = m_fBw;
+    fD = m_fD;
+    fAv = m_fAv;
+}
+
+void CShearDesign::GetStrengths (float& fVc, float& fVsMax) const
+// ---------------------------------------------------------------------------
+// Function: gets the nominal strengths computed by Compute
+// Input:    none
+// Output:   Vc, upper limit on Vs
+// ---------------------------------------------------------------------------
+{
+    fVc = m_fVc;
+    fVsMax = m_fVsMax;
+}
+
+void CShearDesign::SetSection (const CXSType& XS)
+// ---------------------------------------------------------------------------
+// Function: sets the web width and depth of the section. The effective
+//           depth is 0.8 h until bars are set; for circles bw = D and
+//           d = 0.8 D (ACI 318 22.5.2.2).
+// Input:    cross-section
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CVectorN<float,MAXEPDIM> fVDims;
+    XS.GetDimensions (fVDims);
+    CXSType::EPType Type;
+    XS.GetType (Type);
+
+    m_bCircle = (Type == CXSType::EPType::CIRCS);
+    if (Type == CXSType::EPType::RECTS)
+    {
+        m_fBw = fVDims(1);
+        m_fH = fVDims(2);
+        m_fYTop = 0.5f*m_fH;
+        m_fAg = m_fBw*m_fH;
+    }
+    else if (Type == CXSType::EPType::TSECTION)
+    {
+        m_fH = fVDims(1);
+        m_fBw = fVDims(3);
+        m_fYTop = fVDims(4);
+        m_fAg = fVDims(2)*fVDims(4) + fVDims(3)*(fVDims(1) - fVDims(4));
+    }
+    else
+    {
+        m_fH = m_fBw = 2.0f*fVDims(1);
+        m_fYTop = fVDims(1);
+        m_fAg = static_cast<float>(PI)*fVDims(1)*fVDims(1);
+    }
+    m_fYMid = m_fYTop - 0.5f*m_fH;
+    m_fD = 0.8f*m_fH;
+    m_fAv = 0.0f;
+}
+
+void CShearDesign::SetBars (const CReinforcement& Re)
+// ---------------------------------------------------------------------------
+// Function: sets the effective depth to the extreme tension bar
+//           (except for circles)
+// Input:    longitudinal reinforcement
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (m_bCircle || Re.GetNumBars() == 0)
+        return;
+    float fDia, fX, fY, fYMin = m_fYTop;
+    for (int i = 1; i <= Re.GetNumBars(); i++)
+    {
+        Re.GetBar (i, fDia, fX, fY);
+        fYMin = std::min(fYMin, fY);
+    }
+    m_fD = m_fYTop - fYMin;
+}
+
+void CShearDesign::AddStirrup (const CReinforcement& Tr)
+// ---------------------------------------------------------------------------
+// Function: adds the legs of a transverse reinforcement polyline that
+//           cross mid-depth to Av, each leg weighted by |dy|/length
+// Input:    transverse reinforcement polyline
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    float fAb = static_cast<float>(PI)*Tr.GetTieDiameter()*Tr.GetTieDiameter()/4.0f;
+    float fX1, fY1, fX2, fY2;
+    for (int i = 1; i < Tr.GetNumPoints(); i++)
+    {
+        Tr.GetPoint (i, fX1, fY1);
+        Tr.GetPoint (i+1, fX2, fY2);
+        if (std::min(fY1, fY2) >= m_fYMid || std::max(fY1, fY2) <= m_fYMid)
+            continue;
+        float fLength = sqrtf((fX2 - fX1)*(fX2 - fX1) + (fY2 - fY1)*(fY2 - fY1));
+        m_fAv += fAb*fabsf(fY2 - fY1)/fLength;
+    }
+}
+
+void CShearDesign::SetMaterials (const float fFc, const float fFyt)
+// ---------------------------------------------------------------------------
+// Function: sets the material data
+// Input:    f'c and yield strength of the stirrups (ksi)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_fFc = fFc;
+    m_fFyt = fFyt;
+}
+
+void CShearDesign::SetDemands (const bool bColumn, const float fPu,
+                               const float fVu, const float fShearLoc,
+                               const float fMomentLoc)
+// ---------------------------------------------------------------------------
+// Function: sets the demands
+// Input:    column flag, axial load (compression positive, columns
+//           only), maximum shear and its location, location of the
+//           maximum moment
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_bColumn = bColumn;
+    m_fPu = bColumn ? fPu : 0.0f;
+    m_fVu = fabsf(fVu);
+    m_fShearLoc = fShearLoc;
+    m_fMomentLoc = fMomentLoc;
+}
+
+void CShearDesign::SetProvidedSpacings (const std::vector<float>& fVSpacing,
+                                        const std::vector<float>& fVLength)
+// ---------------------------------------------------------------------------
+// Function: sets the stirrup spacings given in the input, zone by zone
+//           from the start of the member
+// Input:    spacing and length of each zone
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (fVSpacing.size() != fVLength.size())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDINPUT);
+    m_fVProvS = fVSpacing;
+    m_fVProvLength = fVLength;
+}
+
+void CShearDesign::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
@@ -0,0 +1,105 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Shear strength and stirrup spacing (ACI 318,
+one-way shear in the y-direction). Vc follows
+22.5.5.1 / 22.5.6.1 (axial load included) and the
+stirrup area Av is the sum of the transverse
+reinforcement legs that cross the mid-depth of the
+section, each weighted by its direction cosine
+with y. The shear along the member is taken as
+  beams:   linear from Vu at its location to zero
+           at the location of the maximum moment
+  columns: constant
+and is evaluated at NUMSTATIONS stations. The
+required spacing at every station is computed in
+one pass over contiguous arrays without branches,
+and the zones are the runs of stations with the
+same spacing rounded down to SPACINGSTEP.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <vector>
+#include "..\libraryEXH\arraycontainersEXH.h"
+#include "xstype.h"
+#include "reinforcement.h"
+#include "LocalErrorHandler.h"
+
+class CShearDesign
+{
+    public:
+        CShearDesign ();   // ctor
+        ~CShearDesign ();  // dtor
+
+        static const int NUMSTATIONS = 101;     // stations along the member
+        static constexpr float SPACINGSTEP = 0.5f; // spacings rounded down to this (in)
+        static constexpr float PHI = 0.75f;      // strength reduction factor for shear
+        enum class ZONE { NOTREQUIRED, SPACING, NOSTIRRUPS, SECTION };
+
+        // helper functions
+        void Compute ();
+
+        // accessor functions
+        int   GetNumStations () const;
+        void  GetStation (const int i, float& fX, float& fVu,
+                          float& fS) const;
+        int   GetNumZones () const;
+        void  GetZone (const int i, float& fXStart, float& fXEnd,
+                       float& fS, ZONE& Type) const;
+        int   GetNumProvided () const;
+        void  GetProvided (const int i, float& fXStart, float& fXEnd,
+                           float& fS, float& fRatio) const;
+        void  GetProvidedSpacings (std::vector<float>& fVSpacing,
+                                   std::vector<float>& fVLength) const;
+        void  GetSectionProperties (float& fBw, float& fD,
+                                    float& fAv) const;
+        void  GetStrengths (float& fVc, float& fVsMax) const;
+
+        // modifier functions
+        void SetSection (const CXSType& XS);
+        void SetBars (const CReinforcement& Re);
+        void AddStirrup (const CReinforcement& Tr);
+        void SetMaterials (const float fFc, const float fFyt);
+        void SetDemands (const bool bColumn, const float fPu,
+                         const float fVu, const float fShearLoc,
+                         const float fMomentLoc);
+        void SetProvidedSpacings (const std::vector<float>& fVSpacing,
+                                  const std::vector<float>& fVLength);
+
+    private:
+        float m_fBw;             // web width
+        float m_fH;              // total depth
+        float m_fYTop;           // y of the extreme compression fiber
+        float m_fYMid;           // y of mid-depth (legs crossing it count)
+        float m_fAg;             // gross area
+        float m_fD;              // effective depth
+        float m_fAv;             // stirrup area per set
+        float m_fFc, m_fFyt;     // f'c and fyt (ksi)
+        bool  m_bCircle;         // circular section
+        bool  m_bColumn;         // column (constant shear)
+        float m_fPu, m_fVu;      // demands
+        float m_fShearLoc;       // location of Vu
+        float m_fMomentLoc;      // location of the maximum moment
+        float m_fVc, m_fVsMax;   // concrete strength, limit on Vs
+
+        // stations (structure of arrays)
+        std::vector<float> m_fVX;     // location
+        std::vector<float> m_fVVu;    // shear demand
+        std::vector<float> m_fVS;     // required spacing (0 none, < 0 see ZONE)
+        std::vector<float> m_fVPhiVn; // design strength with the provided spacing
+
+        // zones of equal required spacing
+        std::vector<float> m_fVZoneStart, m_fVZoneEnd, m_fVZoneS;
+        std::vector<ZONE>  m_VZoneType;
+
+        // provided spacings (*TRANSVERSE SPACINGS)
+        std::vector<float> m_fVProvS, m_fVProvLength, m_fVProvRatio;
+
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+};
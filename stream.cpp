@@ -0,0 +1,544 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CStreamDriver class.
+
+TODO:
+
+**********************************************/
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <map>
+#include <algorithm>
+#include "stream.h"
+#include "element.h"
+#include "clockEXH.h"
+#include "arenaEXH.h"
+
+static std::string_view FirstToken (const std::string& strLine)
+// ---------------------------------------------------------------------------
+// Function: gets the first token of an input line
+// Input:    input line
+// Output:   first token (empty for a blank line)
+// ---------------------------------------------------------------------------
+{
+    const char* szDelimiters = " \t,";
+    size_t nStart = strLine.find_first_not_of (szDelimiters);
+    if (nStart == std::string::npos)
+        return std::string_view();
+    size_t nEnd = strLine.find_first_of (szDelimiters, nStart);
+    if (nEnd == std::string::npos)
+        nEnd = strLine.size();
+    return std::string_view(strLine).substr (nStart, nEnd - nStart);
+}
+
+CStreamDriver::CStreamDriver ()
+// ---------------------------------------------------------------------------
+// Function: default constructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_nThreads = 0;
+    m_bTimestamps = true;
+    m_nWindow = 0;
+    m_nFailed = 0;
+    m_nWritten = 0;
+    m_pDiskCache = nullptr;
+    m_pResults = nullptr;
+    m_bCarry = false;
+}
+
+CStreamDriver::~CStreamDriver ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+void CStreamDriver::Run (int argc, char* argv[])
+// ---------------------------------------------------------------------------
+// Function: parses the stream command line, opens the files and runs the
+//           pipeline
+// Input:    command line arguments (argv[1] is -stream)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::vector<std::string> strVFiles = ParseOptions (argc, argv);
+    if (strVFiles.size() != 2)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDCOMMANDLINE);
+
+    std::ifstream Input(strVFiles[0], std::ios::in);
+    if (!Input)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENIFILE);
+    m_strSource = strVFiles[0];
+    std::ofstream Output(strVFiles[1], std::ios::out);
+    if (!Output)
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::CANNOTOPENOFILE);
+
+    CClock Timer;
+    CThreadPool Pool(m_nThreads);
+    std::cout << "\nStreaming the sections of " << strVFiles[0] << " on "
+              << Pool.GetNumThreads() << " thread(s).\n";
+    CElement().Banner (Output);
+    Process (Input, Output, Pool);
+
+    std::cout << GetNumSections() - GetNumFailed() << " section(s) completed, "
+              << GetNumFailed() << " failed.\n";
+    std::cout << "Results written to " << strVFiles[1] << "\n";
+    std::cout << "Elapsed wall clock time: " << Timer.DiffTime ()
+              << " seconds\n";
+}
+
+void CStreamDriver::RunPipe (int argc, char* argv[])
+// ---------------------------------------------------------------------------
+// Function: runs the pipeline from stdin to stdout. Nothing but the
+//           results goes to stdout (errors go to stderr) and the output
+//           has no banner or times.
+// Input:    command line arguments (argv[1] is -pipe)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (!ParseOptions (argc, argv).empty())
+        ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDCOMMANDLINE);
+
+    std::ios::sync_with_stdio (false);
+    m_strSource = "stdin";
+    m_bTimestamps = false;
+    CThreadPool Pool(m_nThreads);
+    Process (std::cin, std::cout, Pool);
+    std::cout.flush ();
+    if (GetNumFailed() > 0)
+        std::cerr << GetNumFailed() << " of " << GetNumSections()
+                  << " section(s) failed.\n";
+}
+
+std::vector<std::string> CStreamDriver::ParseOptions (int argc, char* argv[])
+// ---------------------------------------------------------------------------
+// Function: reads the options that follow -stream or -pipe
+// Input:    command line arguments
+// Output:   the arguments that are not options (file names)
+// ---------------------------------------------------------------------------
+{
+    std::vector<std::string> strVFiles;
+    for (int i = 2; i < argc; i++)
+    {
+        std::string strArg = argv[i];
+        if (strArg == "-j")
+        {
+            if (i+1 >= argc)
+                ErrorHandler (CLocalErrorHandler::ERRORCODE::INVALIDCOMMANDLINE);
+            m_nThreads = std::max(0, atoi(argv[++i]));
+        }
+        else
+            strVFiles.push_back (strArg);
+    }
+    return strVFiles;
+}
+
+void CStreamDriver::Process (std::istream& Input, std::ostream& Output,
+                             CThreadPool& Pool)
+// ---------------------------------------------------------------------------
+// Function: runs the pipeline. The calling thread and the pool workers
+//           form the analysis stage while the parser and the writer run
+//           on threads of their own.
+// Input:    input stream, output stream, thread pool
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CBoundedQueue<CSection> Sections(QUEUESIZE);
+    CBoundedQueue<CResult> Results(QUEUESIZE);
+    m_nWindow = 2*QUEUESIZE + Pool.GetNumThreads() + 1;
+    m_nFailed = 0;
+    m_nWritten = 0;
+    m_strCarry.clear ();
+    m_bCarry = false;
+
+    std::thread Parser([this, &Input, &Sections] { ParseStage (Input, Sections); });
+    std::thread Writer([this, &Output, &Results] { WriteStage (Results, Output); });
+    AnalyzeStage (Sections, Results, Pool);
+    Results.Close ();
+    Parser.join ();
+    Writer.join ();
+}
+
+void CStreamDriver::ParseStage (std::istream& Input,
+                                CBoundedQueue<CSection>& Sections)
+// ---------------------------------------------------------------------------
+// Function: parse stage. Splits the input into *HEADING ... *end blocks
+//           and parses each one. A block that cannot be parsed is passed
+//           on as failed so that the output keeps the input order. If the
+//           input cannot be read any further the stream ends with a
+//           failed section that says so.
+// Input:    input stream, queue to the analysis stage
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    std::string strBlock;
+    CSection Section;
+    int nLines = 0;
+    int nIndex = 0;
+    try
+    {
+        for (; ; nIndex++)
+        {
+            Section.nIndex = nIndex;
+            Section.bOK = false;
+            Section.strMessage.clear ();
+            int nFirstLine = 0;
+            CDiagnostics Diagnostics;
+            if (!ReadBlock (Input, strBlock, Section.strTitle, nLines,
+                            nFirstLine, Diagnostics))
+                break;
+
+            // stay within the window of sections in flight
+            {
+                std::unique_lock<std::mutex> Lock(m_WindowMutex);
+                m_Window.wait (Lock, [this, nIndex] {
+                    return nIndex < m_nWritten + m_nWindow; });
+            }
+
+            CElement Element;
+            try
+            {
+                if (Diagnostics.HasErrors())
+                {
+                    // the block itself is broken (lines are in the whole input)
+                    std::ostringstream Message;
+                    Message << "Input error.";
+                    Diagnostics.Write (Message);
+                    Section.strMessage = Message.str();
+                }
+                else
+                {
+                    std::istringstream Block(strBlock);
+                    Element.ParseModel (Block, Section.Model);
+                    Section.bOK = true;
+                }
+            }
+            catch (CLocalErrorHandler::ERRORCODE&)
+            {
+                // list the problems with their lines in the whole input
+                std::ostringstream Message;
+                Message << "Input error.";
+                Element.GetDiagnostics().Write (Message, nFirstLine);
+                Section.strMessage = Message.str();
+            }
+            catch (CGlobalErrorHandler::ERRORCODE&)
+            {
+                Section.strMessage = "Input error.";
+            }
+            catch (CArrayBase::CError& err)
+            {
+                Section.strMessage = "Vector/matrix error. " + err.Describe();
+            }
+            catch (std::exception& err)
+            {
+                Section.strMessage = err.what();
+            }
+            if (!Sections.Push (std::move(Section)))
+                break;
+        }
+    }
+    catch (...)
+    {
+        // the input could not be read: end the stream with a failed
+        // section so that the error is reported and counted
+        CDiagnostics Diagnostics;
+        Diagnostics.Add (CDiagnostics::SEVERITY::SEVERE, nLines,
+                         "Cannot read the input beyond this line.");
+        std::ostringstream Message;
+        Message << "Input error.";
+        Diagnostics.Write (Message);
+        CSection Failed;
+        Failed.nIndex = nIndex;
+        Failed.bOK = false;
+        Failed.strMessage = Message.str();
+        Sections.Push (std::move(Failed));
+    }
+    Sections.Close ();
+}
+
+void CStreamDriver::AnalyzeStage (CBoundedQueue<CSection>& Sections,
+                                  CBoundedQueue<CResult>& Results,
+                                  CThreadPool& Pool)
+// ---------------------------------------------------------------------------
+// Function: analysis stage. One loop per pool thread takes sections off
+//           the queue until the parser is done; the section analyses
+//           submit their own tasks to the same pool. Each loop keeps an
+//           arena for the vectors and matrices of the section being
+//           analyzed and resets it after every section.
+// Input:    queue from the parse stage, queue to the write stage, pool
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    Pool.ParallelFor (0, Pool.GetNumThreads() - 1,
+                      [this, &Sections, &Results, &Pool] (int)
+    {
+        CArena Arena;
+        CSection Section;
+        while (Sections.Pop (Section))
+        {
+            CResult Result;
+            {
+                CArena::CScope Scope(&Arena);
+                AnalyzeSection (Section, Result, Pool);
+            }
+            Arena.Reset ();
+            Results.Push (std::move(Result));
+        }
+    });
+}
+
+void CStreamDriver::AnalyzeSection (CSection& Section, CResult& Result,
+                                    CThreadPool& Pool)
+// ---------------------------------------------------------------------------
+// Function: analyzes one section in its own CElement. All errors are
+//           trapped and recorded so that the other sections carry on.
+// Input:    parsed section, thread pool for the section analyses
+// Output:   formatted results
+// ---------------------------------------------------------------------------
+{
+    Result.nIndex = Section.nIndex;
+    Result.strTitle = Section.strTitle;
+    Result.bOK = false;
+    if (!Section.bOK)
+    {
+        Result.strOutput = Section.strMessage;
+        return;
+    }
+
+    CElement Element;
+    Element.SetThreadPool (&Pool);
+    Element.SetAnalysisCache (&m_Cache);
+    Element.SetDiskCache (m_pDiskCache);
+    Element.SetTimestamps (m_bTimestamps);
+    try
+    {
+        std::ostringstream Output;
+        Element.AnalyzeModel (Section.Model, Output);
+        Result.strOutput = Output.str();
+        Element.GetRecord (Result.Record);
+        Result.Record.strSource = m_strSource;
+        Result.Record.nSection = Section.nIndex + 1;
+        Result.bOK = true;
+    }
+    catch (CLocalErrorHandler::ERRORCODE&)
+    {
+        Result.strOutput = "Input or section analysis error.";
+    }
+    catch (CGlobalErrorHandler::ERRORCODE&)
+    {
+        Result.strOutput = "Library error.";
+    }
+    catch (CArrayBase::CError& err)
+    {
+        Result.strOutput = "Vector/matrix error. " + err.Describe();
+    }
+    catch (std::exception& err)
+    {
+        Result.strOutput = err.what();
+    }
+    catch (...)
+    {
+        Result.strOutput = "Unknown error.";
+    }
+}
+
+void CStreamDriver::WriteStage (CBoundedQueue<CResult>& Results,
+                                std::ostream& Output)
+// ---------------------------------------------------------------------------
+// Function: write stage. Results arrive in any order; each is held until
+//           the ones before it have been written.
+// Input:    queue from the analysis stage, output stream
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    const std::string strRule(60, '=');
+    std::map<int, CResult> Pending;
+    CResult Result;
+    int nNext = 0;
+    while (Results.Pop (Result))
+    {
+        Pending.emplace (Result.nIndex, std::move(Result));
+        while (!Pending.empty() && Pending.begin()->first == nNext)
+        {
+            const CResult& Next = Pending.begin()->second;
+            Output << '\n' << strRule << '\n';
+            Output << "SECTION " << nNext+1 << ": " << Next.strTitle << '\n';
+            Output << strRule << '\n';
+            if (Next.bOK)
+            {
+                Output << Next.strOutput;
+                if (m_pResults != nullptr)
+                    m_pResults->Write (Next.Record);
+            }
+            else
+            {
+                Output << "Analysis failed: " << Next.strOutput << '\n';
+                if (m_pResults != nullptr)
+                    m_pResults->Write (CResultWriter::ErrorRecord (
+                        m_strSource, nNext+1, Next.strOutput));
+                m_nFailed++;
+            }
+            Pending.erase (Pending.begin());
+            nNext++;
+
+            {
+                std::lock_guard<std::mutex> Lock(m_WindowMutex);
+                m_nWritten = nNext;
+            }
+            m_Window.notify_all ();
+        }
+    }
+    Output.flush ();
+    if (m_pResults != nullptr)
+        m_pResults->Flush ();
+}
+
+bool CStreamDriver::ReadBlock (std::istream& Input, std::string& strBlock,
+                               std::string& strTitle, int& nLines,
+                               int& nFirstLine, CDiagnostics& Diagnostics)
+// ---------------------------------------------------------------------------
+// Function: reads the lines of the next section, from the lines before
+//           its *HEADING through its *end line (or the end of the input).
+//           A *HEADING before the *end of the section ends the section
+//           with an error and starts the next one. An *end with the next
+//           keyword on the same line (files joined without a line break
+//           after *end) ends the section and the rest of the line starts
+//           the next one.
+// Input:    input stream, # of lines read so far
+// Output:   block text, title line, updated # of lines, # of input lines
+//           before the first line of the block, problems with the block
+//           structure; false if there are no more sections
+// ---------------------------------------------------------------------------
+{
+    strBlock.clear ();
+    strTitle.clear ();
+    nFirstLine = m_bCarry ? nLines - 1 : nLines;
+    bool bHeading = false, bTitle = false;
+    std::string strLine;
+    for (;;)
+    {
+        if (m_bCarry)
+        {
+            strLine = std::move(m_strCarry);
+            m_bCarry = false;
+        }
+        else if (std::getline (Input, strLine))
+        {
+            nLines++;
+            if (!strLine.empty() && strLine.back() == '\r')
+                strLine.pop_back ();
+        }
+        else
+            break;
+
+        std::string_view strvFirst = FirstToken (strLine);
+        if (CParser::IsEqual (strvFirst, "*heading"))
+        {
+            if (bHeading)
+            {
+                // the section has no *end: leave the line for the next one
+                Diagnostics.Add (CDiagnostics::SEVERITY::SEVERE, nLines,
+                                 "*HEADING before the *end of the section.");
+                m_strCarry = std::move(strLine);
+                m_bCarry = true;
+                return true;
+            }
+            bHeading = true;
+        }
+        else if (strvFirst.size() > 4 &&
+                 CParser::IsEqual (strvFirst.substr (0, 4), "*end") &&
+                 strvFirst[4] == '*')
+        {
+            // *end joined to the next keyword
+            size_t nNext = strLine.find ('*', strLine.find ('*') + 1);
+            m_strCarry = strLine.substr (nNext);
+            m_bCarry = true;
+            strLine.erase (nNext);
+            strvFirst = "*end";
+        }
+        strBlock += strLine;
+        strBlock += '\n';
+
+        if (CParser::IsEqual (strvFirst, "*end"))
+        {
+            if (bHeading)
+                return true;
+            strBlock.clear (); // *end without a section
+            nFirstLine = m_bCarry ? nLines - 1 : nLines;
+        }
+        else if (bHeading && !bTitle && !strvFirst.empty() &&
+                 strvFirst.compare (0, 2, "**") != 0 &&
+                 !CParser::IsEqual (strvFirst, "*heading"))
+        {
+            size_t nStart = strLine.find_first_not_of (" \t");
+            size_t nEnd = strLine.find_last_not_of (" \t");
+            strTitle = strLine.substr (nStart, nEnd - nStart + 1);
+            bTitle = true;
+        }
+    }
+    if (Input.bad())
+        throw CLocalErrorHandler::ERRORCODE::INVALIDINPUT;
+    return bHeading;
+}
+
+int CStreamDriver::GetNumSections () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of sections written
+// Input:    none
+// Output:   # of sections
+// ---------------------------------------------------------------------------
+{
+    return m_nWritten;
+}
+
+int CStreamDriver::GetNumFailed () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of sections that could not be analyzed
+// Input:    none
+// Output:   # of failed sections
+// ---------------------------------------------------------------------------
+{
+    return m_nFailed;
+}
+
+void CStreamDriver::SetDiskCache (CDiskCache* pDiskCache)
+// ---------------------------------------------------------------------------
+// Function: sets the persistent cache used by the sections
+// Input:    cache file (nullptr = none)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pDiskCache = pDiskCache;
+}
+
+void CStreamDriver::SetResultWriter (CResultWriter* pResults)
+// ---------------------------------------------------------------------------
+// Function: sets the writer of the machine-readable results
+// Input:    results writer (nullptr = none)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pResults = pResults;
+}
+
+void CStreamDriver::ErrorHandler (CLocalErrorHandler::ERRORCODE ErrorCode) const
+// ---------------------------------------------------------------------------
+// Function: gateway to the local error handler
+// Input:    error code
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    throw ErrorCode;
+}
@@ -0,0 +1,123 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Streaming driver for input files that hold many
+sections, one *HEADING ... *end block each (e.g.
+the members exported from a frame model). The
+sections go through a three-stage pipeline:
+
+  parse:   one thread reads the input a block at
+           a time and parses each block into a
+           model (CBinarySection::CModel)
+  analyze: workers on the thread pool analyze the
+           models, each in its own CElement, and
+           format the results
+  write:   one thread writes the results in input
+           order
+
+The stages are connected by bounded queues, and
+the parser may run at most a window of sections
+ahead of the writer, so memory use does not grow
+with the size of the input.
+
+Command line:
+  XSDesigner [-cache file] [-results file] -stream [-j threads]
+                    input_file output_file
+  XSDesigner [-cache file] [-results file] -pipe [-j threads]
+  The pipe mode reads the input from stdin and
+  writes the results to stdout, with no banner,
+  times or progress messages.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <mutex>
+#include <condition_variable>
+#include "boundedqueue.h"
+#include "binarysection.h"
+#include "analysiscache.h"
+#include "diskcache.h"
+#include "resultwriter.h"
+#include "diagnostics.h"
+#include "threadpool.h"
+#include "LocalErrorHandler.h"
+
+class CStreamDriver
+{
+    public:
+        CStreamDriver ();   // ctor
+        ~CStreamDriver ();  // dtor
+
+        static const int QUEUESIZE = 16;   // sections between two stages
+
+        // helper functions
+        void Run (int argc, char* argv[]);
+        void RunPipe (int argc, char* argv[]);
+        void Process (std::istream& Input, std::ostream& Output,
+                      CThreadPool& Pool);
+
+        // accessor functions
+        int GetNumSections () const;
+        int GetNumFailed () const;
+
+        // modifier functions
+        void SetDiskCache (CDiskCache* pDiskCache);
+        void SetResultWriter (CResultWriter* pResults);
+
+    private:
+        struct CSection
+        {
+            int nIndex;                   // position in the input (0-based)
+            std::string strTitle;         // title line of the *HEADING block
+            bool bOK;                     // block was parsed
+            std::string strMessage;       // error description
+            CBinarySection::CModel Model; // parsed model
+        };
+        struct CResult
+        {
+            int nIndex;                   // position in the input (0-based)
+            std::string strTitle;         // title line of the *HEADING block
+            bool bOK;                     // analysis completed
+            std::string strOutput;        // formatted results or error description
+            CResultWriter::CRecord Record; // machine-readable results
+        };
+
+        int m_nThreads;                   // # of worker threads (0 = all)
+        bool m_bTimestamps;               // print the start/end times of each section
+        int m_nWindow;                    // max. # of sections in flight
+        int m_nFailed;                    // # of sections that failed
+        int m_nWritten;                   // # of sections written (guarded)
+        std::mutex m_WindowMutex;         // guards m_nWritten
+        std::condition_variable m_Window; // signals a written section
+        CAnalysisCache m_Cache;           // results shared by repeated sections
+        CDiskCache* m_pDiskCache;         // results of earlier runs (nullptr = off)
+        CResultWriter* m_pResults;        // machine-readable results (nullptr = off)
+        std::string m_strSource;          // input file name (for the records)
+        std::string m_strCarry;           // line read but left for the next block
+        bool m_bCarry;                    // m_strCarry holds a line
+
+        void ParseStage (std::istream& Input, CBoundedQueue<CSection>& Sections);
+        void AnalyzeStage (CBoundedQueue<CSection>& Sections,
+                           CBoundedQueue<CResult>& Results, CThreadPool& Pool);
+        void WriteStage (CBoundedQueue<CResult>& Results, std::ostream& Output);
+        void AnalyzeSection (CSection& Section, CResult& Result,
+                             CThreadPool& Pool);
+        bool ReadBlock (std::istream& Input, std::string& strBlock,
+                        std::string& strTitle, int& nLines, int& nFirstLine,
+                        CDiagnostics& Diagnostics);
+        std::vector<std::string> ParseOptions (int argc, char* argv[]);
+        void ErrorHandler (CLocalErrorHandler::ERRORCODE) const;
+
+        // no copies
+        CStreamDriver (const CStreamDriver&) = delete;
+        CStreamDriver& operator= (const CStreamDriver&) = delete;
+};
@@ -0,0 +1,224 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Implementation of the CThreadPool class.
+
+TODO:
+
+**********************************************/
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include "threadpool.h"
+
+thread_local CThreadPool* CThreadPool::m_pCurrentPool = nullptr;
+thread_local int CThreadPool::m_nCurrentWorker = -1;
+
+CThreadPool::CThreadPool (int nThreads)
+// ---------------------------------------------------------------------------
+// Function: constructor. starts the worker threads
+// Input:    # of worker threads (0 = # of hardware threads)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_bStop = false;
+    m_nPending = 0;
+    m_nNextQueue = 0;
+    if (nThreads <= 0)
+        nThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int i = 0; i < nThreads; i++)
+        m_Queues.push_back (std::unique_ptr<CWorkQueue>(new CWorkQueue));
+    for (int i = 0; i < nThreads; i++)
+        m_Workers.emplace_back ([this, i] { WorkerLoop (i); });
+}
+
+CThreadPool::~CThreadPool ()
+// ---------------------------------------------------------------------------
+// Function: destructor. finishes the pending tasks and joins the workers
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    {
+        std::lock_guard<std::mutex> Lock(m_WakeMutex);
+        m_bStop = true;
+    }
+    m_Wake.notify_all ();
+    for (size_t i = 0; i < m_Workers.size(); i++)
+        m_Workers[i].join ();
+}
+
+bool CThreadPool::TryPop (const int nWorker, std::function<void()>& Task)
+// ---------------------------------------------------------------------------
+// Function: takes the newest task of the worker's own deque or, failing
+//           that, steals the oldest task of another worker's deque
+// Input:    worker index
+// Output:   task; returns false if every deque is empty
+// ---------------------------------------------------------------------------
+{
+    int nQueues = static_cast<int>(m_Queues.size());
+    for (int k = 0; k < nQueues; k++)
+    {
+        CWorkQueue& Q = *m_Queues[static_cast<size_t>((nWorker + k) % nQueues)];
+        std::lock_guard<std::mutex> Lock(Q.Mutex);
+        if (Q.Tasks.empty())
+            continue;
+        if (k == 0)
+        {
+            Task = std::move(Q.Tasks.back());
+            Q.Tasks.pop_back ();
+        }
+        else
+        {
+            Task = std::move(Q.Tasks.front());
+            Q.Tasks.pop_front ();
+        }
+        --m_nPending;
+        return true;
+    }
+    return false;
+}
+
+void CThreadPool::WorkerLoop (const int nWorker)
+// ---------------------------------------------------------------------------
+// Function: body of each worker thread
+// Input:    worker index
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    m_pCurrentPool = this;
+    m_nCurrentWorker = nWorker;
+    for (;;)
+    {
+        std::function<void()> Task;
+        if (TryPop (nWorker, Task))
+        {
+            Task ();
+            continue;
+        }
+        std::unique_lock<std::mutex> Lock(m_WakeMutex);
+        m_Wake.wait (Lock, [this] { return m_bStop || m_nPending > 0; });
+        if (m_bStop && m_nPending == 0)
+            return;
+    }
+}
+
+void CThreadPool::Submit (const std::function<void()>& Task)
+// ---------------------------------------------------------------------------
+// Function: queues a task. a worker of this pool pushes onto its own
+//           deque; other threads spread tasks over the deques
+// Input:    task
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    size_t nQueue;
+    if (m_pCurrentPool == this)
+        nQueue = static_cast<size_t>(m_nCurrentWorker);
+    else
+        nQueue = static_cast<size_t>(m_nNextQueue++ % m_Queues.size());
+
+    ++m_nPending;
+    {
+        std::lock_guard<std::mutex> Lock(m_Queues[nQueue]->Mutex);
+        m_Queues[nQueue]->Tasks.push_back (Task);
+    }
+    {
+        std::lock_guard<std::mutex> Lock(m_WakeMutex);
+    }
+    m_Wake.notify_one ();
+}
+
+void CThreadPool::ParallelFor (const int nFirst, const int nLast,
+                               const std::function<void(int)>& Body)
+// ---------------------------------------------------------------------------
+// Function: runs Body(i) for i = nFirst, ..., nLast on the pool and the
+//           calling thread. Indices are handed out one at a time so that
+//           uneven work is balanced. The first exception thrown by Body
+//           is rethrown on the calling thread once the loop is done.
+// Input:    index range, loop body
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    if (nLast < nFirst)
+        return;
+
+    // shared state outlives the call if a helper task starts late
+    struct CLoop
+    {
+        std::atomic<int> nNext;
+        std::atomic<int> nDone;
+        int nLast;
+        std::function<void(int)> Body;
+        std::mutex Mutex;
+        std::condition_variable Finished;
+        std::exception_ptr pError;
+    };
+    std::shared_ptr<CLoop> pLoop = std::make_shared<CLoop>();
+    pLoop->nNext = nFirst;
+    pLoop->nDone = 0;
+    pLoop->nLast = nLast;
+    pLoop->Body = Body;
+    const int nCount = nLast - nFirst + 1;
+
+    auto Run = [pLoop, nCount] ()
+    {
+        for (;;)
+        {
+            int i = pLoop->nNext++;
+            if (i > pLoop->nLast)
+                return;
+            try
+            {
+                pLoop->Body (i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> Lock(pLoop->Mutex);
+                if (!pLoop->pError)
+                    pLoop->pError = std::current_exception();
+            }
+            if (++pLoop->nDone == nCount)
+            {
+                std::lock_guard<std::mutex> Lock(pLoop->Mutex);
+                pLoop->Finished.notify_all ();
+            }
+        }
+    };
+
+    int nHelpers = std::min(GetNumThreads(), nCount - 1);
+    for (int i = 0; i < nHelpers; i++)
+        Submit (Run);
+    Run ();
+
+    // wait for the indices still running on the workers
+    std::unique_lock<std::mutex> Lock(pLoop->Mutex);
+    pLoop->Finished.wait (Lock, [&pLoop, nCount] { return pLoop->nDone == nCount; });
+    if (pLoop->pError)
+        std::rethrow_exception (pLoop->pError);
+}
+
+int CThreadPool::GetNumThreads () const
+// ---------------------------------------------------------------------------
+// Function: gets the number of worker threads
+// Input:    none
+// Output:   # of worker threads
+// ---------------------------------------------------------------------------
+{
+    return static_cast<int>(m_Workers.size());
+}
+
+CThreadPool& CThreadPool::GetDefault ()
+// ---------------------------------------------------------------------------
+// Function: gets the pool shared by the section analyses. it is created
+//           on first use with one worker per hardware thread
+// Input:    none
+// Output:   shared pool
+// ---------------------------------------------------------------------------
+{
+    static CThreadPool Pool;
+    return Pool;
+}
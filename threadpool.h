@@ -0,0 +1,71 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Fixed-size work-stealing pool of worker threads.
+Each worker owns a task deque: tasks submitted from
+a worker go to the back of its own deque and are
+taken from the back (most recent first), while idle
+workers steal from the front of the other deques.
+Work is submitted either as single tasks or as an
+index range through ParallelFor. The thread calling
+ParallelFor takes part in the loop and only waits
+for indices that a worker has already started, so
+ParallelFor may be called from inside a task
+without deadlocking the pool.
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+class CThreadPool
+{
+    public:
+        CThreadPool (int nThreads = 0);  // ctor (0 = # of hardware threads)
+        ~CThreadPool ();                 // dtor
+
+        // helper functions
+        void Submit (const std::function<void()>& Task);
+        void ParallelFor (const int nFirst, const int nLast,
+                          const std::function<void(int)>& Body);
+
+        // accessor functions
+        int GetNumThreads () const;
+        static CThreadPool& GetDefault ();
+
+    private:
+        struct CWorkQueue
+        {
+            std::deque<std::function<void()>> Tasks;  // pending tasks
+            std::mutex Mutex;                         // guards Tasks
+        };
+        std::vector<std::thread> m_Workers;                // worker threads
+        std::vector<std::unique_ptr<CWorkQueue>> m_Queues; // one deque per worker
+        std::atomic<int> m_nPending;                       // # of queued tasks
+        std::atomic<unsigned> m_nNextQueue;                // round robin for outside submits
+        std::mutex m_WakeMutex;                            // guards m_bStop and sleeping
+        std::condition_variable m_Wake;                    // signals new tasks
+        bool m_bStop;                                      // workers should exit
+
+        static thread_local CThreadPool* m_pCurrentPool;   // pool of the calling worker
+        static thread_local int m_nCurrentWorker;          // index of the calling worker
+
+        bool TryPop (const int nWorker, std::function<void()>& Task);
+        void WorkerLoop (const int nWorker);
+
+        // no copies
+        CThreadPool (const CThreadPool&) = delete;
+        CThreadPool& operator= (const CThreadPool&) = delete;
+};
@@ -0,0 +1,287 @@
+/**********************************************
+Concrete and Steel Cross-Section Design Program
+
+Created by: Aaron Fairchild
+Based on the work of: S.B. Rajan
+Date: Fall 2026
+
+Closed-form equivalent rectangular stress block
+capacity for the standard section types. The
+compression zone area and centroid are computed
+analytically for the section type chosen at
+compile time, so a capacity evaluation costs
+O(# of bars) and needs no fiber mesh.
+
+Geometry and sign conventions are the same as
+CFiberSection (bending about x, compression on
+the +y face, compression positive).
+
+TODO:
+
+**********************************************/
+#pragma once
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "..\libraryEXH\arraycontainersEXH.h"
+#include "constants.h"
+#include "xstype.h"
+#include "reinforcement.h"
+#include "fibersection.h"
+#include "LocalErrorHandler.h"
+
+template <CXSType::EPType TYPE>
+class CWhitneySection
+{
+    public:
+        CWhitneySection (const CXSType& XS, const float fFc,
+                         const float fFy, const float fEs);
+        ~CWhitneySection ();
+
+        // helper functions
+        void AddBars (const CReinforcement& Re);
+        void FindMomentCapacity (const float fP, const CFiberSection& Phi,
+                                 float& fMn, float& fPhiMn, float& fC,
+                                 float& fEpsT, float& fPhi) const;
+
+    private:
+        float m_fDims[MAXEPDIM];     // section dimensions
+        float m_fYTop;               // y of the extreme compression fiber
+        float m_fDepth;              // total depth
+        float m_fYg;                 // y of the gross section centroid
+        float m_fFc, m_fFy, m_fEs;   // material data (ksi)
+        float m_fBeta1;              // stress block depth factor
+        float m_fEpsCU;              // limiting concrete strain
+        std::vector<float> m_fVYs;   // bar y-coordinates
+        std::vector<float> m_fVAs;   // bar areas
+
+        void  CompressionZone (const float fA, float& fAc,
+                               float& fYc) const;
+        float Forces (const float fC, float& fMx) const;
+        float TensileStrain (const float fC) const;
+};
+
+template <CXSType::EPType TYPE>
+CWhitneySection<TYPE>::CWhitneySection (const CXSType& XS, const float fFc,
+                                        const float fFy, const float fEs)
+// ---------------------------------------------------------------------------
+// Function: constructor. stores the dimensions and material data
+//           rectangle: width, depth (origin at the centroid)
+//           T-section: total depth, flange width, web width, flange
+//                      thickness (origin at the web centerline at the
+//                      underside of the flange)
+//           circle:    radius (origin at the center)
+// Input:    cross-section (must be of type TYPE), f'c, fy and Es (ksi)
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    CXSType::EPType Type;
+    XS.GetType (Type);
+    if (Type != TYPE || fFc <= 0.0f || fFy <= 0.0f || fEs <= 0.0f)
+        throw CLocalErrorHandler::ERRORCODE::INVALIDSECTION;
+
+    CVectorN<float,MAXEPDIM> fVDims;
+    XS.GetDimensions (fVDims);
+    for (int i = 0; i < MAXEPDIM; i++)
+        m_fDims[i] = fVDims(i+1);
+
+    if constexpr (TYPE == CXSType::EPType::RECTS)
+    {
+        m_fDepth = m_fDims[1];
+        m_fYTop = 0.5f*m_fDepth;
+        m_fYg = 0.0f;
+    }
+    else if constexpr (TYPE == CXSType::EPType::TSECTION)
+    {
+        float fH = m_fDims[0], fBf = m_fDims[1];
+        float fBw = m_fDims[2], fTf = m_fDims[3];
+        m_fDepth = fH;
+        m_fYTop = fTf;
+        float fAf = fBf*fTf, fAw = fBw*(fH - fTf);
+        m_fYg = (fAf*0.5f*fTf + fAw*0.5f*(fTf - fH)) / (fAf + fAw);
+    }
+    else
+    {
+        m_fDepth = 2.0f*m_fDims[0];
+        m_fYTop = m_fDims[0];
+        m_fYg = 0.0f;
+    }
+    if (m_fDepth <= 0.0f)
+        throw CLocalErrorHandler::ERRORCODE::INVALIDSECTION;
+
+    m_fFc = fFc;
+    m_fFy = fFy;
+    m_fEs = fEs;
+    m_fEpsCU = 0.003f;
+    m_fBeta1 = std::min(0.85f, std::max(0.65f, 0.85f - 0.05f*(fFc - 4.0f)));
+}
+
+template <CXSType::EPType TYPE>
+CWhitneySection<TYPE>::~CWhitneySection ()
+// ---------------------------------------------------------------------------
+// Function: destructor
+// Input:    none
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+}
+
+template <CXSType::EPType TYPE>
+void CWhitneySection<TYPE>::AddBars (const CReinforcement& Re)
+// ---------------------------------------------------------------------------
+// Function: stores the bar areas and heights
+// Input:    reinforcement data
+// Output:   none
+// ---------------------------------------------------------------------------
+{
+    float fDia, fX, fY;
+    m_fVYs.clear ();
+    m_fVAs.clear ();
+    for (int i = 1; i <= Re.GetNumBars(); i++)
+    {
+        Re.GetBar (i, fDia, fX, fY);
+        m_fVYs.push_back (fY);
+        m_fVAs.push_back (static_cast<float>(PI) * fDia * fDia / 4.0f);
+    }
+}
+
+template <CXSType::EPType TYPE>
+void CWhitneySection<TYPE>::CompressionZone (const float fA, float& fAc,
+                                             float& fYc) const
+// ---------------------------------------------------------------------------
+// Function: area and centroid of the concrete within a depth a of the
+//           extreme compression fiber
+// Input:    stress block depth a
+// Output:   area, y of its centroid
+// ---------------------------------------------------------------------------
+{
+    float fAa = std::min(std::max(fA, 0.0f), m_fDepth);
+    if constexpr (TYPE == CXSType::EPType::RECTS)
+    {
+        fAc = m_fDims[0]*fAa;
+        fYc = m_fYTop - 0.5f*fAa;
+    }
+    else if constexpr (TYPE == CXSType::EPType::TSECTION)
+    {
+        float fBf = m_fDims[1], fBw = m_fDims[2], fTf = m_fDims[3];
+        if (fAa <= fTf)
+        {
+            fAc = fBf*fAa;
+            fYc = fTf - 0.5f*fAa;
+        }
+        else
+        {
+            float fAf = fBf*fTf, fAw = fBw*(fAa - fTf);
+            fAc = fAf + fAw;
+            fYc = (fAf*0.5f*fTf + fAw*0.5f*(fTf - fAa)) / fAc;
+        }
+    }
+    else
+    {
+        // circular segment of height a
+        double dR = m_fDims[0];
+        double dT = 2.0*acos((dR - fAa)/dR);
+        double dS = dT - sin(dT);
+        fAc = static_cast<float>(0.5*dR*dR*dS);
+        double dSh = sin(0.5*dT);
+        fYc = (dS > 0.0) ? static_cast<float>(4.0*dR*dSh*dSh*dSh/(3.0*dS))
+                         : m_fYTop;
+    }
+}
+
+template <CXSType::EPType TYPE>
+float CWhitneySection<TYPE>::Forces (const float fC, float& fMx) const
+// ---------------------------------------------------------------------------
+// Function: axial force and moment about the gross centroid for a
+//           neutral axis depth (strain compatibility, steel elastic-
+//           perfectly plastic with the displaced concrete removed)
+// Input:    neutral axis depth c
+// Output:   returns the axial force, fMx is the moment
+// ---------------------------------------------------------------------------
+{
+    float fA = m_fBeta1*fC;
+    float fAc, fYc;
+    CompressionZone (fA, fAc, fYc);
+    float fCB = 0.85f*m_fFc;
+    float fN = fCB*fAc;
+    fMx = fN*(fYc - m_fYg);
+
+    for (size_t i = 0; i < m_fVYs.size(); i++)
+    {
+        float fD = m_fYTop - m_fVYs[i];
+        float fEps = m_fEpsCU*(fC - fD)/fC;
+        float fS = std::min(std::max(m_fEs*fEps, -m_fFy), m_fFy);
+        if (fD < fA)
+            fS -= fCB;
+        float fF = fS*m_fVAs[i];
+        fN += fF;
+        fMx += fF*(m_fVYs[i] - m_fYg);
+    }
+    return fN;
+}
+
+template <CXSType::EPType TYPE>
+float CWhitneySection<TYPE>::TensileStrain (const float fC) const
+// ---------------------------------------------------------------------------
+// Function: net tensile strain in the extreme tension steel (extreme
+//           fiber if there are no bars)
+// Input:    neutral axis depth c
+// Output:   returns the strain (tension positive)
+// ---------------------------------------------------------------------------
+{
+    float fDt = m_fDepth;
+    if (!m_fVYs.empty())
+        fDt = m_fYTop - *std::min_element(m_fVYs.begin(), m_fVYs.end());
+    return m_fEpsCU*(fDt - fC)/fC;
+}
+
+template <CXSType::EPType TYPE>
+void CWhitneySection<TYPE>::FindMomentCapacity (const float fP,
+                                                const CFiberSection& Phi,
+                                                float& fMn, float& fPhiMn,
+                                                float& fC, float& fEpsT,
+                                                float& fPhi) const
+// ---------------------------------------------------------------------------
+// Function: nominal and design moment capacities about the x-axis by
+//           strain compatibility at the point of the design curve where
+//           phi*Pn equals the factored axial load. The neutral axis depth
+//           is found by bisection on log(c), as in
+//           CFiberSection::FindMomentCapacity. The capacity is zero if the
+//           axial load is outside the range the section can carry.
+// Input:    factored axial load (compression positive), section that
+//           gives phi for a net tensile strain
+// Output:   Mn, phi*Mn, neutral axis depth, net tensile strain, phi
+// ---------------------------------------------------------------------------
+{
+    const int MAXITERATIONS = 100;
+    fMn = fPhiMn = fC = fEpsT = 0.0f;
+    fPhi = Phi.GetPhi (0.0f);
+
+    // phi*Pn at a depth c
+    auto Force = [this, &Phi] (const double dC)
+    {
+        float fMx;
+        float fCc = static_cast<float>(dC);
+        return Phi.GetPhi (TensileStrain (fCc)) * Forces (fCc, fMx);
+    };
+
+    double dCLo = 1.0e-4*m_fDepth, dCHi = 1.0e3*m_fDepth;
+    if (fP < Force (dCLo) || fP > Force (dCHi))
+        return;
+
+    // phi*Pn increases with c
+    for (int i = 0; i < MAXITERATIONS && dCHi/dCLo > 1.0 + 1.0e-6; i++)
+    {
+        double dC = sqrt(dCLo*dCHi);
+        if (Force (dC) < fP)
+            dCLo = dC;
+        else
+            dCHi = dC;
+    }
+
+    fC = static_cast<float>(sqrt(dCLo*dCHi));
+    Forces (fC, fMn);
+    fEpsT = TensileStrain (fC);
+    fPhi = Phi.GetPhi (fEpsT);
+    fPhiMn = fPhi*fMn;
+}
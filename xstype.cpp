@@ -98,3 +98,15 @@ void CXSType::GetDimensions (CVector<float>& fV) const
     for (int i=1; i <= m_numDimensions; i++)
         fV(i) = m_fVDimensions(i);
 }
+
+void CXSType::GetDimensions (CVectorN<float,MAXEPDIM>& fV) const
+// ---------------------------------------------------------------------------
+// Function: gets the cross-sectional dimensions into a fixed-size vector
+// Input:    vector to hold x/s dimensions
+// Output:   x/s dimensions, unused entries are zero
+// ---------------------------------------------------------------------------
+{
+    fV.Set (0.0f);
+    for (int i=1; i <= m_numDimensions; i++)
+        fV(i) = m_fVDimensions(i);
+}
@@ -12,6 +12,7 @@ Object-Oriented Numerical Analysis
 #pragma once
 #include <string>
 #include "..\libraryEXH\arraycontainersEXH.h"
+#include "constants.h"
 
 class CXSType
 {
@@ -28,6 +29,7 @@ class CXSType
         // accessor functions
         void GetProperties(float&, float&, float&, float&, float&, float&, float&);
         void GetDimensions (CVector<float>&) const;
+        void GetDimensions (CVectorN<float,MAXEPDIM>&) const;
         void GetType(EPType& Type) const;
         virtual void ComputeProperties () = 0;
 